@@ -536,6 +536,13 @@ uint16 *ob_uca_contraction2_weight(const ObContractions *list, ob_wc_t wc1, ob_w
 size_t ob_lengthsp_8bit(const ObCharsetInfo *cs __attribute__((unused)),
                         const char *ptr, size_t length);
 
+// Length of the longest common prefix of @a and @b, both of which are at least @len bytes
+size_t ob_common_prefix_len(const uchar *a, const uchar *b, size_t len);
+
+// Length of the longest common prefix of @a and @b that consists of ascii chars only and
+// is equal under the sort weights of ob_unicase_default (ascii letters sorted as upper case)
+size_t ob_common_ascii_ci_prefix_len(const uchar *a, const uchar *b, size_t len);
+
 int ob_strnncoll_mb_bin(const ObCharsetInfo *cs __attribute__((unused)),
                     const uchar *s, size_t slen,
                     const uchar *t, size_t tlen,
@@ -1814,6 +1814,25 @@ static inline void ob_tosort_unicode(ObUnicaseInfo *uni_plane, ob_wc_t *wc, unsi
   }
 }
 
+/*
+ * Ascii chars are single byte and share sort weights with their upper case letters, so the
+ * leading chars that are all ascii and of equal weights can be skipped without decoding.
+ * Comparison continues from the first position that is non-ascii or differs.
+ */
+static inline void ob_skip_common_ascii_prefix_utf8mb4(const ObCharsetInfo *cs,
+                                                       const unsigned char **src,
+                                                       const unsigned char *se,
+                                                       const unsigned char **dst,
+                                                       const unsigned char *te)
+{
+  if (cs->caseinfo == &ob_unicase_default && !(cs->state & OB_CS_LOWER_SORT)) {
+    const size_t len = OB_MIN(se - *src, te - *dst);
+    const size_t prefix_len = ob_common_ascii_ci_prefix_len(*src, *dst, len);
+    *src += prefix_len;
+    *dst += prefix_len;
+  }
+}
+
 static int ob_strnncoll_utf8mb4(const ObCharsetInfo *cs,
                      const unsigned char *src, size_t srclen,
                      const unsigned char *dst, size_t dstlen,
@@ -1823,6 +1842,7 @@ static int ob_strnncoll_utf8mb4(const ObCharsetInfo *cs,
   const unsigned char *se = src + srclen;
   const unsigned char *te = dst + dstlen;
   ObUnicaseInfo *uni_plane = cs->caseinfo;
+  ob_skip_common_ascii_prefix_utf8mb4(cs, &src, se, &dst, te);
   while ( src < se && dst < te ) {
     int s_res = ob_mb_wc_utf8mb4(cs, &src_wc, src, se);
     int t_res = ob_mb_wc_utf8mb4(cs, &dst_wc, dst, te);
@@ -1893,6 +1913,7 @@ static int ob_strnncollsp_utf8mb4(const ObCharsetInfo *cs,
   ob_wc_t src_wc = 0, dst_wc = 0;
   const unsigned char *se= src + srclen, *te= dst + dstlen;
   ObUnicaseInfo *uni_plane= cs->caseinfo;
+  ob_skip_common_ascii_prefix_utf8mb4(cs, &src, se, &dst, te);
   while ( src < se && dst < te ) {
     int s_res= ob_mb_wc_utf8mb4(cs, &src_wc, src, se);
     int t_res= ob_mb_wc_utf8mb4(cs, &dst_wc, dst, te);
@@ -133,7 +133,7 @@ public:
   enum { IO_BUFFER_SIZE = 1<<16 };
   ReadBuffer(int fd): fd_(fd), has_EAGAIN_(false), request_more_data_(false),
                 alloc_buf_(NULL), buf_end_(NULL), cur_buf_(NULL), data_end_(NULL),
-                consume_sz_(0)
+                consume_sz_(0), read_syscall_cnt_(0)
   {}
   ~ReadBuffer() 
   {
@@ -176,6 +176,7 @@ public:
     return ret;
   }
   uint64_t get_consume_sz() const {return ATOMIC_LOAD(&consume_sz_); }
+  uint64_t get_read_syscall_cnt() const { return ATOMIC_LOAD(&read_syscall_cnt_); }
 private:
   int try_read_fd(int64_t limit) {
     int ret = OB_SUCCESS;
@@ -221,6 +222,7 @@ private:
     int ret = OB_SUCCESS;
     while(remain() < sz && OB_SUCCESS == ret) {
       int64_t rbytes = 0;
+      read_syscall_cnt_++;
       if ((rbytes = read(fd_, data_end_, buf_end_ - data_end_)) > 0) {
         data_end_ += rbytes;
       } else if (0 == rbytes) {
@@ -253,6 +255,7 @@ private:
   char* cur_buf_;
   char* data_end_;
   uint64_t consume_sz_;
+  uint64_t read_syscall_cnt_;
 };
 
 class ObSqlNioImpl;
@@ -269,12 +272,11 @@ public:
     buf_ = buf;
     sz_ = sz;
   }
-  int try_write(int fd, bool& become_clean) {
+  int try_write(int fd, bool& become_clean, int64_t& wbytes, uint64_t& write_syscall_cnt) {
     int ret = OB_SUCCESS;
-    int64_t wbytes = 0;
     if (NULL == buf_) {
       // no pending task
-    } else if (OB_FAIL(do_write(fd, buf_, sz_, wbytes))) {
+    } else if (OB_FAIL(do_write(fd, buf_, sz_, wbytes, write_syscall_cnt))) {
       LOG_WARN("do_write fail", K(ret));
     } else if (wbytes >= sz_) {
       become_clean = true;
@@ -286,15 +288,19 @@ public:
     return ret;
   }
 private:
-  int do_write(int fd, const char* buf, int64_t sz, int64_t& consume_bytes) {
+  int do_write(int fd, const char* buf, int64_t sz, int64_t& consume_bytes,
+               uint64_t& write_syscall_cnt) {
     int ret = OB_SUCCESS;
     int64_t pos = 0;
     while(pos < sz && OB_SUCCESS == ret) {
       int64_t wbytes = 0;
+      write_syscall_cnt++;
       if ((wbytes = write(fd, buf + pos, sz - pos)) >= 0) {
         pos += wbytes;
       } else if (EAGAIN == errno || EWOULDBLOCK == errno) {
-        LOG_INFO("write return EAGAIN");
+        // don't spin in the epoll thread, the rest is written on EPOLLOUT
+        LOG_INFO("write return EAGAIN", K(fd), K(pos), K(sz));
+        break;
       } else if (EINTR == errno) {
         // pass
       } else {
@@ -317,13 +323,16 @@ class ObSqlSock: public ObLink
 public:
   ObSqlSock(ObSqlNioImpl& nio, int fd): nio_impl_(nio), fd_(fd), err_(0), read_buffer_(fd), 
             need_epoll_trigger_write_(false), may_handling_(true), handler_close_flag_(false),
-            need_shutdown_(false), last_decode_time_(0), last_write_time_(0), sql_session_info_(NULL) {
+            need_shutdown_(false), last_decode_time_(0), last_write_time_(0), write_bytes_(0),
+            write_syscall_cnt_(0), sql_session_info_(NULL) {
     memset(sess_, 0, sizeof(sess_));
   }
   ~ObSqlSock() {}
   int64_t get_remain_sz() const { return read_buffer_.get_remain_sz(); }
   TO_STRING_KV(KP(this), K_(fd), K_(err), K(last_decode_time_), K(last_write_time_),
-              K(read_buffer_.get_consume_sz()), K(get_pending_flag()), KPC(get_trace_id()));
+              K(read_buffer_.get_consume_sz()), K(read_buffer_.get_read_syscall_cnt()),
+              K(get_write_bytes()), K(get_write_syscall_cnt()),
+              K(get_pending_flag()), KPC(get_trace_id()));
   ObSqlNioImpl& get_nio_impl() { return nio_impl_; }
   bool set_error(int err) { return 0 == ATOMIC_TAS(&err_, err); }
   bool has_error() const { return ATOMIC_LOAD(&err_) != 0; }
@@ -337,6 +346,9 @@ public:
   }
   void set_last_decode_succ_time(int64_t time) { last_decode_time_ = time;  }  
   int64_t get_consume_sz() { return read_buffer_.get_consume_sz(); }
+  uint64_t get_read_syscall_cnt() const { return read_buffer_.get_read_syscall_cnt(); }
+  uint64_t get_write_bytes() const { return ATOMIC_LOAD(&write_bytes_); }
+  uint64_t get_write_syscall_cnt() const { return ATOMIC_LOAD(&write_syscall_cnt_); }
 
   int peek_data(int64_t limit, const char*& buf, int64_t& sz) {
     return  read_buffer_.peek_data(limit ,buf, sz);
@@ -349,7 +361,12 @@ public:
   bool is_need_epoll_trigger_write() const { return need_epoll_trigger_write_; }
   int do_pending_write(bool& become_clean) {
     int ret = OB_SUCCESS;
-    if (OB_FAIL(pending_write_task_.try_write(fd_, become_clean))) {
+    int64_t wbytes = 0;
+    uint64_t write_syscall_cnt = 0;
+    ret = pending_write_task_.try_write(fd_, become_clean, wbytes, write_syscall_cnt);
+    ATOMIC_FAA(&write_bytes_, wbytes);
+    ATOMIC_FAA(&write_syscall_cnt_, write_syscall_cnt);
+    if (OB_FAIL(ret)) {
       need_epoll_trigger_write_ = false;
       LOG_WARN("pending write task write fail", K(ret));
     } else if (become_clean) {
@@ -367,6 +384,7 @@ public:
     int64_t pos = 0;
     while(pos < sz && OB_SUCCESS == ret) {
       int64_t wbytes = 0;
+      ATOMIC_INC(&write_syscall_cnt_);
       if ((wbytes = write(fd_, buf + pos, sz - pos)) >= 0) {
         pos += wbytes;
         LOG_DEBUG("write fd", K(wbytes));
@@ -380,6 +398,7 @@ public:
         LOG_WARN("write data error", K(errno));
       }
     }
+    ATOMIC_FAA(&write_bytes_, pos);
     last_write_time_ = ObTimeUtility::current_time();
     return ret;
   }
@@ -433,6 +452,9 @@ private:
   bool need_shutdown_;
   int64_t last_decode_time_;
   int64_t last_write_time_;
+  // bytes and write syscalls sent on this connection
+  uint64_t write_bytes_;
+  uint64_t write_syscall_cnt_;
   void* sql_session_info_;
 public:
   char sess_[3000] __attribute__((aligned(16)));
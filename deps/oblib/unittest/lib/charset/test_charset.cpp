@@ -126,6 +126,50 @@ TEST_F(TestCharset, strcmp)
   ASSERT_EQ(0, ret);
 }
 
+TEST_F(TestCharset, strcmp_long_prefix)
+{
+  // prefixes longer than one simd chunk, differ at every position
+  const int64_t LEN = 100;
+  char aa[LEN];
+  char bb[LEN];
+  char ff[LEN];
+  for (int64_t i = 0; i < LEN; ++i) {
+    aa[i] = static_cast<char>('a' + i % 26);
+    bb[i] = static_cast<char>('A' + i % 26);
+  }
+  memcpy(ff, aa, LEN);
+  ASSERT_EQ(0, ObCharset::strcmpsp(CS_TYPE_UTF8MB4_GENERAL_CI, aa, LEN, bb, LEN, false));
+  ASSERT_TRUE(ObCharset::strcmpsp(CS_TYPE_UTF8MB4_BIN, aa, LEN, bb, LEN, false) > 0);
+  for (int64_t i = 0; i < LEN; ++i) {
+    const char orig = bb[i];
+    bb[i] = '~';
+    ff[i] = '~';
+    ASSERT_TRUE(ObCharset::strcmpsp(CS_TYPE_UTF8MB4_GENERAL_CI, aa, LEN, bb, LEN, false) < 0);
+    ASSERT_TRUE(ObCharset::strcmpsp(CS_TYPE_UTF8MB4_GENERAL_CI, bb, LEN, aa, LEN, false) > 0);
+    ASSERT_TRUE(ObCharset::strcmpsp(CS_TYPE_UTF8MB4_BIN, aa, LEN, ff, LEN, false) < 0);
+    ASSERT_TRUE(ObCharset::strcmpsp(CS_TYPE_UTF8MB4_BIN, ff, LEN, aa, LEN, false) > 0);
+    bb[i] = orig;
+    ff[i] = aa[i];
+  }
+  // trailing spaces
+  char cc[LEN + 3];
+  memcpy(cc, aa, LEN);
+  memcpy(cc + LEN, "   ", 3);
+  ASSERT_EQ(0, ObCharset::strcmpsp(CS_TYPE_UTF8MB4_GENERAL_CI, bb, LEN, cc, LEN + 3, false));
+  ASSERT_EQ(0, ObCharset::strcmpsp(CS_TYPE_UTF8MB4_BIN, aa, LEN, cc, LEN + 3, false));
+  ASSERT_NE(0, ObCharset::strcmpsp(CS_TYPE_UTF8MB4_BIN, aa, LEN, cc, LEN + 3, true));
+  // non-ascii char after a long ascii prefix, U+00C0 sorts as 'A' in general_ci
+  char dd[LEN + 1];
+  char ee[LEN + 1];
+  memcpy(dd, aa, LEN - 1);
+  memcpy(ee, bb, LEN - 1);
+  dd[LEN - 1] = 'a';
+  ee[LEN - 1] = static_cast<char>(0xC3);
+  ee[LEN] = static_cast<char>(0x80);
+  ASSERT_EQ(0, ObCharset::strcmpsp(CS_TYPE_UTF8MB4_GENERAL_CI, dd, LEN, ee, LEN + 1, false));
+  ASSERT_EQ(0, ObCharset::strcmp(CS_TYPE_UTF8MB4_GENERAL_CI, dd, LEN, ee, LEN + 1));
+}
+
 TEST_F(TestCharset, sortkey)
 {
   char aa[10] = "abc";
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX RPC_OBMYSQL
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "lib/allocator/ob_malloc.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/time/ob_time_utility.h"
+#include "rpc/obmysql/ob_sql_nio.h"
+#include "rpc/obmysql/ob_i_sql_sock_handler.h"
+#include "rpc/obmysql/ob_i_sm_conn_callback.h"
+#include "rpc/obmysql/ob_sql_sock_session.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::obmysql;
+using namespace oceanbase::observer;
+
+class MockConnCallback : public ObISMConnectionCallback
+{
+public:
+  virtual int init(ObSqlSockSession& sess, ObSMConnection& conn) { UNUSED(sess); UNUSED(conn); return OB_SUCCESS; }
+  virtual void destroy(ObSMConnection& conn) { UNUSED(conn); }
+  virtual int on_disconnect(ObSMConnection& conn) { UNUSED(conn); return OB_SUCCESS; }
+};
+
+class MockSqlSockHandler : public ObISqlSockHandler
+{
+public:
+  static const int64_t MAX_SESS_COUNT = 8;
+  MockSqlSockHandler(ObSqlNio& nio) : nio_(nio), conn_cb_(), sess_count_(0), flushed_count_(0)
+  {
+    MEMSET(sess_, 0, sizeof(sess_));
+  }
+  virtual int on_readable(void* sess) { UNUSED(sess); return OB_SUCCESS; }
+  virtual void on_close(void* sess, int err)
+  {
+    UNUSED(err);
+    ((ObSqlSockSession*)sess)->destroy();
+  }
+  virtual void on_flushed(void* sess) { UNUSED(sess); ATOMIC_INC(&flushed_count_); }
+  virtual int on_connect(void* sess, int fd)
+  {
+    UNUSED(fd);
+    int ret = OB_SUCCESS;
+    ObSqlSockSession* sock_sess = new(sess)ObSqlSockSession(conn_cb_, nio_);
+    if (OB_FAIL(sock_sess->init())) {
+      LOG_WARN("sess init failed", K(ret));
+    } else {
+      const int64_t idx = ATOMIC_LOAD(&sess_count_);
+      if (idx < MAX_SESS_COUNT) {
+        sess_[idx] = sess;
+      }
+      ATOMIC_INC(&sess_count_);
+    }
+    return ret;
+  }
+  int64_t get_sess_count() const { return ATOMIC_LOAD(&sess_count_); }
+  int64_t get_flushed_count() const { return ATOMIC_LOAD(&flushed_count_); }
+  void* get_sess(int64_t idx) const { return sess_[idx]; }
+private:
+  ObSqlNio& nio_;
+  MockConnCallback conn_cb_;
+  void* sess_[MAX_SESS_COUNT];
+  int64_t sess_count_;
+  int64_t flushed_count_;
+};
+
+class TestSqlNio : public ::testing::Test
+{
+public:
+  // far larger than the socket buffers, so that the async write hits EAGAIN
+  static const int64_t WRITE_SIZE = 64L << 20;
+  static const int64_t WAIT_TIMEOUT_US = 10L * 1000 * 1000;
+  TestSqlNio() : nio_(), handler_(nio_), port_(0), buf_(NULL) {}
+  virtual void SetUp()
+  {
+    port_ = 30000 + static_cast<int>(getpid() % 20000);
+    ASSERT_EQ(OB_SUCCESS, nio_.start(port_, &handler_, 1));
+    ASSERT_TRUE(NULL != (buf_ = static_cast<char*>(ob_malloc(WRITE_SIZE, "TestSqlNio"))));
+    for (int64_t i = 0; i < WRITE_SIZE; ++i) {
+      buf_[i] = static_cast<char>(i % 251);
+    }
+  }
+  virtual void TearDown()
+  {
+    nio_.stop();
+    nio_.wait();
+    if (NULL != buf_) {
+      ob_free(buf_);
+      buf_ = NULL;
+    }
+  }
+  int connect_client()
+  {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    int rcvbuf = 4096;
+    struct sockaddr_in sin;
+    MEMSET(&sin, 0, sizeof(sin));
+    sin.sin_family = AF_INET;
+    sin.sin_port = htons(static_cast<uint16_t>(port_));
+    sin.sin_addr.s_addr = inet_addr("127.0.0.1");
+    if (fd >= 0) {
+      setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+      if (0 != connect(fd, (struct sockaddr*)&sin, sizeof(sin))) {
+        close(fd);
+        fd = -1;
+      }
+    }
+    return fd;
+  }
+  bool wait_sess_count(int64_t count)
+  {
+    const int64_t begin = ObTimeUtility::current_time();
+    while (handler_.get_sess_count() < count
+           && ObTimeUtility::current_time() - begin < WAIT_TIMEOUT_US) {
+      usleep(1000);
+    }
+    return handler_.get_sess_count() >= count;
+  }
+  bool wait_flushed_count(int64_t count)
+  {
+    const int64_t begin = ObTimeUtility::current_time();
+    while (handler_.get_flushed_count() < count
+           && ObTimeUtility::current_time() - begin < WAIT_TIMEOUT_US) {
+      usleep(1000);
+    }
+    return handler_.get_flushed_count() >= count;
+  }
+protected:
+  ObSqlNio nio_;
+  MockSqlSockHandler handler_;
+  int port_;
+  char* buf_;
+};
+
+TEST_F(TestSqlNio, pending_write_on_epollout)
+{
+  int slow_fd = connect_client();
+  ASSERT_GE(slow_fd, 0);
+  ASSERT_TRUE(wait_sess_count(1));
+
+  // the client does not read, the async write stops at EAGAIN and waits for EPOLLOUT
+  nio_.async_write_data(handler_.get_sess(0), buf_, WRITE_SIZE);
+  usleep(200 * 1000);
+  EXPECT_EQ(0, handler_.get_flushed_count());
+
+  // the nio thread is not spinning on the blocked socket, it still serves other connections
+  int other_fd = connect_client();
+  ASSERT_GE(other_fd, 0);
+  EXPECT_TRUE(wait_sess_count(2));
+  EXPECT_EQ(0, handler_.get_flushed_count());
+
+  // the rest of the buffer is written on EPOLLOUT as the client drains the socket
+  const int64_t read_buf_size = 1L << 16;
+  char read_buf[read_buf_size];
+  int64_t pos = 0;
+  while (pos < WRITE_SIZE) {
+    ssize_t rbytes = read(slow_fd, read_buf, std::min(read_buf_size, WRITE_SIZE - pos));
+    ASSERT_GT(rbytes, 0) << "pos " << pos << " errno " << errno;
+    for (ssize_t i = 0; i < rbytes; ++i) {
+      ASSERT_EQ(buf_[pos + i], read_buf[i]) << "pos " << pos + i;
+    }
+    pos += rbytes;
+  }
+  EXPECT_TRUE(wait_flushed_count(1));
+  close(other_fd);
+  close(slow_fd);
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_sql_nio.log*");
+  OB_LOGGER.set_file_name("test_sql_nio.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,4 +1,4 @@
 Name: %NAME
-Version:4.0.0.0
+Version:4.1.0.0
 Release: %RELEASE
 BuildRequires: binutils = 2.30
@@ -509,6 +509,10 @@ public:
    // Switch: Whether to format the module to print the relevant logs
   // No printing by default
   T_DEF_BOOL(enable_formatter_print_log, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
+  // Number of consecutive stmts of one ObLogEntryTask pushed to the same formatter queue.
+  // Stmts of a large log entry are spread over formatter threads in batches of this size,
+  // larger value keeps better locality, smaller value gives more parallelism.
+  T_DEF_INT(formatter_stmt_batch_count, OB_CLUSTER_PARAMETER, 16, 1, 10240, "formatter stmt batch count per queue");
 
   // Switch: Whether to enable SSL authentication: including MySQL and RPC
   // Disabled by default
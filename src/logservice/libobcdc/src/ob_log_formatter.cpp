@@ -216,6 +216,7 @@ void ObLogFormatter::stop()
 int ObLogFormatter::push(IStmtTask *stmt_task, volatile bool &stop_flag)
 {
   int ret = OB_SUCCESS;
+  DmlStmtTask *dml_stmt_task = NULL;
 
   if (OB_UNLIKELY(! inited_)) {
     LOG_ERROR("ObLogFormatter has not been initialized");
@@ -223,14 +224,23 @@ int ObLogFormatter::push(IStmtTask *stmt_task, volatile bool &stop_flag)
   } else if (OB_ISNULL(stmt_task)) {
     LOG_ERROR("invalid arguments", K(stmt_task));
     ret = OB_INVALID_ARGUMENT;
+  } else if (OB_ISNULL(dml_stmt_task = dynamic_cast<DmlStmtTask *>(stmt_task))) {
+    LOG_ERROR("stmt_task is not DmlStmtTask", KPC(stmt_task));
+    ret = OB_INVALID_ARGUMENT;
   } else {
-    // Ensure that all stmt of ObLogEntryTask are pushed to the same queue
-    const uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
+    ObLogEntryTask &log_entry_task = dml_stmt_task->get_redo_log_entry_task();
+    // Stmts of one ObLogEntryTask are spread over formatter queues in batches, so that a large
+    // log entry is formatted by multiple threads. All stmts of a batch go to the same queue and
+    // allocate from the arena of the batch, see ObLogEntryTask::get_next_stmt_allocator.
+    // The order of rows is kept by ObLogEntryTask::link_row_list, which is called by the thread
+    // that formats the last stmt.
+    const uint64_t base_hash_value = ATOMIC_FAA(&round_value_, 1);
     int64_t stmt_count = 0;
 
     while (OB_SUCC(ret) && NULL != stmt_task) {
       IStmtTask *next = stmt_task->get_next();
       void *push_task = static_cast<void *>(stmt_task);
+      const uint64_t hash_value = base_hash_value + log_entry_task.get_stmt_batch_idx(stmt_count);
 
       RETRY_FUNC(stop_flag, *(static_cast<ObMQThread *>(this)), push, push_task, hash_value, DATA_OP_TIMEOUT);
 
@@ -806,15 +816,15 @@ int ObLogFormatter::build_row_value_(
         LOG_ERROR("fill_rowkey_cols_ fail", KR(ret), K(rv), KPC(rowkey_cols),
             "stmt_task", *stmt_task, K(simple_table_schema));
       } else if (OB_FAIL(fill_orig_default_value_(rv, simple_table_schema, *tb_schema_info,
-              stmt_task->get_redo_log_entry_task().get_allocator()))) {
+              stmt_task->get_allocator()))) {
         LOG_ERROR("fill_orig_default_value_ fail", KR(ret), K(rv), K(simple_table_schema));
       } else {
         new_column_cnt = new_cols->num_;
         int64_t column_array_size = sizeof(binlogBuf) * column_num;
         binlogBuf *new_column_array =
-          static_cast<binlogBuf *>(stmt_task->get_redo_log_entry_task().alloc(column_array_size));
+          static_cast<binlogBuf *>(stmt_task->get_allocator().alloc(column_array_size));
         binlogBuf *old_column_array =
-          static_cast<binlogBuf *>(stmt_task->get_redo_log_entry_task().alloc(column_array_size));
+          static_cast<binlogBuf *>(stmt_task->get_allocator().alloc(column_array_size));
 
         if (OB_ISNULL(new_column_array) || OB_ISNULL(old_column_array)) {
           LOG_ERROR("allocate memory for column array fail", K(column_array_size), K(column_num));
@@ -1549,7 +1559,7 @@ int ObLogFormatter::init_dml_unique_id_(DmlStmtTask &stmt_task,
       LOG_ERROR("dml_stmt_unique_id is not valid", K(dml_stmt_unique_id));
       ret = OB_INVALID_ARGUMENT;
     } else {
-      common::ObIAllocator &allocator= log_entry_task.get_allocator();
+      common::ObIAllocator &allocator= stmt_task.get_allocator();
       const int64_t buf_len = dml_stmt_unique_id.get_dml_unique_id_length();
       char *buf = static_cast<char*>(allocator.alloc(buf_len));
       int64_t pos = 0;
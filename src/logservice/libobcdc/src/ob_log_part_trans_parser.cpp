@@ -274,13 +274,19 @@ int ObLogPartTransParser::parse_stmts_(
           // Deserialising row data
           void *mutator_row_buf = NULL;
           MutatorRow *row = NULL;
+          // the row of a DML stmt allocates from the arena of its formatter batch
+          common::ObIAllocator *row_allocator = NULL;
           if (is_ddl_trans) {
             mutator_row_buf = task.alloc(sizeof(MutatorRow));
+            row_allocator = &task.get_allocator();
+          } else if (OB_FAIL(redo_log_entry_task.get_next_stmt_allocator(row_allocator))) {
+            LOG_ERROR("get_next_stmt_allocator fail", KR(ret), K(redo_log_entry_task));
           } else {
             mutator_row_buf = redo_log_entry_task.alloc(sizeof(MutatorRow));
           }
 
-          if (OB_ISNULL(row = static_cast<MutatorRow *>(mutator_row_buf))) {
+          if (OB_FAIL(ret)) {
+          } else if (OB_ISNULL(row = static_cast<MutatorRow *>(mutator_row_buf))) {
             LOG_ERROR("alloc memory for MutatorRow fail", K(sizeof(MutatorRow)));
             ret = OB_ALLOCATE_MEMORY_FAILED;
           } else {
@@ -288,11 +294,7 @@ int ObLogPartTransParser::parse_stmts_(
             // FIXME: Destroy MutatorRow from regular channels and free memory
             // Currently destroyed in DmlStmtTask and DdlStmtTask, but no memory is freed
             // Since this memory is allocated by the Allocator of the PartTransTask, it is guaranteed not to leak
-            if (is_ddl_trans) {
-              new (row) MutatorRow(task.get_allocator());
-            } else {
-              new (row) MutatorRow(redo_log_entry_task.get_allocator());
-            }
+            new (row) MutatorRow(*row_allocator);
 
             // Deserialising row data
             if (OB_FAIL(row->deserialize(redo_data, redo_data_len, pos))) {
@@ -1657,7 +1657,9 @@ ObLogEntryTask::ObLogEntryTask() :
     stmt_list_(),
     formatted_stmt_num_(0),
     row_ref_cnt_(0),
-    arena_allocator_("LogEntryTask", OB_MALLOC_MIDDLE_BLOCK_SIZE)
+    arena_allocator_("LogEntryTask", OB_MALLOC_MIDDLE_BLOCK_SIZE),
+    stmt_batch_count_(1),
+    batch_allocators_()
 {
 }
 
@@ -1677,10 +1679,25 @@ void ObLogEntryTask::reset()
   stmt_list_.reset();
   formatted_stmt_num_ = 0;
   row_ref_cnt_ = 0;
+  stmt_batch_count_ = 1;
 
+  // batch arenas live in arena_allocator_, destroy them first
+  destroy_batch_allocators_();
   arena_allocator_.clear();
 }
 
+void ObLogEntryTask::destroy_batch_allocators_()
+{
+  for (int64_t idx = 0; idx < batch_allocators_.count(); ++idx) {
+    common::ObArenaAllocator *allocator = batch_allocators_.at(idx);
+
+    if (OB_NOT_NULL(allocator)) {
+      allocator->~ObArenaAllocator();
+    }
+  }
+  batch_allocators_.reset();
+}
+
 bool ObLogEntryTask::is_valid() const
 {
   bool bool_ret = false;
@@ -1707,6 +1724,8 @@ int ObLogEntryTask::init(
     participant_ = participant;
     trans_id_ = trans_id;
     redo_node_ = redo_node;
+    // read once, the parser and ObLogFormatter::push must agree on the batches
+    stmt_batch_count_ = TCONF.formatter_stmt_batch_count;
 
     LOG_DEBUG("LogEntryTask init", K(this), KPC(this));
   }
@@ -1813,6 +1832,42 @@ void ObLogEntryTask::free(void *ptr)
   ptr = NULL;
 }
 
+int ObLogEntryTask::get_next_stmt_allocator(common::ObIAllocator *&allocator)
+{
+  int ret = OB_SUCCESS;
+  const int64_t batch_idx = get_stmt_batch_idx(stmt_list_.num_);
+  allocator = NULL;
+
+  // the first batch shares arena_allocator_ with the parser, which is done with the
+  // task before the stmts are pushed to the formatter
+  while (OB_SUCC(ret) && batch_allocators_.count() < batch_idx) {
+    void *buf = arena_allocator_.alloc(sizeof(common::ObArenaAllocator));
+    common::ObArenaAllocator *batch_allocator = NULL;
+
+    if (OB_ISNULL(buf)) {
+      LOG_ERROR("alloc memory for batch allocator fail", K(batch_idx), KPC(this));
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+    } else {
+      batch_allocator = new (buf) common::ObArenaAllocator("LogEntryBatch", OB_MALLOC_NORMAL_BLOCK_SIZE);
+
+      if (OB_FAIL(batch_allocators_.push_back(batch_allocator))) {
+        LOG_ERROR("push back batch allocator fail", KR(ret), K(batch_idx), KPC(this));
+        batch_allocator->~ObArenaAllocator();
+      }
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    if (0 == batch_idx) {
+      allocator = &arena_allocator_;
+    } else {
+      allocator = batch_allocators_.at(batch_idx - 1);
+    }
+  }
+
+  return ret;
+}
+
 int ObLogEntryTask::rc_callback()
 {
   int ret = OB_SUCCESS;
@@ -232,6 +232,8 @@ public:
 
   ObLobDataOutRowCtxList &get_new_lob_ctx_cols() { return new_lob_ctx_cols_; }
 
+  common::ObIAllocator &get_allocator() { return allocator_; }
+
 public:
   TO_STRING_KV(
       "Row", static_cast<const memtable::ObMemtableMutatorRow &>(*this),
@@ -424,6 +426,8 @@ public:
   ObLobDataOutRowCtxList &get_new_lob_ctx_cols() { return row_.get_new_lob_ctx_cols(); }
 
   ObLogEntryTask &get_redo_log_entry_task() { return log_entry_task_; }
+  // allocator of the formatter batch of this stmt, see ObLogEntryTask::get_next_stmt_allocator
+  common::ObIAllocator &get_allocator() { return row_.get_allocator(); }
 
   int64_t get_row_seq_no() const { return row_.seq_no_; }
   // get row seq info for rollback to savepoint feature, use seq_no if cluster_version
@@ -645,6 +649,13 @@ public:
   void *alloc(const int64_t size);
   void free(void *ptr);
 
+  // Stmts are formatted in batches of stmt_batch_count_, all stmts of one batch are pushed to
+  // the same formatter queue. Each batch allocates from its own arena, so formatter threads
+  // never share an arena.
+  int64_t get_stmt_batch_idx(const int64_t stmt_idx) const { return stmt_idx / stmt_batch_count_; }
+  // Allocator of the batch that the next added stmt belongs to, called by the parser only
+  int get_next_stmt_allocator(common::ObIAllocator *&allocator);
+
   const DmlRedoLogNode *get_redo_log_node() const { return redo_node_; }
   int get_log_lsn(palf::LSN &log_lsn); // get redo log lsn: may not unique cause multi redo in one log_entry
   int get_data_len(int64_t &data_len);
@@ -678,10 +689,13 @@ public:
       KPC_(redo_node),
       K_(stmt_list),
       K_(formatted_stmt_num),
-      K_(row_ref_cnt));
+      K_(row_ref_cnt),
+      K_(stmt_batch_count),
+      "batch_allocator_cnt", batch_allocators_.count());
 
 private:
   int revert_binlog_record_(ObLogBR *br);
+  void destroy_batch_allocators_();
 
 private:
   void                   *host_;            // PartTransTask host
@@ -699,8 +713,11 @@ private:
   int64_t            row_ref_cnt_;          // reference count
 
   // Non-thread safe allocator
-  // used for Parser/Formatter
+  // used for Parser/Formatter, and by the stmts of the first batch
   common::ObArenaAllocator arena_allocator_;          // allocator
+  int64_t                stmt_batch_count_;           // stmt count of one formatter batch
+  // arenas of the stmt batches after the first one, allocated from arena_allocator_
+  common::ObSEArray<common::ObArenaAllocator *, 4> batch_allocators_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLogEntryTask);
@@ -32,6 +32,7 @@
 #include "palf/palf_env.h"
 #include "palf/palf_callback.h"
 #include "palf/palf_options.h"
+#include "lib/compress/ob_compressor_pool.h"
 
 namespace oceanbase
 {
@@ -506,6 +507,26 @@ int ObLogService::update_log_disk_util_threshold(const int64_t log_disk_utilizat
   return ret;
 }
 
+int ObLogService::update_log_transport_compress_options(const bool enable_transport_compress,
+                                                        const ObString &compress_func_name)
+{
+  int ret = OB_SUCCESS;
+  PalfTransportCompressOptions compress_opt;
+  compress_opt.enable_transport_compress_ = enable_transport_compress;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (enable_transport_compress
+      && OB_FAIL(ObCompressorPool::get_instance().get_compressor_type(compress_func_name,
+          compress_opt.transport_compress_func_))) {
+    CLOG_LOG(WARN, "get_compressor_type failed", K(ret), K(compress_func_name));
+  } else if (OB_FAIL(palf_env_->update_transport_compress_options(compress_opt))) {
+    CLOG_LOG(WARN, "update_transport_compress_options failed", K(ret), K(compress_opt));
+  } else {
+    CLOG_LOG(TRACE, "update_log_transport_compress_options success", K(compress_opt), K(MTL_ID()));
+  }
+  return ret;
+}
+
 int ObLogService::update_log_disk_usage_limit_size(const int64_t log_disk_usage_limit_size)
 {
   int ret = OB_SUCCESS;
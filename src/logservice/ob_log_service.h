@@ -177,6 +177,9 @@ public:
   // }.
   int update_log_disk_util_threshold(const int64_t log_disk_usage_threshold, const int64_t log_disk_usage_limit_threshold);
   int update_log_disk_usage_limit_size(const int64_t log_disk_usage_limit_size);
+  // @param[in] compress_func_name, the name of compressor, such as lz4_1.0 and zstd_1.3.8
+  int update_log_transport_compress_options(const bool enable_transport_compress,
+                                            const common::ObString &compress_func_name);
   int get_palf_disk_options(palf::PalfDiskOptions &options);
   int iterate_palf(const ObFunction<int(const palf::PalfHandle&)> &func);
   int iterate_apply(const ObFunction<int(const ObApplyStatus&)> &func);
@@ -54,5 +54,24 @@ void LogRpc::destroy()
     PALF_LOG(INFO, "LogRpc destroy success");
   }
 }
+
+int LogRpc::update_transport_compress_options(const PalfTransportCompressOptions &compress_opt)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (false == compress_opt.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(compress_opt));
+  } else {
+    const ObCompressorType type = compress_opt.enable_transport_compress_ ?
+        compress_opt.transport_compress_func_ : INVALID_COMPRESSOR;
+    if (type != rpc_proxy_.get_transport_compressor_type()) {
+      rpc_proxy_.set_transport_compressor_type(type);
+      PALF_LOG(INFO, "update_transport_compress_options success", K(compress_opt));
+    }
+  }
+  return ret;
+}
 } // end namespace palf
 } // end namespace oceanbase
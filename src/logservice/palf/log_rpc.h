@@ -21,6 +21,7 @@
 #include "log_rpc_macros.h"                        // MACROS...
 #include "log_rpc_packet.h"                        // LogRpcPacketImpl
 #include "log_rpc_proxy.h"                         // LogRpcProxyV2
+#include "palf_options.h"                          // PalfTransportCompressOptions
 #include "share/resource_manager/ob_cgroup_ctrl.h"
 
 namespace oceanbase
@@ -72,6 +73,7 @@ public:
   ~LogRpc();
   int init(const common::ObAddr &self, rpc::frame::ObReqTransport *transport);
   void destroy();
+  int update_transport_compress_options(const PalfTransportCompressOptions &compress_opt);
   template<class ReqType>
   int post_request(const common::ObAddr &server,
                    const int64_t palf_id,
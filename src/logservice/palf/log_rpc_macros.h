@@ -67,6 +67,23 @@
               .post_packet(pkt, &cb);                                                                         \
     return ret;                                                                                               \
   }
+// log data is compressed by rpc framework if transport compression is enabled
+#define DEFINE_RPC_PROXY_COMPRESSED_POST_FUNCTION(REQTYPE, PCODE)                                             \
+  int LogRpcProxyV2::post_packet(const common::ObAddr &dst, const palf::LogRpcPacketImpl<palf::REQTYPE> &pkt, \
+                                 const int64_t tenant_id)                                                     \
+  {                                                                                                           \
+    int ret = common::OB_SUCCESS;                                                                             \
+    static obrpc::LogRpcCB<obrpc::PCODE> cb;                                                                  \
+    ret = this->to(dst)                                                                                       \
+              .timeout(3000 * 1000)                                                                           \
+              .trace_time(true)                                                                               \
+              .max_process_handler_time(100 * 1000)                                                           \
+              .by(tenant_id)                                                                                  \
+              .group_id(share::OBCG_CLOG)                                                                     \
+              .compressed(get_transport_compressor_type())                                                    \
+              .post_packet(pkt, &cb);                                                                         \
+    return ret;                                                                                               \
+  }
 // ELECTION use unique message queue
 #define DEFINE_RPC_PROXY_ELECTION_POST_FUNCTION(REQTYPE, PCODE)                                               \
   int LogRpcProxyV2::post_packet(const common::ObAddr &dst, const palf::LogRpcPacketImpl<palf::REQTYPE> &pkt, \
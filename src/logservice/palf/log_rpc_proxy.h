@@ -30,7 +30,14 @@ class LogRpcProxyV2 : public obrpc::ObRpcProxy
 {
 public:
   DEFINE_TO(LogRpcProxyV2);
+  LogRpcProxyV2() : ObRpcProxy(), transport_compressor_type_(common::INVALID_COMPRESSOR) {}
   void set_group_id(int32_t group_id);
+  // only LogPushReq(push log and fetch log) is compressed, other messages are too small to benefit.
+  // updated by the config refresh while the log rpcs read it
+  void set_transport_compressor_type(const common::ObCompressorType type)
+  { ATOMIC_STORE(&transport_compressor_type_, type); }
+  common::ObCompressorType get_transport_compressor_type() const
+  { return ATOMIC_LOAD(&transport_compressor_type_); }
   DECLARE_RPC_PROXY_POST_FUNCTION(PR3,
                                   LogPushReq,
                                   OB_LOG_PUSH_REQ);
@@ -94,6 +101,8 @@ public:
                                       LogGetMCStReq,
                                       LogGetMCStResp,
                                       OB_LOG_GET_MC_ST);
+private:
+  common::ObCompressorType transport_compressor_type_;
 };
 } // end namespace obrpc
 } // end namespace oceanbase
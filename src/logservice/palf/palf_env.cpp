@@ -182,6 +182,11 @@ int PalfEnv::update_disk_options(const PalfDiskOptions &disk_options)
   return palf_env_impl_.update_disk_options(disk_options);
 }
 
+int PalfEnv::update_transport_compress_options(const PalfTransportCompressOptions &compress_opt)
+{
+  return palf_env_impl_.update_transport_compress_options(compress_opt);
+}
+
 // @brief get current palf disk options
 bool PalfEnv::check_disk_space_enough()
 {
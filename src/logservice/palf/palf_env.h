@@ -103,6 +103,9 @@ public:
   // @brief get current palf disk options
   // @param [out] options
   int get_disk_options(PalfDiskOptions &options);
+  // @brief update compression options of log transport
+  // @param [in] compress_opt
+  int update_transport_compress_options(const PalfTransportCompressOptions &compress_opt);
 
   // @brief check the disk space used to palf whether is enough
   bool check_disk_space_enough();
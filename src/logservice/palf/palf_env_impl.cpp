@@ -813,6 +813,17 @@ int PalfEnvImpl::update_disk_options(const PalfDiskOptions &disk_options)
   return ret;
 }
 
+int PalfEnvImpl::update_transport_compress_options(const PalfTransportCompressOptions &compress_opt)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(log_rpc_.update_transport_compress_options(compress_opt))) {
+    PALF_LOG(WARN, "update_transport_compress_options failed", K(ret), K(compress_opt));
+  }
+  return ret;
+}
+
 int PalfEnvImpl::get_disk_options(PalfDiskOptions &disk_options)
 {
   int ret = OB_SUCCESS;
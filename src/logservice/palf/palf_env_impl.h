@@ -214,6 +214,7 @@ public:
   int get_disk_usage(int64_t &used_size_byte, int64_t &total_usable_size_byte);
   int update_disk_options(const PalfDiskOptions &disk_options);
   int get_disk_options(PalfDiskOptions &disk_options);
+  int update_transport_compress_options(const PalfTransportCompressOptions &compress_opt);
   int for_each(const common::ObFunction<int(const PalfHandle&)> &func);
   common::ObILogAllocator* get_log_allocator();
   TO_STRING_KV(K_(self), K_(log_dir), K_(disk_options_wrapper));
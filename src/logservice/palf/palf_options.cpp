@@ -38,5 +38,18 @@ bool PalfDiskOptions::operator==(const PalfDiskOptions &palf_disk_options) const
     && log_disk_utilization_threshold_ == palf_disk_options.log_disk_utilization_threshold_
     && log_disk_utilization_limit_threshold_ == palf_disk_options.log_disk_utilization_limit_threshold_;
 }
+
+void PalfTransportCompressOptions::reset()
+{
+  enable_transport_compress_ = false;
+  transport_compress_func_ = common::INVALID_COMPRESSOR;
+}
+
+bool PalfTransportCompressOptions::is_valid() const
+{
+  return !enable_transport_compress_
+    || (common::INVALID_COMPRESSOR < transport_compress_func_
+        && common::MAX_COMPRESSOR > transport_compress_func_);
+}
 }
 }
@@ -13,6 +13,7 @@
 #ifndef OCEANBASE_LOGSERVICE_PALF_OPTIONS_
 #define OCEANBASE_LOGSERVICE_PALF_OPTIONS_
 #include "share/ob_partition_modify.h"
+#include "lib/compress/ob_compress_util.h"
 #include <stdint.h>
 namespace oceanbase
 {
@@ -44,6 +45,20 @@ struct PalfDiskOptions
       log_disk_utilization_limit_threshold_);
 };
 
+// Compression of log transport, only the log entries carried by rpc (push log/fetch log) are
+// compressed, the on-disk format of log is not affected
+struct PalfTransportCompressOptions
+{
+  PalfTransportCompressOptions() : enable_transport_compress_(false),
+                                   transport_compress_func_(common::INVALID_COMPRESSOR)
+  {}
+  ~PalfTransportCompressOptions() { reset(); }
+  void reset();
+  bool is_valid() const;
+  bool enable_transport_compress_;
+  common::ObCompressorType transport_compress_func_;
+  TO_STRING_KV(K_(enable_transport_compress), K_(transport_compress_func));
+};
 
 struct PalfAppendOptions
 {
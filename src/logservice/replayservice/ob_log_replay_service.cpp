@@ -152,6 +152,9 @@ void ReplayProcessStat::runTimerTask()
                 "pending_replay_log_size(MB)", pending_replay_log_size_MB);
     }
   }
+  if (NULL != rp_sv_ && OB_FAIL(rp_sv_->stat_all_ls_replay_throughput())) {
+    CLOG_LOG(WARN, "stat_all_ls_replay_throughput failed", K(ret));
+  }
 }
 
 //---------------ObLogReplayService---------------//
@@ -674,6 +677,19 @@ int ObLogReplayService::stat_all_ls_replay_process(int64_t &replayed_log_size,
   return ret;
 }
 
+int ObLogReplayService::stat_all_ls_replay_throughput()
+{
+  int ret = OB_SUCCESS;
+  StatReplayThroughputFunctor functor(ObTimeUtility::current_time());
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    CLOG_LOG(WARN, "replay service not inited", K(ret));
+  } else if (OB_FAIL(replay_status_map_.for_each(functor))) {
+    CLOG_LOG(WARN, "failed to stat replay throughput", K(ret));
+  }
+  return ret;
+}
+
 void ObLogReplayService::inc_pending_task_size(const int64_t log_size)
 {
   ATOMIC_AAF(&pending_replay_log_size_, log_size);
@@ -1277,6 +1293,7 @@ int ObLogReplayService::handle_replay_task_(ObReplayServiceReplayTask *task_queu
           if (!replay_task->is_pre_barrier_) {
             //前向barrier日志执行回放的线程会提前释放内存
             replay_status->dec_pending_task(replay_task->log_size_);
+            replay_status->inc_replayed_task(replay_task->log_size_);
           }
           free_replay_task(replay_task_to_destroy);
           //To avoid a single task occupies too long thread time, the upper limit of
@@ -1475,5 +1492,18 @@ bool ObLogReplayService::StatReplayProcessFunctor::operator()(const share::ObLSI
   return true;
 }
 
+bool ObLogReplayService::StatReplayThroughputFunctor::operator()(const share::ObLSID &id,
+                                                                 ObReplayStatus *replay_status)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(replay_status)) {
+    ret = OB_ERR_UNEXPECTED;
+    CLOG_LOG(WARN, "replay status is NULL", K(id), KR(ret));
+  } else {
+    replay_status->stat_replay_throughput(cur_ts_);
+  }
+  return true;
+}
+
 } // namespace replayService
 } // namespace oceanbase
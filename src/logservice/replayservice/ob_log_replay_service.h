@@ -113,6 +113,17 @@ public:
     int64_t replayed_log_size_;
     int64_t unreplayed_log_size_;
   };
+  class StatReplayThroughputFunctor
+  {
+  public:
+    explicit StatReplayThroughputFunctor(const int64_t cur_ts)
+        : cur_ts_(cur_ts) {}
+    ~StatReplayThroughputFunctor(){}
+    bool operator()(const share::ObLSID &id, ObReplayStatus *replay_status);
+    TO_STRING_KV(K(cur_ts_));
+  private:
+    int64_t cur_ts_;
+  };
 public:
   void handle(void *task);
   int add_ls(const share::ObLSID &id,
@@ -137,6 +148,7 @@ public:
   int update_replayable_point(const int64_t replayable_ts_ns);
   int stat_for_each(const common::ObFunction<int (const ObReplayStatus &)> &func);
   int stat_all_ls_replay_process(int64_t &replayed_log_size, int64_t &unreplayed_log_size);
+  int stat_all_ls_replay_throughput();
   void inc_pending_task_size(const int64_t log_size);
   void dec_pending_task_size(const int64_t log_size);
   int64_t get_pending_task_size() const;
@@ -548,6 +548,10 @@ ObReplayStatus::ObReplayStatus():
     post_barrier_lsn_(),
     err_info_(),
     pending_task_count_(0),
+    replayed_task_count_(0),
+    replayed_log_size_(0),
+    last_stat_ts_(OB_INVALID_TIMESTAMP),
+    last_stat_replayed_log_size_(0),
     last_check_memstore_lsn_(),
     rwlock_(),
     spinlock_(),
@@ -633,6 +637,10 @@ void ObReplayStatus::destroy()
     err_info_.reset();
     last_check_memstore_lsn_.reset();
     pending_task_count_ = 0;
+    replayed_task_count_ = 0;
+    replayed_log_size_ = 0;
+    last_stat_ts_ = OB_INVALID_TIMESTAMP;
+    last_stat_replayed_log_size_ = 0;
     fs_cb_.destroy();
     get_log_info_debug_time_ = OB_INVALID_TIMESTAMP;
     try_wrlock_debug_time_ = OB_INVALID_TIMESTAMP;
@@ -1099,6 +1107,12 @@ void ObReplayStatus::dec_pending_task(const int64_t log_size)
   }
 }
 
+void ObReplayStatus::inc_replayed_task(const int64_t log_size)
+{
+  ATOMIC_INC(&replayed_task_count_);
+  ATOMIC_AAF(&replayed_log_size_, log_size);
+}
+
 void ObReplayStatus::free_replay_task(ObLogReplayTask *task)
 {
   rp_sv_->free_replay_task(task);
@@ -1243,6 +1257,9 @@ int ObReplayStatus::stat(LSReplayStat &stat) const
     stat.role_ = role_;
     stat.enabled_ = is_enabled_;
     stat.pending_cnt_ = pending_task_count_;
+    stat.replayed_task_cnt_ = ATOMIC_LOAD(&replayed_task_count_);
+    stat.replayed_log_size_ = ATOMIC_LOAD(&replayed_log_size_);
+    stat_queue_skew_(stat);
     if (OB_FAIL(submit_log_task_.get_next_to_submit_log_info(stat.unsubmitted_lsn_,
                                                              stat.unsubmitted_log_ts_ns_))) {
       CLOG_LOG(WARN, "get_next_to_submit_log_info failed", KPC(this), K(ret));
@@ -1253,5 +1270,46 @@ int ObReplayStatus::stat(LSReplayStat &stat) const
   return ret;
 }
 
+void ObReplayStatus::stat_queue_skew_(LSReplayStat &stat) const
+{
+  stat.max_queue_pending_cnt_ = 0;
+  stat.max_pending_queue_idx_ = -1;
+  stat.active_queue_cnt_ = 0;
+  for (int64_t i = 0; i < REPLAY_TASK_QUEUE_SIZE; ++i) {
+    const int64_t queue_pending_cnt = task_queues_[i].get_pending_cnt();
+    if (queue_pending_cnt > 0) {
+      stat.active_queue_cnt_++;
+      if (queue_pending_cnt > stat.max_queue_pending_cnt_) {
+        stat.max_queue_pending_cnt_ = queue_pending_cnt;
+        stat.max_pending_queue_idx_ = i;
+      }
+    }
+  }
+}
+
+void ObReplayStatus::stat_replay_throughput(const int64_t cur_ts)
+{
+  const int64_t replayed_log_size = ATOMIC_LOAD(&replayed_log_size_);
+  const int64_t pending_cnt = ATOMIC_LOAD(&pending_task_count_);
+  if (OB_INVALID_TIMESTAMP != last_stat_ts_ && cur_ts > last_stat_ts_
+      && (replayed_log_size > last_stat_replayed_log_size_ || 0 < pending_cnt)) {
+    LSReplayStat stat;
+    stat_queue_skew_(stat);
+    const int64_t round_replayed_log_size = replayed_log_size - last_stat_replayed_log_size_;
+    // bytes per second
+    const int64_t replay_throughput = round_replayed_log_size * 1000000 / (cur_ts - last_stat_ts_);
+    // 100 means pending tasks are evenly distributed among active queues
+    const int64_t queue_skew = (0 == pending_cnt) ? 0 :
+        stat.max_queue_pending_cnt_ * stat.active_queue_cnt_ * 100 / pending_cnt;
+    CLOG_LOG(INFO, "dump ls replay throughput", K(ls_id_), K(replay_throughput),
+             K(round_replayed_log_size), "replayed_task_cnt", ATOMIC_LOAD(&replayed_task_count_),
+             K(pending_cnt), "active_queue_cnt", stat.active_queue_cnt_,
+             "max_queue_pending_cnt", stat.max_queue_pending_cnt_,
+             "max_pending_queue_idx", stat.max_pending_queue_idx_, K(queue_skew));
+  }
+  last_stat_ts_ = cur_ts;
+  last_stat_replayed_log_size_ = replayed_log_size;
+}
+
 } // namespace logservice
 }
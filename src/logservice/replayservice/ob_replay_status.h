@@ -65,6 +65,13 @@ struct LSReplayStat
   palf::LSN unsubmitted_lsn_;
   int64_t unsubmitted_log_ts_ns_;
   int64_t pending_cnt_;
+  int64_t replayed_task_cnt_;
+  int64_t replayed_log_size_;
+  // pending task count of the most loaded replay queue, skew of queues is
+  // max_queue_pending_cnt_ / (pending_cnt_ / active_queue_cnt_)
+  int64_t max_queue_pending_cnt_;
+  int64_t max_pending_queue_idx_;
+  int64_t active_queue_cnt_;
 
   TO_STRING_KV(K(ls_id_),
                K(role_),
@@ -72,7 +79,12 @@ struct LSReplayStat
                K(enabled_),
                K(unsubmitted_lsn_),
                K(unsubmitted_log_ts_ns_),
-               K(pending_cnt_));
+               K(pending_cnt_),
+               K(replayed_task_cnt_),
+               K(replayed_log_size_),
+               K(max_queue_pending_cnt_),
+               K(max_pending_queue_idx_),
+               K(active_queue_cnt_));
 };
 
 //此类型为前向barrier日志专用, 与ObLogReplayTask分开分配
@@ -343,6 +355,7 @@ public:
   {
     type_ = ObReplayServiceTaskType::REPLAY_LOG_TASK;
     idx_ = -1;
+    pending_cnt_ = 0;
   }
   ~ObReplayServiceReplayTask() { destroy(); }
   // use base_log_ts init min_unreplayed_log_ts;
@@ -363,19 +376,30 @@ public:
   }
   void push(Link *p)
   {
+    ATOMIC_INC(&pending_cnt_);
     queue_.push(p);
   }
+  int64_t get_pending_cnt() const
+  {
+    return ATOMIC_LOAD(&pending_cnt_);
+  }
   int get_min_unreplayed_log_info(palf::LSN &lsn,
                                   int64_t &log_ts,
                                   bool &is_queue_empty);
 private:
   Link *pop_()
   {
-    return queue_.pop();
+    Link *p = queue_.pop();
+    if (NULL != p) {
+      ATOMIC_DEC(&pending_cnt_);
+    }
+    return p;
   }
 private:
   common::ObSpScLinkQueue queue_;   //place ObLogReplayTask
   int64_t idx_; //热点行优化
+  // used for statistics of queue skew
+  int64_t pending_cnt_;
 };
 
 class ObReplayFsCb : public palf::PalfFSCb
@@ -485,6 +509,7 @@ public:
   int push_log_replay_task(ObLogReplayTask &task);
   void inc_pending_task(const int64_t log_size);
   void dec_pending_task(const int64_t log_size);
+  void inc_replayed_task(const int64_t log_size);
   //通用的replay task释放内存接口, 前向barrier的任务不会单独释放log buf内存
   //前向barrier完整释放申请的内存需要同时调用
   //free_replay_task_log_buf()和free_replay_task()
@@ -508,6 +533,8 @@ public:
   void set_post_barrier_submitted(const palf::LSN &lsn);
   int set_post_barrier_finished(const palf::LSN &lsn);
   int stat(LSReplayStat &stat) const;
+  // print replay throughput and queue skew since last round, called by ReplayProcessStat
+  void stat_replay_throughput(const int64_t cur_ts);
 
   inline void inc_ref()
   {
@@ -545,6 +572,8 @@ public:
                K(ref_cnt_),
                K(post_barrier_lsn_),
                K(pending_task_count_),
+               K(replayed_task_count_),
+               K(replayed_log_size_),
                K(submit_log_task_));
 
 private:
@@ -557,6 +586,7 @@ private:
   // 注销回调并清空任务
   int disable_();
   bool is_replay_enabled_() const;
+  void stat_queue_skew_(LSReplayStat &stat) const;
 private:
   static const int64_t PENDING_COUNT_THRESHOLD = 100;
   static const int64_t EAGAIN_COUNT_THRESHOLD = 50000;
@@ -580,6 +610,11 @@ private:
   // record error info, reported when handle submit or replay type task
   LSErrInfo err_info_;
   int64_t pending_task_count_;
+  int64_t replayed_task_count_;
+  int64_t replayed_log_size_;
+  // replayed log size and timestamp of last round of stat_replay_throughput
+  int64_t last_stat_ts_;
+  int64_t last_stat_replayed_log_size_;
   palf::LSN last_check_memstore_lsn_;
   // protect is_enabled_ and submit_log_task_
   // 回放一条日志时会一直持有读锁直到回放完成
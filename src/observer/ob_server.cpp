@@ -1507,6 +1507,8 @@ int ObServer::init_io()
       }
       io_config.disk_io_thread_count_ = GCONF.disk_io_thread_count;
       const int64_t max_io_depth = 256;
+      const ObAsyncIOEngine io_engine = !GCONF._enable_io_uring ? ASYNC_IO_LIBAIO
+          : (GCONF._enable_io_uring_sqpoll ? ASYNC_IO_URING_SQPOLL : ASYNC_IO_URING);
       ObTenantIOConfig server_tenant_io_config = ObTenantIOConfig::default_instance();
       if (OB_FAIL(ObIOManager::get_instance().set_io_config(io_config))) {
         LOG_ERROR("config io manager fail, ", KR(ret));
@@ -1585,7 +1587,8 @@ int ObServer::init_io()
           } else if (OB_FAIL(ObIOManager::get_instance().add_device_channel(THE_IO_DEVICE,
                                                                             io_config.disk_io_thread_count_,
                                                                             io_config.disk_io_thread_count_ / 2,
-                                                                            max_io_depth))) {
+                                                                            max_io_depth,
+                                                                            io_engine))) {
             LOG_ERROR("add device channel failed", KR(ret));
           } else if (OB_FAIL(ObIOManager::get_instance().add_tenant_io_manager(OB_SERVER_TENANT_ID,
                                                                                server_tenant_io_config))) {
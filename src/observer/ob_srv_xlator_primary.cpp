@@ -202,6 +202,7 @@ void oceanbase::observer::init_srv_xlator_for_executor(ObSrvRpcXlator *xlator) {
   RPC_PROCESSOR(ObRpcLoadDataInsertTaskExecuteP, gctx_);
   RPC_PROCESSOR(ObRpcRemoteSyncExecuteP, gctx_);
   RPC_PROCESSOR(ObDASSyncAccessP, gctx_);
+  RPC_PROCESSOR(ObDASAsyncAccessP, gctx_);
   RPC_PROCESSOR(ObDASSyncFetchP);
   RPC_PROCESSOR(ObDASAsyncEraseP);
   RPC_PROCESSOR(ObRpcEraseIntermResultP, gctx_);
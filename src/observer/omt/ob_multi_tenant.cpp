@@ -942,6 +942,9 @@ int ObMultiTenant::update_tenant_config(uint64_t tenant_id)
       if (OB_SUCCESS != (tmp_ret = update_palf_disk_config(tenant_config))) {
         LOG_WARN("failed to update palf disk config", K(tmp_ret), K(tenant_id));
       }
+      if (OB_SUCCESS != (tmp_ret = update_palf_transport_config(tenant_config))) {
+        LOG_WARN("failed to update palf transport config", K(tmp_ret), K(tenant_id));
+      }
       if (OB_SUCCESS != (tmp_ret = update_tenant_dag_scheduler_config())) {
         LOG_WARN("failed to update tenant dag scheduler config", K(tmp_ret), K(tenant_id));
       }
@@ -965,6 +968,20 @@ int ObMultiTenant::update_palf_disk_config(ObTenantConfigGuard &tenant_config)
   return ret;
 }
 
+int ObMultiTenant::update_palf_transport_config(ObTenantConfigGuard &tenant_config)
+{
+  int ret = OB_SUCCESS;
+  ObLogService *log_service = MTL(ObLogService *);
+  if (NULL == log_service) {
+    ret = OB_ERR_UNEXPECTED;
+  } else {
+    ret = log_service->update_log_transport_compress_options(
+        tenant_config->log_transport_compress_all,
+        tenant_config->log_transport_compress_func.str());
+  }
+  return ret;
+}
+
 int ObMultiTenant::update_tenant_dag_scheduler_config()
 {
   int ret = OB_SUCCESS;
@@ -120,6 +120,7 @@ public:
   int modify_tenant_io(const uint64_t tenant_id, const share::ObUnitConfig &unit_config);
   int update_tenant_config(uint64_t tenant_id);
   int update_palf_disk_config(ObTenantConfigGuard &tenant_config);
+  int update_palf_transport_config(ObTenantConfigGuard &tenant_config);
   int update_tenant_dag_scheduler_config();
   int get_tenant(const uint64_t tenant_id, ObTenant *&tenant) const;
   int get_tenant_with_tenant_lock(const uint64_t tenant_id, common::ObLDHandle &handle, ObTenant *&tenant) const;
@@ -293,21 +293,35 @@ void ObResourceGroup::calibrate_token_count()
       OB_SUCC(workers_lock_.trylock())) {
     int64_t wait_worker = 0;
     int64_t active_workers = 0;
+    int64_t blocking_workers = 0;
+    int64_t stalled_workers = 0;
     DLIST_FOREACH_REMOVESAFE(wnode, workers_) {
       const auto w = static_cast<ObThWorker*>(wnode->get_data());
+      const bool is_stalled = w->is_cpu_stalled(current_time);
       if (w->is_active()) {
         active_workers++;
         if (!w->has_req_flag()) {
           wait_worker++;
+        } else if (w->is_blocking()) {
+          blocking_workers++;
+        } else if (is_stalled) {
+          stalled_workers++;
         }
       }
     }
+    const int64_t running_workers = active_workers - wait_worker - blocking_workers;
     if (static_cast<int64_t>(ceil(tenant_->unit_min_cpu())) != min_token_cnt_) { // If the user manually adjusts the tenant specifications, the dynamic token adjustment alone cannot respond quickly, and it needs to be adjusted forcibly
       set_token_cnt(static_cast<int64_t>(ceil(tenant_->unit_min_cpu())));
       set_min_token_cnt(token_cnt_);
     }
+    // no request popped, but if running workers have used up the cpu
+    // quota, more workers only add context switches. The running workers
+    // can't be trusted when some of them are blocked in a wait that isn't
+    // reported by sched_wait, grow as before then.
     if (last_pop_req_cnt_ != 0 && pop_req_cnt_ == last_pop_req_cnt_
-        && token_cnt_ == ass_token_cnt_) {
+        && token_cnt_ == ass_token_cnt_
+        && (stalled_workers > 0
+            || running_workers < static_cast<int64_t>(ceil(tenant_->unit_max_cpu())))) {
       set_token_cnt(min(token_cnt_ + 1, max_token_cnt_));
     }
     if (wait_worker > active_workers / 2) {
@@ -1292,16 +1306,30 @@ void ObTenant::calibrate_token_count()
           OB_SUCC(workers_lock_.trylock())) {
       int64_t wait_worker = 0;
       int64_t active_workers = 0;
+      int64_t blocking_workers = 0;
+      int64_t stalled_workers = 0;
       DLIST_FOREACH_REMOVESAFE(wnode, workers_) {
         const auto w = static_cast<ObThWorker*>(wnode->get_data());
+        const bool is_stalled = w->is_cpu_stalled(current_time);
         if (w->is_active()) {
           active_workers++;
           if (!w->has_req_flag()) {
             wait_worker++;
+          } else if (w->is_blocking()) {
+            blocking_workers++;
+          } else if (is_stalled) {
+            stalled_workers++;
           }
         }
       }
-      if (last_pop_normal_cnt_ != 0 && pop_normal_cnt_ == last_pop_normal_cnt_) {
+      const int64_t running_workers = active_workers - wait_worker - blocking_workers;
+      // no request popped, but if running workers have used up the cpu
+      // quota, more workers only add context switches. The running workers
+      // can't be trusted when some of them are blocked in a wait that isn't
+      // reported by sched_wait, grow as before then.
+      if (last_pop_normal_cnt_ != 0 && pop_normal_cnt_ == last_pop_normal_cnt_
+          && (stalled_workers > 0
+              || running_workers < static_cast<int64_t>(ceil(unit_max_cpu())))) {
         set_token(min(token_cnt_ + 1, worker_count_bound()));
       }
       if (wait_worker > active_workers / 2) {
@@ -52,7 +52,9 @@ ObThWorker::ObThWorker()
       query_start_time_(0), last_check_time_(0),
       can_retry_(true), need_retry_(false),
       active_(false), waiting_active_(false),
-      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false)
+      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false),
+      blocking_ts_(0), has_cpu_clock_(false), cpu_clock_id_(),
+      last_cpu_time_(0), last_cpu_sample_ts_(0)
 {
 }
 
@@ -332,6 +334,7 @@ inline void ObThWorker::process_request(rpc::ObRequest &req)
             get_allocator().used(),
             pm_hold);
   }
+  ATOMIC_STORE(&blocking_ts_, 0);
   set_req_flag(false);
 }
 
@@ -510,6 +513,7 @@ int ObThWorker::check_large_query_quota()
 
 void ObThWorker::th_created()
 {
+  init_cpu_clock();
   procor_.th_created();
 }
 
@@ -518,6 +522,39 @@ void ObThWorker::th_destroy()
   procor_.th_destroy();
 }
 
+bool ObThWorker::sched_wait()
+{
+  ATOMIC_STORE(&blocking_ts_, ObTimeUtility::fast_current_time());
+  return true;
+}
+
+void ObThWorker::init_cpu_clock()
+{
+  has_cpu_clock_ = (0 == pthread_getcpuclockid(pthread_self(), &cpu_clock_id_));
+}
+
+bool ObThWorker::is_cpu_stalled(const int64_t now)
+{
+  bool stalled = false;
+  struct timespec ts;
+  if (has_cpu_clock_ && 0 == clock_gettime(cpu_clock_id_, &ts)) {
+    const int64_t cpu_time = ts.tv_sec * 1000000L + ts.tv_nsec / 1000;
+    // less than half a cpu since the last sample
+    if (0 != last_cpu_sample_ts_ && now > last_cpu_sample_ts_) {
+      stalled = (cpu_time - last_cpu_time_) * 2 < now - last_cpu_sample_ts_;
+    }
+    last_cpu_time_ = cpu_time;
+    last_cpu_sample_ts_ = now;
+  }
+  return stalled;
+}
+
+bool ObThWorker::sched_run(int64_t waittime)
+{
+  ATOMIC_STORE(&blocking_ts_, 0);
+  return Worker::sched_run(waittime);
+}
+
 int ObThWorker::check_status()
 {
   int ret = OB_SUCCESS;
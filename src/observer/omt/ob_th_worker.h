@@ -71,6 +71,18 @@ public:
   virtual int check_status() override;
   virtual int check_large_query_quota();
 
+  // blocking relating, a worker between sched_wait and sched_run is
+  // waiting for rpc or trans result and doesn't consume cpu
+  virtual bool sched_wait() override;
+  virtual bool sched_run(int64_t waittime=0) override;
+  bool is_blocking() const { return 0 != ATOMIC_LOAD(&blocking_ts_); }
+  int64_t get_blocking_ts() const { return ATOMIC_LOAD(&blocking_ts_); }
+  // Not all the waits go through sched_wait, px dtl, latches and inner sql
+  // don't. A worker blocked in them gets little cpu time, which tells it from
+  // a running one. Only called by token calibration under the workers lock.
+  void init_cpu_clock();
+  bool is_cpu_stalled(const int64_t now);
+
   // retry relating
   virtual bool can_retry() const;
   virtual void set_need_retry();
@@ -142,6 +154,13 @@ private:
   int64_t active_inactive_ts_;
   bool lq_token_;
   bool has_add_to_cgroup_;
+  // Timestamp when current worker begins to block, 0 if it's running.
+  int64_t blocking_ts_;
+  // cpu clock of the worker thread and its last sample
+  bool has_cpu_clock_;
+  clockid_t cpu_clock_id_;
+  int64_t last_cpu_time_;
+  int64_t last_cpu_sample_ts_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObThWorker);
@@ -161,6 +180,9 @@ inline void ObThWorker::reset()
   need_retry_ = false;
   active_ = false;
   has_add_to_cgroup_ = false;
+  blocking_ts_ = 0;
+  last_cpu_time_ = 0;
+  last_cpu_sample_ts_ = 0;
   unset_tidx();
 }
 
@@ -122,6 +122,21 @@ int ObAllVirtualReplayStat::insert_stat_(logservice::LSReplayStat &replay_stat)
       case OB_APP_MIN_COLUMN_ID + 9:
         cur_row_.cells_[i].set_int(replay_stat.pending_cnt_);
         break;
+      case OB_APP_MIN_COLUMN_ID + 10:
+        cur_row_.cells_[i].set_int(replay_stat.replayed_task_cnt_);
+        break;
+      case OB_APP_MIN_COLUMN_ID + 11:
+        cur_row_.cells_[i].set_int(replay_stat.replayed_log_size_);
+        break;
+      case OB_APP_MIN_COLUMN_ID + 12:
+        cur_row_.cells_[i].set_int(replay_stat.max_queue_pending_cnt_);
+        break;
+      case OB_APP_MIN_COLUMN_ID + 13:
+        cur_row_.cells_[i].set_int(replay_stat.max_pending_queue_idx_);
+        break;
+      case OB_APP_MIN_COLUMN_ID + 14:
+        cur_row_.cells_[i].set_int(replay_stat.active_queue_cnt_);
+        break;
       default:
         ret = OB_ERR_UNEXPECTED;
         SERVER_LOG(WARN, "unkown column");
@@ -451,6 +451,24 @@ int ObKVGlobalCache::get(
   return ret;
 }
 
+int ObKVGlobalCache::multi_get(
+  const int64_t cache_id,
+  const int64_t count,
+  const ObIKVCacheKey *const *keys,
+  const ObIKVCacheValue **pvalues,
+  ObKVMemBlockHandle **mb_handles,
+  int *rets)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
+  } else if (OB_FAIL(map_.multi_get(cache_id, count, keys, pvalues, mb_handles, rets))) {
+    COMMON_LOG(WARN, "fail to multi get value from map, ", K(cache_id), K(count), K(ret));
+  }
+  return ret;
+}
+
 int ObKVGlobalCache::erase(const int64_t cache_id, const ObIKVCacheKey &key)
 {
   int ret = OB_SUCCESS;
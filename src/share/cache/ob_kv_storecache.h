@@ -70,6 +70,20 @@ public:
     ObKVCacheHandle &handle,
     bool overwrite = true);
   virtual int get(const Key &key, const Value *&pvalue, ObKVCacheHandle &handle);
+  // get a batch of keys, pvalues[i] and handles[i] are valid only if rets[i] is OB_SUCCESS,
+  // and rets[i] is OB_ENTRY_NOT_EXIST if keys[i] is not in cache
+  int multi_get(
+      const int64_t count,
+      const Key *const *keys,
+      const Value **pvalues,
+      ObKVCacheHandle *handles,
+      int *rets);
+  // put a batch of kvs, the kv which already exists is skipped if not overwrite
+  int multi_put(
+      const int64_t count,
+      const Key *const *keys,
+      const Value *const *values,
+      bool overwrite = true);
   int get_iterator(ObKVCacheIterator &iter);
   virtual int erase(const Key &key);
   virtual int alloc(
@@ -227,6 +241,13 @@ private:
     const ObIKVCacheKey &key,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle);
+  int multi_get(
+    const int64_t cache_id,
+    const int64_t count,
+    const ObIKVCacheKey *const *keys,
+    const ObIKVCacheValue **pvalues,
+    ObKVMemBlockHandle **mb_handles,
+    int *rets);
   int erase(const int64_t cache_id, const ObIKVCacheKey &key);
   void revert(ObKVMemBlockHandle *mb_handle);
   void wash();
@@ -615,6 +636,84 @@ int ObKVCache<Key, Value>::get(const Key &key, const Value *&pvalue, ObKVCacheHa
   return ret;
 }
 
+template <class Key, class Value>
+int ObKVCache<Key, Value>::multi_get(
+    const int64_t count,
+    const Key *const *keys,
+    const Value **pvalues,
+    ObKVCacheHandle *handles,
+    int *rets)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCache has not been inited, ", K(ret));
+  } else if (OB_UNLIKELY(count < 0)
+      || OB_ISNULL(keys) || OB_ISNULL(pvalues) || OB_ISNULL(handles) || OB_ISNULL(rets)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument, ", K(count), KP(keys), KP(pvalues), KP(handles),
+               KP(rets), K(ret));
+  } else {
+    const ObIKVCacheKey *batch_keys[ObKVCacheMap::MAX_MULTI_GET_CNT];
+    const ObIKVCacheValue *batch_values[ObKVCacheMap::MAX_MULTI_GET_CNT];
+    ObKVMemBlockHandle *batch_handles[ObKVCacheMap::MAX_MULTI_GET_CNT];
+    for (int64_t start = 0; OB_SUCC(ret) && start < count; start += ObKVCacheMap::MAX_MULTI_GET_CNT) {
+      const int64_t batch_cnt = MIN(count - start, ObKVCacheMap::MAX_MULTI_GET_CNT);
+      for (int64_t i = 0; i < batch_cnt; ++i) {
+        handles[start + i].reset();
+        pvalues[start + i] = NULL;
+        batch_keys[i] = keys[start + i];
+      }
+      if (OB_FAIL(ObKVGlobalCache::get_instance().multi_get(cache_id_, batch_cnt, batch_keys,
+          batch_values, batch_handles, rets + start))) {
+        COMMON_LOG(WARN, "Fail to multi get from ObKVGlobalCache, ", K_(cache_id), K(batch_cnt), K(ret));
+      } else {
+        for (int64_t i = 0; i < batch_cnt; ++i) {
+          if (OB_SUCCESS == rets[start + i]) {
+            handles[start + i].mb_handle_ = batch_handles[i];
+            pvalues[start + i] = reinterpret_cast<const Value*> (batch_values[i]);
+#ifdef ENABLE_DEBUG_LOG
+            ObKVCacheHandleRefChecker::get_instance().handle_ref_inc(handles[start + i]);
+#endif
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+template <class Key, class Value>
+int ObKVCache<Key, Value>::multi_put(
+    const int64_t count,
+    const Key *const *keys,
+    const Value *const *values,
+    bool overwrite)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCache has not been inited, ", K(ret));
+  } else if (OB_UNLIKELY(count < 0) || OB_ISNULL(keys) || OB_ISNULL(values)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument, ", K(count), KP(keys), KP(values), K(ret));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < count; ++i) {
+      if (OB_ISNULL(keys[i]) || OB_ISNULL(values[i])) {
+        ret = OB_INVALID_ARGUMENT;
+        COMMON_LOG(WARN, "Invalid null kv, ", K(i), KP(keys[i]), KP(values[i]), K(ret));
+      } else if (OB_FAIL(put(*keys[i], *values[i], overwrite))) {
+        if (OB_ENTRY_EXIST == ret) {
+          ret = OB_SUCCESS;
+        } else {
+          COMMON_LOG(WARN, "Fail to put kv in batch, ", K(i), K(ret));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 template <class Key, class Value>
 int ObKVCache<Key, Value>::erase(const Key &key)
 {
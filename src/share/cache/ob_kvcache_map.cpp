@@ -257,82 +257,157 @@ int ObKVCacheMap::get(
     uint64_t bucket_pos = hash_code % bucket_num_;
     hash_code += cache_id;
 
-    Node *iter = NULL;
-    Node *prev = NULL;
-    int64_t iter_get_cnt = 0;
-    int64_t mb_get_cnt = 0;
-    int64_t mb_handle_kv_cnt = 0;
-    ObKVCachePolicy mb_policy = LFU;
-
     GlobalHazardVersionGuard hazard_guard(global_hazard_version_);
     if (OB_FAIL(hazard_guard.get_ret())) {
       COMMON_LOG(WARN, "Fail to acquire hazard version", K(ret));
     } else {
-      Node *&bucket_ptr = get_bucket_node(bucket_pos);
-      iter = bucket_ptr;
-      bool is_equal = false;
-      while (NULL != iter && OB_SUCC(ret)) {
-        if (store_->add_handle_ref(iter->mb_handle_, iter->seq_num_)) {
-          if (hash_code == iter->hash_code_) {
-            if (OB_FAIL(key.equal(*iter->key_, is_equal))) {
-              COMMON_LOG(WARN, "Failed to check kvcache key equal", K(ret));
-            } else if (is_equal) {
-              pvalue = iter->value_;
-              out_handle = iter->mb_handle_;
+      ret = internal_get(bucket_pos, hash_code, key, pvalue, out_handle);
+    }  // hazard version guard
+  }
 
-              mb_get_cnt = ATOMIC_AAF(&out_handle->get_cnt_, 1);
-              mb_handle_kv_cnt = out_handle->kv_cnt_;
-              ++out_handle->recent_get_cnt_;
-              iter_get_cnt = ++ iter->get_cnt_;
-              iter->inst_->status_.total_hit_cnt_.inc();
-              mb_policy = out_handle->policy_;
+  return ret;
+}
 
-              break;
-            }
+int ObKVCacheMap::multi_get(
+    const int64_t cache_id,
+    const int64_t count,
+    const ObIKVCacheKey *const *keys,
+    const ObIKVCacheValue **pvalues,
+    ObKVMemBlockHandle **out_handles,
+    int *rets)
+{
+  int ret = OB_SUCCESS;
+  uint64_t hash_codes[MAX_MULTI_GET_CNT];
+  uint64_t bucket_poses[MAX_MULTI_GET_CNT];
+
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCacheMap has not been inited, ", K(ret));
+  } else if (OB_UNLIKELY(count < 0 || count > MAX_MULTI_GET_CNT)
+      || OB_ISNULL(keys) || OB_ISNULL(pvalues) || OB_ISNULL(out_handles) || OB_ISNULL(rets)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument, ", K(count), KP(keys), KP(pvalues), KP(out_handles),
+               KP(rets), K(ret));
+  } else {
+    // hash all keys up front and prefetch their buckets, so that the bucket
+    // loads of the batch are overlapped instead of paid one by one
+    for (int64_t i = 0; OB_SUCC(ret) && i < count; ++i) {
+      if (OB_ISNULL(keys[i])) {
+        ret = OB_INVALID_ARGUMENT;
+        COMMON_LOG(WARN, "Invalid null key, ", K(i), K(ret));
+      } else if (OB_FAIL(keys[i]->hash(hash_codes[i]))) {
+        COMMON_LOG(WARN, "Failed to get kvcache key hash", K(ret));
+      } else {
+        bucket_poses[i] = hash_codes[i] % bucket_num_;
+        hash_codes[i] += cache_id;
+        __builtin_prefetch(&get_bucket_node(bucket_poses[i]), 0);
+      }
+    }
+
+    if (OB_SUCC(ret)) {
+      GlobalHazardVersionGuard hazard_guard(global_hazard_version_);
+      if (OB_FAIL(hazard_guard.get_ret())) {
+        COMMON_LOG(WARN, "Fail to acquire hazard version", K(ret));
+      } else {
+        // nodes can not be retired while the hazard version is held
+        for (int64_t i = 0; i < count; ++i) {
+          Node *head = ATOMIC_LOAD(&get_bucket_node(bucket_poses[i]));
+          if (NULL != head) {
+            __builtin_prefetch(head, 0);
+          }
+        }
+        for (int64_t i = 0; i < count; ++i) {
+          pvalues[i] = NULL;
+          out_handles[i] = NULL;
+          rets[i] = internal_get(bucket_poses[i], hash_codes[i], *keys[i], pvalues[i], out_handles[i]);
+          if (OB_UNLIKELY(OB_SUCCESS != rets[i] && OB_ENTRY_NOT_EXIST != rets[i])) {
+            COMMON_LOG(WARN, "Fail to get kvcache key in batch", K(i), "ret", rets[i]);
           }
-          store_->de_handle_ref(iter->mb_handle_);
         }
-        iter = iter->next_;
       }
+    }  // hazard version guard
+  }
 
-      if (OB_FAIL(ret)) {
-      } else if (NULL == iter) {
-        ret = OB_ENTRY_NOT_EXIST;
+  return ret;
+}
+
+int ObKVCacheMap::internal_get(
+    const uint64_t bucket_pos,
+    const uint64_t hash_code,
+    const ObIKVCacheKey &key,
+    const ObIKVCacheValue *&pvalue,
+    ObKVMemBlockHandle *&out_handle)
+{
+  int ret = OB_SUCCESS;
+  Node *iter = NULL;
+  Node *prev = NULL;
+  int64_t iter_get_cnt = 0;
+  int64_t mb_get_cnt = 0;
+  int64_t mb_handle_kv_cnt = 0;
+  ObKVCachePolicy mb_policy = LFU;
+
+  Node *&bucket_ptr = get_bucket_node(bucket_pos);
+  iter = bucket_ptr;
+  bool is_equal = false;
+  while (NULL != iter && OB_SUCC(ret)) {
+    if (store_->add_handle_ref(iter->mb_handle_, iter->seq_num_)) {
+      if (hash_code == iter->hash_code_) {
+        if (OB_FAIL(key.equal(*iter->key_, is_equal))) {
+          COMMON_LOG(WARN, "Failed to check kvcache key equal", K(ret));
+        } else if (is_equal) {
+          pvalue = iter->value_;
+          out_handle = iter->mb_handle_;
+
+          mb_get_cnt = ATOMIC_AAF(&out_handle->get_cnt_, 1);
+          mb_handle_kv_cnt = out_handle->kv_cnt_;
+          ++out_handle->recent_get_cnt_;
+          iter_get_cnt = ++ iter->get_cnt_;
+          iter->inst_->status_.total_hit_cnt_.inc();
+          mb_policy = out_handle->policy_;
+
+          break;
+        }
+      }
+      store_->de_handle_ref(iter->mb_handle_);
+    }
+    iter = iter->next_;
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (NULL == iter) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else {
+    if (LRU == mb_policy && need_modify_cache(iter_get_cnt, mb_get_cnt, mb_handle_kv_cnt)) {
+      int tmp_ret = OB_SUCCESS;
+      ObBucketWLockGuard guard(bucket_lock_, bucket_pos);
+      if (OB_TMP_FAIL(guard.get_ret())) {
+        COMMON_LOG(WARN, "Fail to write lock bucket, ", K(tmp_ret), K(bucket_pos));
       } else {
-        if (LRU == mb_policy && need_modify_cache(iter_get_cnt, mb_get_cnt, mb_handle_kv_cnt)) {
-          int tmp_ret = OB_SUCCESS;
-          ObBucketWLockGuard guard(bucket_lock_, bucket_pos);
-          if (OB_TMP_FAIL(guard.get_ret())) {
-            COMMON_LOG(WARN, "Fail to write lock bucket, ", K(tmp_ret), K(bucket_pos));
-          } else {
-            prev = NULL;
-            iter = bucket_ptr;
-            bool is_equal = false;
-            while (NULL != iter && OB_LIKELY(OB_SUCCESS == tmp_ret)) {
-              if (store_->add_handle_ref(iter->mb_handle_, iter->seq_num_)) {
-                if (hash_code == iter->hash_code_) {
-                  if (OB_TMP_FAIL(key.equal(*iter->key_, is_equal))) {
-                    COMMON_LOG(WARN, "Failed to check kvcache key equal", K(tmp_ret));
-                  } else if (is_equal) {
-                    ObKVMemBlockHandle *old_handle = iter->mb_handle_;
-                    if (OB_TMP_FAIL(internal_data_move(prev, iter, bucket_ptr, LFU))) {
-                      COMMON_LOG(WARN, "Fail to move node to LFU block, ", K(tmp_ret));
-                    }
-                    store_->de_handle_ref(old_handle);
-                    break;
-                  }
+        prev = NULL;
+        iter = bucket_ptr;
+        bool is_equal = false;
+        while (NULL != iter && OB_LIKELY(OB_SUCCESS == tmp_ret)) {
+          if (store_->add_handle_ref(iter->mb_handle_, iter->seq_num_)) {
+            if (hash_code == iter->hash_code_) {
+              if (OB_TMP_FAIL(key.equal(*iter->key_, is_equal))) {
+                COMMON_LOG(WARN, "Failed to check kvcache key equal", K(tmp_ret));
+              } else if (is_equal) {
+                ObKVMemBlockHandle *old_handle = iter->mb_handle_;
+                if (OB_TMP_FAIL(internal_data_move(prev, iter, bucket_ptr, LFU))) {
+                  COMMON_LOG(WARN, "Fail to move node to LFU block, ", K(tmp_ret));
                 }
-                store_->de_handle_ref(iter->mb_handle_);
+                store_->de_handle_ref(old_handle);
+                break;
               }
-              prev = iter;
-              iter = iter->next_;
             }
+            store_->de_handle_ref(iter->mb_handle_);
           }
+          prev = iter;
+          iter = iter->next_;
         }
       }
-    }  // hazard version guard
+    }
   }
-
   return ret;
 }
 
@@ -52,8 +52,18 @@ public:
     const ObIKVCacheKey &key,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&out_handle);
+  // get at most MAX_MULTI_GET_CNT keys within one hazard version, the result of
+  // keys[i] is returned by rets[i], which is OB_SUCCESS or OB_ENTRY_NOT_EXIST
+  int multi_get(
+    const int64_t cache_id,
+    const int64_t count,
+    const ObIKVCacheKey *const *keys,
+    const ObIKVCacheValue **pvalues,
+    ObKVMemBlockHandle **out_handles,
+    int *rets);
   int erase(const int64_t cache_id, const ObIKVCacheKey &key);
   void print_hazard_version_info();
+  static const int64_t MAX_MULTI_GET_CNT = 64;
 private:
   friend class ObKVCacheIterator;
   struct Node : public KVCacheHazardNode
@@ -85,6 +95,13 @@ private:
   };
 private:
   int multi_get(const int64_t cache_id, const int64_t pos, common::ObList<Node, common::ObArenaAllocator> &list);
+  // the hazard version must be held by the caller
+  int internal_get(
+    const uint64_t bucket_pos,
+    const uint64_t hash_code,
+    const ObIKVCacheKey &key,
+    const ObIKVCacheValue *&pvalue,
+    ObKVMemBlockHandle *&out_handle);
   void internal_map_erase(Node *&prev, Node *&iter, Node *&bucket_ptr);
   void internal_map_replace(Node *&prev, Node *&iter, Node *&bucket_ptr);
   int internal_data_move(Node *&prev, Node *&iter, Node *&bucket_ptr, const enum ObKVCachePolicy policy);
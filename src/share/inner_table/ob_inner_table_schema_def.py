@@ -10067,6 +10067,11 @@ def_table_schema(
     ('unsubmitted_lsn', 'uint'),
     ('unsubmitted_log_scn', 'uint'),
     ('pending_cnt', 'int'),
+    ('replayed_task_cnt', 'int'),
+    ('replayed_log_size', 'int'),
+    ('max_queue_pending_cnt', 'int'),
+    ('max_pending_queue_idx', 'int'),
+    ('active_queue_cnt', 'int'),
   ],
 
   partition_columns = ['svr_ip', 'svr_port'],
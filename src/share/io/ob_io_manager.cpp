@@ -91,6 +91,25 @@ private:
   ObIAllocator &allocator_;
 };
 
+struct RegisterIOBufferFn
+{
+public:
+  RegisterIOBufferFn(void *buf, const int64_t size) : buf_(buf), size_(size) {}
+  int operator () (hash::HashMapPair<int64_t, ObDeviceChannel *> &entry) {
+    if (nullptr != entry.second) {
+      if (size_ > 0) {
+        entry.second->register_io_buffer(buf_, size_); // ignore ret
+      } else {
+        entry.second->unregister_io_buffer(buf_); // ignore ret
+      }
+    }
+    return OB_SUCCESS;
+  }
+private:
+  void *buf_;
+  int64_t size_; // 0 means unregister
+};
+
 struct DestroyTenantMapFn
 {
 public:
@@ -318,6 +337,32 @@ int ObIOManager::adjust_tenant_clock()
   return ret;
 }
 
+void ObIOManager::register_io_buffer(void *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (!is_inited_ || nullptr == buf || size <= 0) {
+    // do nothing
+  } else {
+    RegisterIOBufferFn fn(buf, size);
+    if (OB_FAIL(channel_map_.foreach_refactored(fn))) {
+      LOG_WARN("register io buffer to device channels failed", K(ret), KP(buf), K(size));
+    }
+  }
+}
+
+void ObIOManager::unregister_io_buffer(void *buf)
+{
+  int ret = OB_SUCCESS;
+  if (!is_inited_ || nullptr == buf) {
+    // do nothing
+  } else {
+    RegisterIOBufferFn fn(buf, 0/*unregister*/);
+    if (OB_FAIL(channel_map_.foreach_refactored(fn))) {
+      LOG_WARN("unregister io buffer from device channels failed", K(ret), KP(buf));
+    }
+  }
+}
+
 int ObIOManager::set_io_config(const ObIOConfig &conf)
 {
   int ret = OB_SUCCESS;
@@ -360,7 +405,8 @@ int ObIOManager::reset_device_health()
 int ObIOManager::add_device_channel(ObIODevice *device_handle,
                                     const int64_t async_channel_count,
                                     const int64_t sync_channel_count,
-                                    const int64_t max_io_depth)
+                                    const int64_t max_io_depth,
+                                    const ObAsyncIOEngine io_engine)
 {
   int ret = OB_SUCCESS;
   ObDeviceChannel *device_channel = nullptr;
@@ -379,12 +425,13 @@ int ObIOManager::add_device_channel(ObIODevice *device_handle,
                                           async_channel_count,
                                           sync_channel_count,
                                           max_io_depth,
-                                          allocator_))) {
-    LOG_WARN("init device_channel failed", K(ret), K(async_channel_count), K(sync_channel_count));
+                                          allocator_,
+                                          io_engine))) {
+    LOG_WARN("init device_channel failed", K(ret), K(async_channel_count), K(sync_channel_count), K(io_engine));
   } else if (OB_FAIL(channel_map_.set_refactored(reinterpret_cast<int64_t>(device_handle), device_channel))) {
     LOG_WARN("set channel map failed", K(ret), KP(device_handle));
   } else {
-    LOG_INFO("add io device channel succ", KP(device_handle));
+    LOG_INFO("add io device channel succ", KP(device_handle), K(io_engine));
     device_channel = nullptr;
   }
   if (OB_UNLIKELY(nullptr != device_channel)) {
@@ -618,6 +665,8 @@ int ObTenantIOManager::init(const uint64_t tenant_id,
     LOG_WARN("invalid argument", K(ret), K(tenant_id), K(io_config), KP(io_scheduler));
   } else if (OB_FAIL(io_allocator_.init(tenant_id, io_config.memory_limit_))) {
     LOG_WARN("init io allocator failed", K(ret), K(tenant_id), K(io_config.memory_limit_));
+  } else if (FALSE_IT(OB_IO_MANAGER.register_io_buffer(io_allocator_.get_macro_pool_buf(),
+                                                       io_allocator_.get_macro_pool_size()))) {
   } else if (OB_FAIL(io_tracer_.init(tenant_id))) {
     LOG_WARN("init io tracer failed", K(ret));
   } else if (OB_FAIL(alloc_io_clock(io_allocator_, io_clock_))) {
@@ -648,6 +697,7 @@ void ObTenantIOManager::destroy()
   io_tracer_.destroy();
   io_scheduler_ = nullptr;
   tenant_id_ = 0;
+  OB_IO_MANAGER.unregister_io_buffer(io_allocator_.get_macro_pool_buf());
   io_allocator_.destroy();
   is_inited_ = false;
 }
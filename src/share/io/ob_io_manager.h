@@ -61,7 +61,8 @@ public:
   int add_device_channel(ObIODevice *device_handle,
                          const int64_t async_channel_count,
                          const int64_t sync_channel_count,
-                         const int64_t max_io_depth);
+                         const int64_t max_io_depth,
+                         const ObAsyncIOEngine io_engine = ASYNC_IO_LIBAIO);
   int remove_device_channel(ObIODevice *device_handle);
   int get_device_channel(const ObIODevice *device_handle, ObDeviceChannel *&device_channel);
 
@@ -80,6 +81,9 @@ private:
   ~ObIOManager();
   int tenant_aio(const ObIOInfo &info, ObIOHandle &handle);
   int adjust_tenant_clock();
+  // register io buffer to all device channels, best effort
+  void register_io_buffer(void *buf, const int64_t size);
+  void unregister_io_buffer(void *buf);
   DISABLE_COPY_ASSIGN(ObIOManager);
 private:
   bool is_inited_;
@@ -22,6 +22,7 @@
 #include "lib/utility/ob_tracepoint.h"
 #include "lib/file/file_directory_utils.h"
 #include "share/io/ob_io_manager.h"
+#include "share/ob_local_device.h"
 #include "observer/ob_server.h"
 
 using namespace oceanbase::lib;
@@ -1322,6 +1323,157 @@ void ObIOChannel::destroy_thread()
   }
 }
 
+void ObIOChannel::stop()
+{
+  if (tg_id_ >= 0) {
+    TG_STOP(tg_id_);
+  }
+}
+
+void ObIOChannel::wait()
+{
+  if (tg_id_ >= 0) {
+    TG_WAIT(tg_id_);
+  }
+}
+
+static int64_t get_io_depth(const int64_t io_size)
+{
+  const int64_t IO_SPLIT_SIZE = 512L * 1024L; // 512KB
+  return upper_align(io_size, IO_SPLIT_SIZE) / IO_SPLIT_SIZE;
+}
+
+int ObIOChannel::on_io_return(ObIORequest &req, const int system_errno, const int64_t complete_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_LIKELY(0 == system_errno)) { // io succ
+    if (complete_size == req.io_size_) { // full complete
+      LOG_DEBUG("Success to get io event", K(req), K(complete_size));
+      if (OB_FAIL(on_full_return(req))) {
+        LOG_WARN("process full return io request failed", K(ret), K(req));
+      }
+    } else if (complete_size >= 0 && complete_size < req.io_size_) { // partial complete
+      LOG_WARN("io request partial finished", K(req), K(complete_size));
+      if (0 == complete_size || !is_io_aligned(complete_size)) { // reach end of file
+        if (OB_FAIL(on_partial_return(req, complete_size))) {
+          LOG_WARN("process partial return io request failed", K(ret), K(complete_size), K(req));
+        }
+      } else {
+        if (OB_FAIL(on_partial_retry(req, complete_size))) { // partial retry
+          LOG_WARN("partial retry io request failed", K(ret), K(complete_size), K(req));
+        }
+      }
+    } else { // invalid complete size
+      LOG_WARN("invalid complete size", K(req), K(complete_size));
+      if (OB_FAIL(on_failed(req, ObIORetCode(OB_IO_ERROR, complete_size)))) { // use complete_size as errno here
+        LOG_WARN("process failed io request failed", K(ret), K(req));
+      }
+    }
+  } else { // io failed
+    LOG_ERROR("io request failed", K(req), K(system_errno), K(complete_size));
+    const bool need_retry = false; // wait io device to support retry policy
+    if (need_retry) {
+      if (OB_FAIL(on_full_retry(req))) {
+        LOG_WARN("retry io request failed", K(ret), K(system_errno), K(req));
+      }
+    } else {
+      if (OB_FAIL(on_failed(req, ObIORetCode(OB_IO_ERROR, system_errno)))) {
+        LOG_WARN("process failed io request failed", K(ret), K(req));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObIOChannel::on_full_return(ObIORequest &req)
+{
+  int ret = OB_SUCCESS;
+  req.complete_size_ = req.io_size_;
+  if (!req.is_canceled_ && req.can_callback()) {
+    if (OB_FAIL(req.tenant_io_mgr_.get_ptr()->enqueue_callback(req))) {
+      LOG_WARN("push io request into callback queue failed", K(ret), K(req));
+      req.finish(ret);
+    }
+  } else {
+    req.finish(OB_SUCCESS);
+  }
+  return ret;
+}
+
+int ObIOChannel::on_partial_return(ObIORequest &req, const int64_t complete_size)
+{
+  int ret = OB_SUCCESS;
+  // partial return ignore callback
+  req.complete_size_ += complete_size;
+  if (req.get_data_size() >= req.io_info_.size_) {
+    // in case of aligned_size > file_size > user_need_size
+    if (!req.is_canceled_ && req.can_callback()) {
+      // the callback is not aware of complete size, not supported for now
+      req.finish(OB_NOT_SUPPORTED);
+    } else {
+      req.finish(OB_SUCCESS);
+    }
+  } else {
+    req.finish(OB_DATA_OUT_OF_RANGE);
+  }
+  return ret;
+}
+
+int ObIOChannel::on_partial_retry(ObIORequest &req, const int64_t complete_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_io_aligned(complete_size))) {
+    ret = OB_ERR_SYS;
+    LOG_WARN("complete size not aligned", K(ret), K(complete_size));
+  } else {
+    req.complete_size_ += complete_size;
+    req.io_buf_ += complete_size;
+    req.io_offset_ += complete_size;
+    req.io_size_ -= complete_size;
+    if (OB_FAIL(req.prepare())) {
+      LOG_WARN("prepare io request failed", K(ret), K(req));
+    } else if (OB_FAIL(submit(req))) {
+      LOG_WARN("submit io request failed", K(ret), K(req));
+    }
+  }
+  if (OB_FAIL(ret)) {
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = on_failed(req, ObIORetCode(ret)))) {
+      LOG_WARN("deal with failed request failed", K(tmp_ret), K(ret), K(req));
+    }
+  }
+  return ret;
+}
+
+int ObIOChannel::on_full_retry(ObIORequest &req)
+{
+  int ret = OB_SUCCESS;
+  static const int64_t MAX_RETRY_COUNT = 10;
+  if (++req.retry_count_ > MAX_RETRY_COUNT) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("retry too many times", K(ret), K(req));
+  } else if (FALSE_IT(req.complete_size_ = 0)) {
+  } else if (OB_FAIL(req.prepare())) {
+    LOG_WARN("prepare io request failed", K(ret), K(req));
+  } else if (OB_FAIL(submit(req))) {
+    LOG_WARN("submit io request failed", K(ret));
+  }
+  if (OB_FAIL(ret)) {
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = on_failed(req, ObIORetCode(ret)))) {
+      LOG_WARN("deal with failed request failed", K(tmp_ret), K(ret), K(req));
+    }
+  }
+  return ret;
+}
+
+int ObIOChannel::on_failed(ObIORequest &req, const ObIORetCode &ret_code)
+{
+  int ret = OB_SUCCESS;
+  req.finish(ret_code);
+  return ret;
+}
+
 /******************             AsyncIOChannel              **********************/
 ObAsyncIOChannel::ObAsyncIOChannel()
   : io_context_(nullptr),
@@ -1364,20 +1516,6 @@ int ObAsyncIOChannel::init(ObDeviceChannel *device_channel)
   return ret;
 }
 
-void ObAsyncIOChannel::stop()
-{
-  if (tg_id_ >= 0) {
-    TG_STOP(tg_id_);
-  }  
-}
-
-void ObAsyncIOChannel::wait()
-{
-  if (tg_id_ >= 0) {
-    TG_WAIT(tg_id_);
-  }  
-}
-
 void ObAsyncIOChannel::destroy()
 {
     // wait flying request
@@ -1422,12 +1560,6 @@ void ObAsyncIOChannel::run1()
   }
 }
 
-static int64_t get_io_depth(const int64_t io_size)
-{
-  const int64_t IO_SPLIT_SIZE = 512L * 1024L; // 512KB
-  return upper_align(io_size, IO_SPLIT_SIZE) / IO_SPLIT_SIZE;
-}
-
 int ObAsyncIOChannel::submit(ObIORequest &req)
 {
   int ret = OB_SUCCESS;
@@ -1514,41 +1646,8 @@ void ObAsyncIOChannel::get_events()
         ATOMIC_FAS(&device_channel_->used_io_depth_, req->io_size_);
         const int system_errno = io_events_->get_ith_ret_code(i);
         const int complete_size = io_events_->get_ith_ret_bytes(i);
-        if (OB_LIKELY(0 == system_errno)) { // io succ
-          if (complete_size == req->io_size_) { // full complete
-            LOG_DEBUG("Success to get io event", K(*req), K(complete_size));
-            if (OB_FAIL(on_full_return(*req))) {
-              LOG_WARN("process full return io request failed", K(ret), K(*req));
-            }
-          } else if (complete_size >= 0 && complete_size < req->io_size_) { // partial complete
-            LOG_WARN("io request partial finished", K(*req), K(complete_size));
-            if (0 == complete_size || !is_io_aligned(complete_size)) { // reach end of file
-              if (OB_FAIL(on_partial_return(*req, complete_size))) {
-                LOG_WARN("process partial return io request failed", K(ret), K(complete_size), K(*req));
-              }
-            } else {
-              if (OB_FAIL(on_partial_retry(*req, complete_size))) { // partial retry
-                LOG_WARN("partial retry io request failed", K(ret), K(complete_size), K(*req));
-              }
-            }
-          } else { // invalid complete size
-            LOG_WARN("invalid complete size", K(*req), K(complete_size));
-            if (OB_FAIL(on_failed(*req, ObIORetCode(OB_IO_ERROR, complete_size)))) { // use complete_size as errno here
-              LOG_WARN("process failed io request failed", K(ret), K(*req));
-            }
-          }
-        } else { // io failed
-          LOG_ERROR("io request failed", K(*req), K(system_errno), K(complete_size));
-          const bool need_retry = false; // wait io device to support retry policy
-          if (need_retry) {
-            if (OB_FAIL(on_full_retry(*req))) {
-              LOG_WARN("retry io request failed", K(ret), K(system_errno), K(*req));
-            }
-          } else {
-            if (OB_FAIL(on_failed(*req, ObIORetCode(OB_IO_ERROR, system_errno)))) {
-              LOG_WARN("process failed io request failed", K(ret), K(*req));
-            }
-          }
+        if (OB_FAIL(on_io_return(*req, system_errno, complete_size))) {
+          LOG_WARN("process returned io request failed", K(ret), K(system_errno), K(complete_size));
         }
       }
       ATOMIC_DEC(&submit_count_);
@@ -1556,95 +1655,238 @@ void ObAsyncIOChannel::get_events()
   }
 }
 
-int ObAsyncIOChannel::on_full_return(ObIORequest &req)
+/******************             IOUringChannel              **********************/
+ObIOUringChannel::ObIOUringChannel()
+  : io_uring_(),
+    submit_count_(0)
+{
+  MEMSET(event_datas_, 0, sizeof(event_datas_));
+  MEMSET(event_results_, 0, sizeof(event_results_));
+}
+
+ObIOUringChannel::~ObIOUringChannel()
+{
+  destroy();
+}
+
+int ObIOUringChannel::init(ObDeviceChannel *device_channel, const bool enable_sqpoll)
 {
   int ret = OB_SUCCESS;
-  req.complete_size_ = req.io_size_;
-  if (!req.is_canceled_ && req.can_callback()) {
-    if (OB_FAIL(req.tenant_io_mgr_.get_ptr()->enqueue_callback(req))) {
-      LOG_WARN("push io request into callback queue failed", K(ret), K(req));
-      req.finish(ret);
-    }
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret), K(is_inited_));
+  } else if (OB_ISNULL(device_channel)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(device_channel));
+  } else if (OB_ISNULL(dynamic_cast<share::ObLocalDevice *>(device_channel->device_handle_))) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("io_uring channel only supports local device", K(ret), KP(device_channel->device_handle_));
+  } else if (OB_FAIL(base_init(device_channel))) {
+    LOG_WARN("base init failed", K(ret), KP(device_channel));
+  } else if (OB_FAIL(io_uring_.init(MAX_URING_ENTRY_CNT, enable_sqpoll))) {
+    LOG_WARN("init io_uring failed", K(ret), K(enable_sqpoll));
   } else {
-    req.finish(OB_SUCCESS);
+    submit_count_ = 0;
+    is_inited_ = true;
+  }
+  if (OB_UNLIKELY(!is_inited_)) {
+    destroy();
   }
   return ret;
 }
 
-int ObAsyncIOChannel::on_partial_return(ObIORequest &req, const int64_t complete_size)
+void ObIOUringChannel::stop()
 {
   int ret = OB_SUCCESS;
-  // partial return ignore callback
-  req.complete_size_ += complete_size;
-  if (req.get_data_size() >= req.io_info_.size_) {
-    // in case of aligned_size > file_size > user_need_size
-    if (!req.is_canceled_ && req.can_callback()) {
-      // the callback is not aware of complete size, not supported for now
-      req.finish(OB_NOT_SUPPORTED);
-    } else {
-      req.finish(OB_SUCCESS);
+  ObIOChannel::stop();
+  if (io_uring_.is_inited()) {
+    // wake up the thread waiting for completions by a nop
+    if (OB_FAIL(io_uring_.prep_nop(nullptr))) {
+      LOG_WARN("prepare nop failed", K(ret));
+    } else if (OB_FAIL(io_uring_.submit())) {
+      LOG_WARN("submit nop failed", K(ret));
     }
-  } else {
-    req.finish(OB_DATA_OUT_OF_RANGE);
   }
-  return ret;
 }
 
-int ObAsyncIOChannel::on_partial_retry(ObIORequest &req, const int64_t complete_size)
+void ObIOUringChannel::destroy()
+{
+  // wait flying request
+  const int64_t max_wait_ts = ObTimeUtility::fast_current_time() + 1000L * 1000L * 30L; // 30s
+  while (submit_count_ > 0 && ObTimeUtility::fast_current_time() < max_wait_ts) {
+    ob_usleep(1000L * 10L);
+  }
+  if (submit_count_ > 0) {
+    LOG_WARN("some request have not returned from file system", K(submit_count_));
+  }
+  stop();
+  destroy_thread();
+  io_uring_.destroy();
+  submit_count_ = 0;
+  device_handle_ = nullptr;
+  is_inited_ = false;
+}
+
+void ObIOUringChannel::run1()
 {
   int ret = OB_SUCCESS;
-  if (OB_UNLIKELY(!is_io_aligned(complete_size))) {
-    ret = OB_ERR_SYS;
-    LOG_WARN("complete size not aligned", K(ret), K(complete_size));
+  const int64_t thread_id = get_thread_idx();
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
   } else {
-    req.complete_size_ += complete_size;
-    req.io_buf_ += complete_size;
-    req.io_offset_ += complete_size;
-    req.io_size_ -= complete_size;
-    if (OB_FAIL(req.prepare())) {
-      LOG_WARN("prepare io request failed", K(ret), K(req));
-    } else if (OB_FAIL(submit(req))) {
-      LOG_WARN("submit io request failed", K(ret), K(req));
+    set_thread_name("IO_GETEVENT", thread_id);
+    LOG_INFO("io_uring get_events thread started", K(thread_id), K(tg_id_));
+    while (!has_set_stop()) {
+      get_events();
     }
+    LOG_INFO("io_uring get_events thread stopped", K(thread_id), K(tg_id_));
   }
-  if (OB_FAIL(ret)) {
-    int tmp_ret = OB_SUCCESS;
-    if (OB_SUCCESS != (tmp_ret = on_failed(req, ObIORetCode(ret)))) {
-      LOG_WARN("deal with failed request failed", K(tmp_ret), K(ret), K(req));
+}
+
+int ObIOUringChannel::submit(ObIORequest &req)
+{
+  int ret = OB_SUCCESS;
+  const share::ObLocalIOCB *iocb = nullptr;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (OB_UNLIKELY(device_handle_ != req.io_info_.fd_.device_handle_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(req), KP(device_handle_));
+  } else if (OB_ISNULL(iocb = dynamic_cast<const share::ObLocalIOCB *>(req.control_block_))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("io request is not prepared by local device", K(ret), K(req));
+  } else if (submit_count_ >= MAX_URING_ENTRY_CNT) {
+    ret = OB_EAGAIN;
+    if (REACH_TIME_INTERVAL(1000000L)) {
+      LOG_WARN("too many io requests", K(ret), K(submit_count_));
+    }
+  } else if (device_channel_->used_io_depth_ > device_channel_->max_io_depth_) {
+    ret = OB_EAGAIN;
+    LOG_DEBUG("reach max io depth", K(ret), K(device_channel_->used_io_depth_), K(device_channel_->max_io_depth_));
+  } else {
+    ATOMIC_INC(&submit_count_);
+    ATOMIC_FAA(&device_channel_->used_io_depth_, get_io_depth(req.io_size_));
+    req.channel_ = this;
+    req.time_log_.submit_ts_ = ObTimeUtility::fast_current_time();
+    req.inc_ref("os_inc"); // ref for file system
+    if (OB_FAIL(io_uring_.prep_rw(iocb->is_read(),
+                                  iocb->get_fd(),
+                                  req.io_info_.fd_.is_block_file()/*fd of block file is never closed*/,
+                                  iocb->get_buf(),
+                                  iocb->get_size(),
+                                  iocb->get_offset(),
+                                  &req))) {
+      ATOMIC_DEC(&submit_count_);
+      ATOMIC_FAS(&device_channel_->used_io_depth_, get_io_depth(req.io_size_));
+      req.dec_ref("os_dec"); // ref for file system
+      if (OB_EAGAIN != ret) {
+        LOG_WARN("prepare io_uring sqe failed", K(ret), K(submit_count_), K(req));
+      }
+    } else if (OB_FAIL(io_uring_.submit())) {
+      // the sqe is already in ring, it will be submitted by next submit or get_events
+      LOG_WARN("io_uring submit failed", K(ret), K(submit_count_), K(req));
+      ret = OB_SUCCESS;
+    } else {
+      LOG_DEBUG("Success to submit io request, ", K(ret), K(submit_count_), KP(&req));
     }
   }
   return ret;
 }
 
-int ObAsyncIOChannel::on_full_retry(ObIORequest &req)
+void ObIOUringChannel::cancel(ObIORequest &req)
 {
   int ret = OB_SUCCESS;
-  static const int64_t MAX_RETRY_COUNT = 10;
-  if (++req.retry_count_ > MAX_RETRY_COUNT) {
-    ret = OB_IO_ERROR;
-    LOG_WARN("retry too many times", K(ret), K(req));
-  } else if (FALSE_IT(req.complete_size_ = 0)) {
-  } else if (OB_FAIL(req.prepare())) {
-    LOG_WARN("prepare io request failed", K(ret), K(req));
-  } else if (OB_FAIL(submit(req))) {
-    LOG_WARN("submit io request failed", K(ret));
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (0 != req.time_log_.submit_ts_ && 0 == req.time_log_.return_ts_) {
+    // Note: the request still returns from get_events, either with ECANCELED or with its
+    // result if it completed before the cancel, so the counters are released there.
+    // The completion of the cancel itself carries null user data and is skipped like a nop.
+    if (OB_FAIL(io_uring_.prep_cancel(&req, nullptr))) {
+      LOG_DEBUG("prepare io_uring cancel failed", K(ret), K(req));
+    } else if (OB_FAIL(io_uring_.submit())) {
+      // the sqe is already in ring, it will be submitted by next submit or get_events
+      LOG_DEBUG("io_uring submit cancel failed", K(ret), K(req));
+    } else {
+      LOG_DEBUG("The IO Request has been canceled!", KP(&req));
+    }
   }
-  if (OB_FAIL(ret)) {
-    int tmp_ret = OB_SUCCESS;
-    if (OB_SUCCESS != (tmp_ret = on_failed(req, ObIORetCode(ret)))) {
-      LOG_WARN("deal with failed request failed", K(tmp_ret), K(ret), K(req));
+}
+
+int64_t ObIOUringChannel::get_queue_count() const
+{
+  return submit_count_;
+}
+
+int ObIOUringChannel::register_io_buffer(void *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (OB_FAIL(io_uring_.register_buffer(buf, size))) {
+    if (OB_NOT_SUPPORTED != ret) {
+      LOG_WARN("register io buffer failed", K(ret), KP(buf), K(size));
     }
   }
   return ret;
 }
 
-int ObAsyncIOChannel::on_failed(ObIORequest &req, const ObIORetCode &ret_code)
+int ObIOUringChannel::unregister_io_buffer(void *buf)
 {
   int ret = OB_SUCCESS;
-  req.finish(ret_code);
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (OB_FAIL(io_uring_.unregister_buffer(buf))) {
+    if (OB_NOT_SUPPORTED != ret && OB_ENTRY_NOT_EXIST != ret) {
+      LOG_WARN("unregister io buffer failed", K(ret), KP(buf));
+    }
+  }
   return ret;
 }
 
+void ObIOUringChannel::get_events()
+{
+  int ret = OB_SUCCESS;
+  int64_t complete_cnt = 0;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (OB_FAIL(io_uring_.reap(MAX_URING_ENTRY_CNT, event_datas_, event_results_, complete_cnt))) {
+    if (REACH_TIME_INTERVAL(10 * 1000 * 1000)) {
+      LOG_ERROR("io_uring get_events failed", K(ret));
+    }
+    ob_usleep(1000L); // failed without waiting, avoid busy loop
+  } else if (complete_cnt > 0) {
+    const int64_t io_return_time = ObTimeUtility::fast_current_time();
+    ObIORequest *req = nullptr;
+    for (int64_t i = 0; i < complete_cnt; ++i) { // ignore ret
+      if (nullptr == (req = static_cast<ObIORequest *>(event_datas_[i]))) {
+        // nop for waking up
+      } else {
+        {
+          RequestHolder holder(req);
+          req->dec_ref("os_dec"); // ref for file system
+          req->time_log_.return_ts_ = io_return_time;
+          ATOMIC_FAS(&device_channel_->used_io_depth_, get_io_depth(req->io_size_));
+          const int32_t res = event_results_[i];
+          const int system_errno = res < 0 ? -res : 0;
+          const int64_t complete_size = res < 0 ? 0 : res;
+          if (ECANCELED == system_errno && req->is_canceled_) {
+            LOG_DEBUG("canceled io request returned", KP(req));
+          } else if (OB_FAIL(on_io_return(*req, system_errno, complete_size))) {
+            LOG_WARN("process returned io request failed", K(ret), K(system_errno), K(complete_size));
+          }
+        }
+        ATOMIC_DEC(&submit_count_);
+      }
+    }
+  }
+}
 
 /******************             SyncIOChannel              **********************/
 ObSyncIOChannel::ObSyncIOChannel()
@@ -1807,6 +2049,7 @@ int ObSyncIOChannel::do_sync_io(ObIORequest &req)
 ObDeviceChannel::ObDeviceChannel()
   : is_inited_(false),
     allocator_(nullptr),
+    io_engine_(ASYNC_IO_LIBAIO),
     device_handle_(nullptr),
     used_io_depth_(0),
     max_io_depth_(0)
@@ -1823,7 +2066,8 @@ int ObDeviceChannel::init(ObIODevice *device_handle,
                           const int64_t async_channel_count,
                           const int64_t sync_channel_count,
                           const int64_t max_io_depth,
-                          ObIAllocator &allocator)
+                          ObIAllocator &allocator,
+                          const ObAsyncIOEngine io_engine)
 {
   int ret = OB_SUCCESS;
   if (OB_UNLIKELY(is_inited_)) {
@@ -1840,15 +2084,11 @@ int ObDeviceChannel::init(ObIODevice *device_handle,
     used_io_depth_ = 0;
     max_io_depth_ = max_io_depth;
     allocator_ = &allocator;
+    io_engine_ = io_engine;
     for (int64_t i = 0; OB_SUCC(ret) && i < async_channel_count; ++i) {
-      ObAsyncIOChannel *ch = nullptr;
-      void *buf = nullptr;
-      if (OB_ISNULL(buf = allocator.alloc(sizeof(ObAsyncIOChannel)))) {
-        ret = OB_ALLOCATE_MEMORY_FAILED;
-        LOG_WARN("alloc async channel failed", K(ret), K(i), K(async_channel_count));
-      } else if (FALSE_IT(ch = new (buf) ObAsyncIOChannel())) {
-      } else if (OB_FAIL(ch->init(this))) {
-        LOG_WARN("init async channel failed", K(ret));
+      ObIOChannel *ch = nullptr;
+      if (OB_FAIL(create_async_channel(ch))) {
+        LOG_WARN("create async channel failed", K(ret), K(i), K(async_channel_count));
       } else if (OB_FAIL(ch->start_thread())) {
         LOG_WARN("start thread failed", K(ret), KPC(ch));
       } else if (OB_FAIL(async_channels_.push_back(ch))) {
@@ -1857,7 +2097,7 @@ int ObDeviceChannel::init(ObIODevice *device_handle,
         ch = nullptr;
       }
       if (OB_UNLIKELY(nullptr != ch)) {
-        ch->~ObAsyncIOChannel();
+        ch->~ObIOChannel();
         allocator.free(ch);
       }
     }
@@ -1896,12 +2136,10 @@ void ObDeviceChannel::destroy()
 {
   is_inited_ = false;
   for (int64_t i = 0; i < async_channels_.count(); ++i) {
-    ObAsyncIOChannel *ch = static_cast<ObAsyncIOChannel *>(async_channels_.at(i));
-    ch->stop();
+    async_channels_.at(i)->stop();
   }
   for (int64_t i = 0; i < async_channels_.count(); ++i) {
-    ObAsyncIOChannel *ch = static_cast<ObAsyncIOChannel *>(async_channels_.at(i));
-    ch->wait();
+    async_channels_.at(i)->wait();
   }
   for (int64_t i = 0; i < async_channels_.count(); ++i) {
     ObIOChannel *ch = async_channels_.at(i);
@@ -1920,6 +2158,7 @@ void ObDeviceChannel::destroy()
   }
   sync_channels_.destroy();
   allocator_ = nullptr;
+  io_engine_ = ASYNC_IO_LIBAIO;
 }
 
 int ObDeviceChannel::submit(ObIORequest &req)
@@ -1941,6 +2180,88 @@ int ObDeviceChannel::submit(ObIORequest &req)
   return ret;
 }
 
+int ObDeviceChannel::register_io_buffer(void *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (OB_UNLIKELY(nullptr == buf || size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf), K(size));
+  } else {
+    // best effort, io with unregistered buffer works as well
+    for (int64_t i = 0; i < async_channels_.count(); ++i) {
+      ObIOUringChannel *ch = dynamic_cast<ObIOUringChannel *>(async_channels_.at(i));
+      if (nullptr != ch) {
+        int tmp_ret = ch->register_io_buffer(buf, size);
+        if (OB_SUCCESS != tmp_ret) {
+          LOG_INFO("register io buffer to channel failed", K(tmp_ret), K(i), KP(buf), K(size));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObDeviceChannel::unregister_io_buffer(void *buf)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (OB_ISNULL(buf)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf));
+  } else {
+    for (int64_t i = 0; i < async_channels_.count(); ++i) {
+      ObIOUringChannel *ch = dynamic_cast<ObIOUringChannel *>(async_channels_.at(i));
+      if (nullptr != ch) {
+        ch->unregister_io_buffer(buf); // ignore ret
+      }
+    }
+  }
+  return ret;
+}
+
+int ObDeviceChannel::create_async_channel(ObIOChannel *&ch)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  ch = nullptr;
+  if (ASYNC_IO_LIBAIO != io_engine_) {
+    ObIOUringChannel *uring_ch = nullptr;
+    if (OB_ISNULL(buf = allocator_->alloc(sizeof(ObIOUringChannel)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("alloc io_uring channel failed", K(ret));
+    } else if (FALSE_IT(uring_ch = new (buf) ObIOUringChannel())) {
+    } else if (OB_FAIL(uring_ch->init(this, ASYNC_IO_URING_SQPOLL == io_engine_))) {
+      LOG_WARN("init io_uring channel failed, fallback to libaio", K(ret), K(io_engine_));
+      uring_ch->~ObIOUringChannel();
+      allocator_->free(uring_ch);
+      io_engine_ = ASYNC_IO_LIBAIO;
+      ret = OB_SUCCESS;
+    } else {
+      ch = uring_ch;
+    }
+  }
+  if (OB_SUCC(ret) && nullptr == ch) {
+    ObAsyncIOChannel *aio_ch = nullptr;
+    if (OB_ISNULL(buf = allocator_->alloc(sizeof(ObAsyncIOChannel)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("alloc async channel failed", K(ret));
+    } else if (FALSE_IT(aio_ch = new (buf) ObAsyncIOChannel())) {
+    } else if (OB_FAIL(aio_ch->init(this))) {
+      LOG_WARN("init async channel failed", K(ret));
+      aio_ch->~ObAsyncIOChannel();
+      allocator_->free(aio_ch);
+    } else {
+      ch = aio_ch;
+    }
+  }
+  return ret;
+}
+
 int ObDeviceChannel::get_random_io_channel(ObIArray<ObIOChannel *> &io_channels, ObIOChannel *&ch)
 {
   int ret = OB_SUCCESS;
@@ -23,6 +23,7 @@
 #include "lib/container/ob_array_wrap.h"
 #include "lib/lock/ob_spin_lock.h"
 #include "share/io/ob_io_define.h"
+#include "share/io/ob_io_uring.h"
 #include "share/io/io_schedule/ob_io_mclock.h"  
 
 namespace oceanbase
@@ -71,6 +72,8 @@ public:
   int free(void *ptr);
   bool contain(void *ptr);
   int64_t get_block_size() const { return SIZE; }
+  char *get_begin_ptr() const { return begin_ptr_; }
+  int64_t get_total_size() const { return capacity_ * SIZE; }
 private:
   bool is_inited_;
   int64_t capacity_;
@@ -89,6 +92,9 @@ public:
   void destroy();
   int update_memory_limit(const int64_t memory_limit);
   int64_t get_allocated_size() const;
+  // Memory of macro pool is allocated once, it can be registered to kernel for io
+  char *get_macro_pool_buf() const { return macro_pool_.get_begin_ptr(); }
+  int64_t get_macro_pool_size() const { return macro_pool_.get_total_size(); }
   virtual void *alloc(const int64_t size, const lib::ObMemAttr &attr) override;
   virtual void *alloc(const int64_t size) override;
   virtual void free(void *ptr) override;
@@ -276,11 +282,22 @@ public:
   int base_init(ObDeviceChannel *device_channel);
   int start_thread();
   void destroy_thread();
+  virtual void stop();
+  virtual void wait();
   virtual int submit(ObIORequest &req) = 0;
   virtual void cancel(ObIORequest &req) = 0;
   virtual int64_t get_queue_count() const = 0;
   TO_STRING_KV(K(is_inited_), KP(device_handle_), K(tg_id_), "queue_count", get_queue_count());
 
+protected:
+  // handle async io returned from file system, @complete_size is ignored when @system_errno is not 0
+  int on_io_return(ObIORequest &req, const int system_errno, const int64_t complete_size);
+  int on_full_return(ObIORequest &req);
+  int on_partial_return(ObIORequest &req, const int64_t complete_size);
+  int on_partial_retry(ObIORequest &req, const int64_t complete_size);
+  int on_full_retry(ObIORequest &req);
+  int on_failed(ObIORequest &req, const ObIORetCode &ret_code);
+
 protected:
   bool is_inited_;
   int tg_id_; // thread group id
@@ -296,8 +313,6 @@ public:
   virtual ~ObAsyncIOChannel();
 
   int init(ObDeviceChannel *device_channel);
-  void stop();
-  void wait();
   void destroy();
   virtual void run1() override;
   virtual int submit(ObIORequest &req) override;
@@ -307,11 +322,6 @@ public:
 
 private:
   void get_events();
-  int on_full_return(ObIORequest &req);
-  int on_partial_return(ObIORequest &req, const int64_t complete_size);
-  int on_partial_retry(ObIORequest &req, const int64_t complete_size);
-  int on_full_retry(ObIORequest &req);
-  int on_failed(ObIORequest &req, const ObIORetCode &ret_code);
 
 private:
   static const int32_t MAX_AIO_EVENT_CNT = 512;
@@ -323,6 +333,39 @@ private:
   ObThreadCond depth_cond_;
 };
 
+/**
+ * async io channel of local device based on io_uring, each channel owns one ring.
+ * io is prepared into libaio control block by the device as before, then translated into sqe,
+ * so that physical fd and offset of block file are decided by the device.
+ */
+class ObIOUringChannel : public ObIOChannel
+{
+public:
+  ObIOUringChannel();
+  virtual ~ObIOUringChannel();
+
+  int init(ObDeviceChannel *device_channel, const bool enable_sqpoll);
+  virtual void stop() override;
+  void destroy();
+  virtual void run1() override;
+  virtual int submit(ObIORequest &req) override;
+  virtual void cancel(ObIORequest &req) override;
+  virtual int64_t get_queue_count() const override;
+  int register_io_buffer(void *buf, const int64_t size);
+  int unregister_io_buffer(void *buf);
+  INHERIT_TO_STRING_KV("IOChannel", ObIOChannel, K(io_uring_), K(submit_count_));
+
+private:
+  void get_events();
+
+private:
+  static const int32_t MAX_URING_ENTRY_CNT = 512;
+  ObIOUring io_uring_;
+  int64_t submit_count_;
+  void *event_datas_[MAX_URING_ENTRY_CNT];
+  int32_t event_results_[MAX_URING_ENTRY_CNT];
+};
+
 class ObSyncIOChannel : public ObIOChannel
 {
 public:
@@ -344,8 +387,15 @@ private:
   bool is_wait_;
 };
 
+enum ObAsyncIOEngine
+{
+  ASYNC_IO_LIBAIO = 0,
+  ASYNC_IO_URING,
+  ASYNC_IO_URING_SQPOLL,
+};
+
 // each device has several channels, including async channels and sync channels.
-// this interface better in ObIODevice and can be replaced by io_uring.
+// async channels of local device use libaio or io_uring, chosen by @io_engine.
 class ObDeviceChannel final
 {
 public:
@@ -355,19 +405,26 @@ public:
            const int64_t async_channel_count,
            const int64_t sync_channel_count,
            const int64_t max_io_depth,
-           ObIAllocator &allocator);
+           ObIAllocator &allocator,
+           const ObAsyncIOEngine io_engine = ASYNC_IO_LIBAIO);
   void destroy();
   int submit(ObIORequest &req);
-  TO_STRING_KV(K(is_inited_), KP(allocator_), K(async_channels_), K(sync_channels_));
+  // register long-lived io buffer to kernel for io_uring channels, ignored by others
+  int register_io_buffer(void *buf, const int64_t size);
+  int unregister_io_buffer(void *buf);
+  TO_STRING_KV(K(is_inited_), KP(allocator_), K(io_engine_), K(async_channels_), K(sync_channels_));
 private:
   int get_random_io_channel(ObIArray<ObIOChannel *> &io_channels, ObIOChannel *&ch);
+  int create_async_channel(ObIOChannel *&ch);
 
 private:
   friend class ObIOChannel;
   friend class ObAsyncIOChannel;
+  friend class ObIOUringChannel;
   friend class ObSyncIOChannel;
   bool is_inited_;
   ObIAllocator *allocator_;
+  ObAsyncIOEngine io_engine_;
   ObSEArray<ObIOChannel *, 8> async_channels_;
   ObSEArray<ObIOChannel *, 8> sync_channels_;
   ObIODevice *device_handle_;
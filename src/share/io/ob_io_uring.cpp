@@ -0,0 +1,648 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX COMMON
+
+#include "share/io/ob_io_uring.h"
+
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "lib/oblog/ob_log.h"
+#include "lib/utility/utility.h"
+
+using namespace oceanbase::common;
+
+ObIOUring::ObIOUring()
+  : is_inited_(false),
+    ring_fd_(-1),
+    features_(0),
+    sq_entries_(0),
+    cq_entries_(0),
+    is_sqpoll_(false),
+    sq_ring_ptr_(nullptr),
+    sq_ring_size_(0),
+    cq_ring_ptr_(nullptr),
+    cq_ring_size_(0),
+    sqes_ptr_(nullptr),
+    sqes_size_(0),
+    sq_head_(nullptr),
+    sq_tail_(nullptr),
+    sq_mask_(nullptr),
+    sq_flags_(nullptr),
+    sq_array_(nullptr),
+    cq_head_(nullptr),
+    cq_tail_(nullptr),
+    cq_mask_(nullptr),
+    cqes_(nullptr),
+    sq_lock_(),
+    fixed_file_enabled_(false),
+    fixed_file_cnt_(0),
+    fixed_buffer_enabled_(false),
+    fixed_buffer_cnt_(0)
+{
+  for (int64_t i = 0; i < MAX_FIXED_FILE_CNT; ++i) {
+    fixed_files_[i] = -1;
+  }
+}
+
+ObIOUring::~ObIOUring()
+{
+  destroy();
+}
+
+#ifdef OB_HAS_IO_URING
+
+static int sys_io_uring_setup(const uint32_t entries, struct io_uring_params *params)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+static int sys_io_uring_enter(const int ring_fd,
+                              const uint32_t to_submit,
+                              const uint32_t min_complete,
+                              const uint32_t flags)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+static int sys_io_uring_register(const int ring_fd, const uint32_t opcode, const void *arg, const uint32_t nr_args)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+int ObIOUring::init(const uint32_t entries, const bool enable_sqpoll)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret), K(is_inited_));
+  } else if (OB_UNLIKELY(0 == entries)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(entries));
+  } else if (OB_FAIL(setup(entries, enable_sqpoll))) {
+    LOG_WARN("setup io_uring failed", K(ret), K(entries), K(enable_sqpoll));
+  } else {
+    register_sparse_tables();
+    is_inited_ = true;
+    LOG_INFO("succ to init io_uring", K(*this));
+  }
+  if (OB_UNLIKELY(!is_inited_)) {
+    destroy();
+  }
+  return ret;
+}
+
+int ObIOUring::setup(const uint32_t entries, const bool enable_sqpoll)
+{
+  int ret = OB_SUCCESS;
+  struct io_uring_params params;
+  bool use_sqpoll = enable_sqpoll;
+  ring_fd_ = -1;
+  while (ring_fd_ < 0 && OB_SUCC(ret)) {
+    MEMSET(&params, 0, sizeof(params));
+    if (use_sqpoll) {
+      params.flags |= IORING_SETUP_SQPOLL;
+      params.sq_thread_idle = SQPOLL_IDLE_MS;
+    }
+    if ((ring_fd_ = sys_io_uring_setup(entries, &params)) < 0) {
+      if (use_sqpoll) {
+        LOG_WARN("setup io_uring with sqpoll failed, fallback to interrupt mode", K(errno));
+        use_sqpoll = false;
+      } else {
+        ret = OB_NOT_SUPPORTED;
+        LOG_WARN("setup io_uring failed", K(ret), K(errno), K(entries));
+      }
+#ifdef IORING_FEAT_SQPOLL_NONFIXED
+    } else if (use_sqpoll && 0 == (params.features & IORING_FEAT_SQPOLL_NONFIXED)) {
+#else
+    } else if (use_sqpoll) {
+#endif
+      // before linux 5.11 sqpoll only accepts registered files
+      LOG_WARN("sqpoll of io_uring needs registered files, fallback to interrupt mode", K(params.features));
+      ::close(ring_fd_);
+      ring_fd_ = -1;
+      use_sqpoll = false;
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (0 == (params.features & IORING_FEAT_RW_CUR_POS)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("io_uring of kernel is too old", K(ret), K(params.features));
+  } else {
+    features_ = params.features;
+    is_sqpoll_ = use_sqpoll;
+    sq_entries_ = params.sq_entries;
+    cq_entries_ = params.cq_entries;
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    const bool single_mmap = 0 != (params.features & IORING_FEAT_SINGLE_MMAP);
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = max(sq_ring_size_, cq_ring_size_);
+    }
+    if (MAP_FAILED == (sq_ring_ptr_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                                            MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING))) {
+      ret = OB_ERR_SYS;
+      sq_ring_ptr_ = nullptr;
+      LOG_WARN("mmap sq ring failed", K(ret), K(errno), K(sq_ring_size_));
+    } else if (single_mmap) {
+      cq_ring_ptr_ = sq_ring_ptr_;
+    } else if (MAP_FAILED == (cq_ring_ptr_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                                                   MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING))) {
+      ret = OB_ERR_SYS;
+      cq_ring_ptr_ = nullptr;
+      LOG_WARN("mmap cq ring failed", K(ret), K(errno), K(cq_ring_size_));
+    }
+    if (OB_FAIL(ret)) {
+    } else if (MAP_FAILED == (sqes_ptr_ = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                                                MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES))) {
+      ret = OB_ERR_SYS;
+      sqes_ptr_ = nullptr;
+      LOG_WARN("mmap sqes failed", K(ret), K(errno), K(sqes_size_));
+    } else {
+      char *sq_ptr = static_cast<char *>(sq_ring_ptr_);
+      char *cq_ptr = static_cast<char *>(cq_ring_ptr_);
+      sq_head_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.head);
+      sq_tail_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.tail);
+      sq_mask_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.ring_mask);
+      sq_flags_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.flags);
+      sq_array_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.array);
+      cq_head_ = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.head);
+      cq_tail_ = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.tail);
+      cq_mask_ = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.ring_mask);
+      cqes_ = cq_ptr + params.cq_off.cqes;
+    }
+  }
+  return ret;
+}
+
+void ObIOUring::register_sparse_tables()
+{
+  // sparse file table and files update are supported since linux 5.5
+  int fds[MAX_FIXED_FILE_CNT];
+  for (int64_t i = 0; i < MAX_FIXED_FILE_CNT; ++i) {
+    fds[i] = -1;
+  }
+  fixed_file_enabled_ = 0 == sys_io_uring_register(ring_fd_, IORING_REGISTER_FILES, fds, MAX_FIXED_FILE_CNT);
+  if (!fixed_file_enabled_) {
+    LOG_INFO("register sparse file table of io_uring failed, registered files disabled", K(errno));
+  }
+#ifdef IORING_FEAT_RSRC_TAGS
+  // sparse buffer table and buffers update are supported since linux 5.13
+  if (0 != (features_ & IORING_FEAT_RSRC_TAGS)) {
+    struct iovec iovs[MAX_FIXED_BUFFER_CNT];
+    struct io_uring_rsrc_register reg;
+    MEMSET(iovs, 0, sizeof(iovs));
+    MEMSET(&reg, 0, sizeof(reg));
+    reg.nr = MAX_FIXED_BUFFER_CNT;
+    reg.data = reinterpret_cast<uint64_t>(iovs);
+    fixed_buffer_enabled_ = 0 == sys_io_uring_register(ring_fd_, IORING_REGISTER_BUFFERS2, &reg, sizeof(reg));
+  }
+#endif
+  if (!fixed_buffer_enabled_) {
+    LOG_INFO("register sparse buffer table of io_uring failed, registered buffers disabled", K(errno));
+  }
+}
+
+void ObIOUring::destroy()
+{
+  is_inited_ = false;
+  if (nullptr != sqes_ptr_) {
+    ::munmap(sqes_ptr_, sqes_size_);
+    sqes_ptr_ = nullptr;
+  }
+  if (nullptr != cq_ring_ptr_ && cq_ring_ptr_ != sq_ring_ptr_) {
+    ::munmap(cq_ring_ptr_, cq_ring_size_);
+  }
+  cq_ring_ptr_ = nullptr;
+  if (nullptr != sq_ring_ptr_) {
+    ::munmap(sq_ring_ptr_, sq_ring_size_);
+    sq_ring_ptr_ = nullptr;
+  }
+  if (ring_fd_ >= 0) {
+    // registered files and buffers are released with the ring
+    ::close(ring_fd_);
+    ring_fd_ = -1;
+  }
+  features_ = 0;
+  sq_entries_ = 0;
+  cq_entries_ = 0;
+  is_sqpoll_ = false;
+  sq_ring_size_ = 0;
+  cq_ring_size_ = 0;
+  sqes_size_ = 0;
+  sq_head_ = nullptr;
+  sq_tail_ = nullptr;
+  sq_mask_ = nullptr;
+  sq_flags_ = nullptr;
+  sq_array_ = nullptr;
+  cq_head_ = nullptr;
+  cq_tail_ = nullptr;
+  cq_mask_ = nullptr;
+  cqes_ = nullptr;
+  fixed_file_enabled_ = false;
+  fixed_file_cnt_ = 0;
+  for (int64_t i = 0; i < MAX_FIXED_FILE_CNT; ++i) {
+    fixed_files_[i] = -1;
+  }
+  fixed_buffer_enabled_ = false;
+  fixed_buffer_cnt_ = 0;
+  for (int64_t i = 0; i < MAX_FIXED_BUFFER_CNT; ++i) {
+    fixed_buffers_[i] = ObFixedBuffer();
+  }
+}
+
+int ObIOUring::register_buffer(void *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (OB_UNLIKELY(nullptr == buf || size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf), K(size));
+  } else if (!fixed_buffer_enabled_) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_DEBUG("registered buffers not supported", K(ret));
+  } else {
+#ifdef IORING_FEAT_RSRC_TAGS
+    ObSpinLockGuard guard(sq_lock_);
+    int64_t slot = fixed_buffer_cnt_;
+    for (int64_t i = 0; i < fixed_buffer_cnt_; ++i) {
+      if (nullptr == fixed_buffers_[i].buf_) {
+        slot = i;
+        break;
+      }
+    }
+    if (slot >= MAX_FIXED_BUFFER_CNT) {
+      ret = OB_SIZE_OVERFLOW;
+      LOG_WARN("too many registered buffers", K(ret), K_(fixed_buffer_cnt));
+    } else {
+      struct iovec iov;
+      struct io_uring_rsrc_update2 update;
+      iov.iov_base = buf;
+      iov.iov_len = size;
+      MEMSET(&update, 0, sizeof(update));
+      update.offset = static_cast<uint32_t>(slot);
+      update.data = reinterpret_cast<uint64_t>(&iov);
+      update.nr = 1;
+      if (sys_io_uring_register(ring_fd_, IORING_REGISTER_BUFFERS_UPDATE, &update, sizeof(update)) < 0) {
+        ret = OB_ERR_SYS;
+        LOG_WARN("register buffer into io_uring failed", K(ret), K(errno), KP(buf), K(size));
+      } else {
+        fixed_buffers_[slot].buf_ = static_cast<char *>(buf);
+        fixed_buffers_[slot].size_ = size;
+        fixed_buffer_cnt_ = max(fixed_buffer_cnt_, slot + 1);
+      }
+    }
+#endif
+  }
+  return ret;
+}
+
+int ObIOUring::unregister_buffer(void *buf)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (OB_UNLIKELY(nullptr == buf)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf));
+  } else if (!fixed_buffer_enabled_) {
+    ret = OB_NOT_SUPPORTED;
+  } else {
+#ifdef IORING_FEAT_RSRC_TAGS
+    ObSpinLockGuard guard(sq_lock_);
+    int64_t slot = -1;
+    for (int64_t i = 0; slot < 0 && i < fixed_buffer_cnt_; ++i) {
+      if (buf == fixed_buffers_[i].buf_) {
+        slot = i;
+      }
+    }
+    if (slot < 0) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      // in-flight io still holds the pinned pages of the old buffer in kernel
+      struct iovec iov;
+      struct io_uring_rsrc_update2 update;
+      MEMSET(&iov, 0, sizeof(iov));
+      MEMSET(&update, 0, sizeof(update));
+      update.offset = static_cast<uint32_t>(slot);
+      update.data = reinterpret_cast<uint64_t>(&iov);
+      update.nr = 1;
+      fixed_buffers_[slot] = ObFixedBuffer();
+      if (sys_io_uring_register(ring_fd_, IORING_REGISTER_BUFFERS_UPDATE, &update, sizeof(update)) < 0) {
+        ret = OB_ERR_SYS;
+        LOG_WARN("unregister buffer from io_uring failed", K(ret), K(errno), KP(buf));
+      }
+    }
+#endif
+  }
+  return ret;
+}
+
+void *ObIOUring::get_sqe()
+{
+  void *sqe = nullptr;
+  const uint32_t head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+  const uint32_t tail = *sq_tail_;
+  if (tail - head < sq_entries_) {
+    const uint32_t idx = tail & *sq_mask_;
+    sqe = static_cast<struct io_uring_sqe *>(sqes_ptr_) + idx;
+    MEMSET(sqe, 0, sizeof(struct io_uring_sqe));
+    sq_array_[idx] = idx;
+  }
+  return sqe;
+}
+
+void ObIOUring::advance_sq_tail()
+{
+  // publish the sqe to kernel
+  __atomic_store_n(sq_tail_, *sq_tail_ + 1, __ATOMIC_RELEASE);
+}
+
+int32_t ObIOUring::get_fixed_file(const int fd)
+{
+  int32_t file_idx = -1;
+  for (int64_t i = 0; file_idx < 0 && i < fixed_file_cnt_; ++i) {
+    if (fd == fixed_files_[i]) {
+      file_idx = static_cast<int32_t>(i);
+    }
+  }
+  if (file_idx < 0 && fixed_file_cnt_ < MAX_FIXED_FILE_CNT) {
+    struct io_uring_files_update update;
+    MEMSET(&update, 0, sizeof(update));
+    update.offset = static_cast<uint32_t>(fixed_file_cnt_);
+    update.fds = reinterpret_cast<uint64_t>(&fd);
+    if (1 != sys_io_uring_register(ring_fd_, IORING_REGISTER_FILES_UPDATE, &update, 1)) {
+      LOG_WARN("register file into io_uring failed", K(errno), K(fd));
+      fixed_file_enabled_ = false;
+    } else {
+      file_idx = static_cast<int32_t>(fixed_file_cnt_);
+      fixed_files_[fixed_file_cnt_++] = fd;
+    }
+  }
+  return file_idx;
+}
+
+int32_t ObIOUring::get_fixed_buffer(const void *buf, const int64_t size) const
+{
+  int32_t buf_idx = -1;
+  const char *begin = static_cast<const char *>(buf);
+  for (int64_t i = 0; buf_idx < 0 && i < fixed_buffer_cnt_; ++i) {
+    const ObFixedBuffer &fixed_buf = fixed_buffers_[i];
+    if (nullptr != fixed_buf.buf_
+        && begin >= fixed_buf.buf_
+        && begin + size <= fixed_buf.buf_ + fixed_buf.size_) {
+      buf_idx = static_cast<int32_t>(i);
+    }
+  }
+  return buf_idx;
+}
+
+int ObIOUring::prep_rw(const bool is_read,
+                       const int fd,
+                       const bool is_stable_fd,
+                       void *buf,
+                       const int64_t size,
+                       const int64_t offset,
+                       void *data)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (OB_UNLIKELY(fd < 0 || nullptr == buf || size <= 0 || size > UINT32_MAX || offset < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(fd), KP(buf), K(size), K(offset));
+  } else {
+    ObSpinLockGuard guard(sq_lock_);
+    struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(get_sqe());
+    if (OB_ISNULL(sqe)) {
+      ret = OB_EAGAIN;
+    } else {
+      const int32_t file_idx = is_stable_fd && fixed_file_enabled_ ? get_fixed_file(fd) : -1;
+      const int32_t buf_idx = fixed_buffer_enabled_ ? get_fixed_buffer(buf, size) : -1;
+      if (buf_idx >= 0) {
+        sqe->opcode = is_read ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+        sqe->buf_index = static_cast<uint16_t>(buf_idx);
+      } else {
+        sqe->opcode = is_read ? IORING_OP_READ : IORING_OP_WRITE;
+      }
+      if (file_idx >= 0) {
+        sqe->fd = file_idx;
+        sqe->flags |= IOSQE_FIXED_FILE;
+      } else {
+        sqe->fd = fd;
+      }
+      sqe->addr = reinterpret_cast<uint64_t>(buf);
+      sqe->len = static_cast<uint32_t>(size);
+      sqe->off = static_cast<uint64_t>(offset);
+      sqe->user_data = reinterpret_cast<uint64_t>(data);
+      advance_sq_tail();
+    }
+  }
+  return ret;
+}
+
+int ObIOUring::prep_nop(void *data)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else {
+    ObSpinLockGuard guard(sq_lock_);
+    struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(get_sqe());
+    if (OB_ISNULL(sqe)) {
+      ret = OB_EAGAIN;
+    } else {
+      sqe->opcode = IORING_OP_NOP;
+      sqe->fd = -1;
+      sqe->user_data = reinterpret_cast<uint64_t>(data);
+      advance_sq_tail();
+    }
+  }
+  return ret;
+}
+
+int ObIOUring::prep_cancel(void *target_data, void *data)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (OB_ISNULL(target_data)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(target_data));
+  } else {
+    ObSpinLockGuard guard(sq_lock_);
+    struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(get_sqe());
+    if (OB_ISNULL(sqe)) {
+      ret = OB_EAGAIN;
+    } else {
+      sqe->opcode = IORING_OP_ASYNC_CANCEL;
+      sqe->fd = -1;
+      sqe->addr = reinterpret_cast<uint64_t>(target_data);
+      sqe->user_data = reinterpret_cast<uint64_t>(data);
+      advance_sq_tail();
+    }
+  }
+  return ret;
+}
+
+uint32_t ObIOUring::get_sq_pending() const
+{
+  return __atomic_load_n(sq_tail_, __ATOMIC_ACQUIRE) - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+}
+
+int ObIOUring::enter(const uint32_t to_submit, const uint32_t min_complete, const uint32_t flags)
+{
+  int ret = OB_SUCCESS;
+  if (sys_io_uring_enter(ring_fd_, to_submit, min_complete, flags) < 0) {
+    if (EINTR == errno) {
+      // retry by caller
+    } else if (EAGAIN == errno || EBUSY == errno) {
+      ret = OB_EAGAIN;
+    } else {
+      ret = OB_IO_ERROR;
+      LOG_WARN("io_uring_enter failed", K(ret), K(errno), K(to_submit), K(min_complete), K(flags));
+    }
+  }
+  return ret;
+}
+
+int ObIOUring::submit()
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (is_sqpoll_) {
+    // the tail store must be visible before checking whether the sq thread is sleeping
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (0 != (__atomic_load_n(sq_flags_, __ATOMIC_RELAXED) & IORING_SQ_NEED_WAKEUP)) {
+      ret = enter(0, 0, IORING_ENTER_SQ_WAKEUP);
+    }
+  } else {
+    // concurrent submitters may flush sqes of each other, which batches syscalls under pressure
+    const uint32_t to_submit = get_sq_pending();
+    if (to_submit > 0) {
+      ret = enter(to_submit, 0, 0);
+    }
+  }
+  return ret;
+}
+
+void ObIOUring::peek_cqes(const int64_t max_cnt, void **datas, int32_t *results, int64_t &cnt)
+{
+  uint32_t head = *cq_head_;
+  const uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+  const struct io_uring_cqe *cqes = static_cast<const struct io_uring_cqe *>(cqes_);
+  while (head != tail && cnt < max_cnt) {
+    const struct io_uring_cqe &cqe = cqes[head & *cq_mask_];
+    datas[cnt] = reinterpret_cast<void *>(cqe.user_data);
+    results[cnt] = cqe.res;
+    ++cnt;
+    ++head;
+  }
+  __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+}
+
+int ObIOUring::reap(const int64_t max_cnt, void **datas, int32_t *results, int64_t &cnt)
+{
+  int ret = OB_SUCCESS;
+  cnt = 0;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (OB_UNLIKELY(max_cnt <= 0 || nullptr == datas || nullptr == results)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(max_cnt), KP(datas), KP(results));
+  } else if (FALSE_IT(peek_cqes(max_cnt, datas, results, cnt))) {
+  } else if (0 == cnt) {
+    // flush sqes left by failed submit and wait in one syscall
+    const uint32_t to_submit = is_sqpoll_ ? 0 : get_sq_pending();
+    if (OB_FAIL(enter(to_submit, 1/*min_complete*/, IORING_ENTER_GETEVENTS))) {
+      LOG_WARN("wait io_uring completion failed", K(ret), K(to_submit));
+    } else {
+      peek_cqes(max_cnt, datas, results, cnt);
+    }
+  }
+  return ret;
+}
+
+#else // OB_HAS_IO_URING
+
+int ObIOUring::init(const uint32_t entries, const bool enable_sqpoll)
+{
+  UNUSEDx(entries, enable_sqpoll);
+  return OB_NOT_SUPPORTED;
+}
+
+void ObIOUring::destroy()
+{
+  is_inited_ = false;
+}
+
+int ObIOUring::register_buffer(void *buf, const int64_t size)
+{
+  UNUSEDx(buf, size);
+  return OB_NOT_SUPPORTED;
+}
+
+int ObIOUring::unregister_buffer(void *buf)
+{
+  UNUSED(buf);
+  return OB_NOT_SUPPORTED;
+}
+
+int ObIOUring::prep_rw(const bool is_read,
+                       const int fd,
+                       const bool is_stable_fd,
+                       void *buf,
+                       const int64_t size,
+                       const int64_t offset,
+                       void *data)
+{
+  UNUSEDx(is_read, fd, is_stable_fd, buf, size, offset, data);
+  return OB_NOT_SUPPORTED;
+}
+
+int ObIOUring::prep_nop(void *data)
+{
+  UNUSED(data);
+  return OB_NOT_SUPPORTED;
+}
+
+int ObIOUring::prep_cancel(void *target_data, void *data)
+{
+  UNUSEDx(target_data, data);
+  return OB_NOT_SUPPORTED;
+}
+
+int ObIOUring::submit()
+{
+  return OB_NOT_SUPPORTED;
+}
+
+int ObIOUring::reap(const int64_t max_cnt, void **datas, int32_t *results, int64_t &cnt)
+{
+  UNUSEDx(max_cnt, datas, results);
+  cnt = 0;
+  return OB_NOT_SUPPORTED;
+}
+
+#endif // OB_HAS_IO_URING
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SHARE_IO_OB_IO_URING_H_
+#define OCEANBASE_SHARE_IO_OB_IO_URING_H_
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+#endif
+// IORING_OP_READ / IORING_OP_WRITE are available since linux 5.6
+#if defined(IORING_FEAT_RW_CUR_POS) && defined(__NR_io_uring_setup)
+#define OB_HAS_IO_URING 1
+#endif
+
+#include "lib/lock/ob_spin_lock.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+/**
+ * io_uring instance driven by raw syscalls, no dependency on liburing.
+ * SQ is filled by multiple submitters under lock, CQ is consumed by a single polling thread.
+ * Stable fds and long-lived io buffers are registered into sparse tables of the ring, so that
+ * the kernel can skip fd lookup and page pinning for each io. Registration is best effort,
+ * io falls back to plain fd and buffer if the kernel does not support it.
+ */
+class ObIOUring final
+{
+public:
+  static const int64_t MAX_FIXED_FILE_CNT = 16;
+  static const int64_t MAX_FIXED_BUFFER_CNT = 64;
+  ObIOUring();
+  ~ObIOUring();
+  int init(const uint32_t entries, const bool enable_sqpoll);
+  void destroy();
+  OB_INLINE bool is_inited() const { return is_inited_; }
+  OB_INLINE bool is_sqpoll() const { return is_sqpoll_; }
+  int register_buffer(void *buf, const int64_t size);
+  int unregister_buffer(void *buf);
+  // Queue one read / write into SQ, @fd is registered when @is_stable_fd, @data is returned on completion
+  int prep_rw(const bool is_read,
+              const int fd,
+              const bool is_stable_fd,
+              void *buf,
+              const int64_t size,
+              const int64_t offset,
+              void *data);
+  // Queue a no-op, used to wake up the polling thread
+  int prep_nop(void *data);
+  // Queue a cancel of the in-flight sqe whose user data is @target_data, the canceled one returns -ECANCELED
+  int prep_cancel(void *target_data, void *data);
+  // Hand queued SQEs to kernel, SQEs left by a failed submit are flushed by the next submit or reap
+  int submit();
+  // Reap at most @max_cnt completions, wait for at least one when CQ is empty
+  int reap(const int64_t max_cnt, void **datas, int32_t *results, int64_t &cnt);
+  TO_STRING_KV(K_(is_inited), K_(ring_fd), K_(sq_entries), K_(cq_entries), K_(is_sqpoll),
+               K_(fixed_file_enabled), K_(fixed_file_cnt), K_(fixed_buffer_enabled), K_(fixed_buffer_cnt));
+private:
+  struct ObFixedBuffer
+  {
+    ObFixedBuffer() : buf_(nullptr), size_(0) {}
+    char *buf_;
+    int64_t size_;
+  };
+  int setup(const uint32_t entries, const bool enable_sqpoll);
+  void register_sparse_tables();
+  // Following functions should be called with sq_lock_ held
+  void *get_sqe();
+  void advance_sq_tail();
+  int32_t get_fixed_file(const int fd);
+  int32_t get_fixed_buffer(const void *buf, const int64_t size) const;
+
+  int enter(const uint32_t to_submit, const uint32_t min_complete, const uint32_t flags);
+  uint32_t get_sq_pending() const;
+  void peek_cqes(const int64_t max_cnt, void **datas, int32_t *results, int64_t &cnt);
+private:
+  static const uint32_t SQPOLL_IDLE_MS = 2000;
+  bool is_inited_;
+  int ring_fd_;
+  uint32_t features_;
+  uint32_t sq_entries_;
+  uint32_t cq_entries_;
+  bool is_sqpoll_;
+  void *sq_ring_ptr_;
+  int64_t sq_ring_size_;
+  void *cq_ring_ptr_;
+  int64_t cq_ring_size_;
+  void *sqes_ptr_;
+  int64_t sqes_size_;
+  uint32_t *sq_head_;
+  uint32_t *sq_tail_;
+  uint32_t *sq_mask_;
+  uint32_t *sq_flags_;
+  uint32_t *sq_array_;
+  uint32_t *cq_head_;
+  uint32_t *cq_tail_;
+  uint32_t *cq_mask_;
+  void *cqes_;
+  ObSpinLock sq_lock_;
+  bool fixed_file_enabled_;
+  int64_t fixed_file_cnt_;
+  int fixed_files_[MAX_FIXED_FILE_CNT];
+  bool fixed_buffer_enabled_;
+  int64_t fixed_buffer_cnt_;
+  ObFixedBuffer fixed_buffers_[MAX_FIXED_BUFFER_CNT];
+  DISALLOW_COPY_AND_ASSIGN(ObIOUring);
+};
+
+} // namespace common
+} // namespace oceanbase
+
+#endif // OCEANBASE_SHARE_IO_OB_IO_URING_H_
@@ -27,6 +27,12 @@ class ObLocalIOCB : public common::ObIOCB
 public:
   ObLocalIOCB() : iocb_() {}
   virtual ~ObLocalIOCB() {}
+  // prepared io, used by io_uring channel
+  OB_INLINE int get_fd() const { return iocb_.aio_fildes; }
+  OB_INLINE bool is_read() const { return IO_CMD_PREAD == iocb_.aio_lio_opcode; }
+  OB_INLINE void *get_buf() const { return iocb_.u.c.buf; }
+  OB_INLINE int64_t get_size() const { return static_cast<int64_t>(iocb_.u.c.nbytes); }
+  OB_INLINE int64_t get_offset() const { return iocb_.u.c.offset; }
 private:
   friend class ObLocalDevice;
   struct iocb iocb_;
@@ -73,7 +73,8 @@ const uint64_t ObUpgradeChecker::UPGRADE_PATH[CLUTER_VERSION_NUM] = {
   CALC_CLUSTER_VERSION(3UL, 2UL, 0UL, 1UL),  // 3.2.1
   CALC_CLUSTER_VERSION(3UL, 2UL, 0UL, 2UL),  // 3.2.2
   CALC_CLUSTER_VERSION(3UL, 2UL, 3UL, 0UL),  // 3.2.3.0
-  CALC_CLUSTER_VERSION(4UL, 0UL, 0UL, 0UL)   // 4.0.0.0
+  CALC_CLUSTER_VERSION(4UL, 0UL, 0UL, 0UL),  // 4.0.0.0
+  CALC_CLUSTER_VERSION(4UL, 1UL, 0UL, 0UL)   // 4.1.0.0
 };
 
 bool ObUpgradeChecker::check_cluster_version_exist(
@@ -901,6 +902,7 @@ int ObUpgradeProcesserSet::init(
     INIT_PROCESSOR_BY_VERSION(3, 2, 0, 2);
     INIT_PROCESSOR_BY_VERSION(3, 2, 3, 0);
     INIT_PROCESSOR_BY_VERSION(4, 0, 0, 0);
+    INIT_PROCESSOR_BY_VERSION(4, 1, 0, 0);
 #undef INIT_PROCESSOR_BY_VERSION
     inited_ = true;
   }
@@ -193,7 +193,7 @@ class ObUpgradeChecker
 public:
   static bool check_cluster_version_exist(const uint64_t version);
 public:
-  static const int64_t CLUTER_VERSION_NUM = 40;
+  static const int64_t CLUTER_VERSION_NUM = 41;
   static const uint64_t UPGRADE_PATH[CLUTER_VERSION_NUM];
 };
 
@@ -334,6 +334,7 @@ private:
       const lib::Worker::CompatMode compat_mode,
       const uint64_t tenant_id);
 };
+DEF_SIMPLE_UPGRARD_PROCESSER(4, 1, 0, 0);
 
 /* =========== upgrade processor end ============= */
 
@@ -428,6 +428,11 @@ public:
     UNUSED(column_descs);
     return common::OB_NOT_SUPPORTED;
   }
+  virtual int check_if_oracle_compat_mode(bool &is_oracle_mode) const
+  {
+    UNUSED(is_oracle_mode);
+    return common::OB_NOT_SUPPORTED;
+  }
   DECLARE_PURE_VIRTUAL_TO_STRING;
   const static int64_t INVAID_RET = -1;
   static common::ObString EMPTY_STRING;
@@ -566,7 +566,9 @@ int ObStaticEngineCG::check_vectorize_supported(bool &support,
       if (OB_FAIL(get_phy_op_type(*op, type, is_root_job))) {
         LOG_WARN("failed to get_phy_op_type", K(op), K(type));
       } else {
-      if (ObOperatorFactory::is_vectorized(type)) {
+      // DML operator only follows the vectorization of its children (e.g. INSERT ... SELECT),
+      // it does not turn on vectorization for plans like INSERT ... VALUES by itself.
+      if (ObOperatorFactory::is_vectorized(type) && !op->is_dml_operator()) {
         support = true;
       }
       // Additional check to overwrite support value
@@ -3867,6 +3869,7 @@ int ObStaticEngineCG::generate_spec(ObLogJoin &op, ObHashJoinSpec &spec, const b
   }
   spec.is_shared_ht_ = HASH_JOIN == op.get_join_algo()
                     && DIST_BC2HOST_NONE == op.get_join_distributed_method();
+  spec.disable_cache_aware_ = op.is_cache_aware_hash_join_disabled();
   OZ (generate_join_spec(op, spec));
   return ret;
 }
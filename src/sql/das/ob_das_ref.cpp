@@ -217,6 +217,10 @@ int ObDASRef::execute_all_task()
   bool DAS_TASK_AGGREGATION = false;
   if (DAS_TASK_AGGREGATION) {
     // TODO(roland.qk): DAS task aggregation.
+  } else if (MTL(ObDataAccessService*)->need_async_execute(*this)) {
+    if (OB_FAIL(MTL(ObDataAccessService*)->execute_all_task_async(*this))) {
+      LOG_WARN("execute all das task async failed", K(ret));
+    }
   } else {
     DASTaskIter task_iter = begin_task_iter();
     while (OB_SUCC(ret) && !task_iter.is_end()) {
@@ -21,11 +21,12 @@ namespace oceanbase
 {
 namespace sql
 {
-int ObDASSyncAccessP::init()
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::init()
 {
   int ret = OB_SUCCESS;
-  ObDASTaskArg &task = arg_;
-  ObDASSyncAccessP::get_das_factory() = &das_factory_;
+  ObDASTaskArg &task = this->arg_;
+  get_das_access_factory() = &das_factory_;
   das_remote_info_.exec_ctx_ = &exec_ctx_;
   das_remote_info_.frame_info_ = &frame_info_;
   task.set_remote_info(&das_remote_info_);
@@ -33,21 +34,22 @@ int ObDASSyncAccessP::init()
   return ret;
 }
 
-int ObDASSyncAccessP::before_process()
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::before_process()
 {
   int ret = OB_SUCCESS;
-  ObDASTaskArg &task = arg_;
-  ObDASTaskResp &task_resp = result_;
+  ObDASTaskArg &task = this->arg_;
+  ObDASTaskResp &task_resp = this->result_;
   ObIDASTaskResult *task_result = nullptr;
   ObMemAttr mem_attr;
   mem_attr.tenant_id_ = task.get_task_op()->get_tenant_id();
   mem_attr.label_ = "DASRpcPCtx";
   exec_ctx_.get_allocator().set_attr(mem_attr);
-  ObDASTaskFactory *das_factory = ObDASSyncAccessP::get_das_factory();
+  ObDASTaskFactory *das_factory = get_das_access_factory();
   if (OB_ISNULL(das_factory)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("das factory is not inited", K(ret));
-  } else if (OB_FAIL(ObDASSyncRpcProcessor::before_process())) {
+  } else if (OB_FAIL(RpcProcessor::before_process())) {
     LOG_WARN("do rpc processor before_process failed", K(ret));
   } else if (das_remote_info_.need_calc_udf_ &&
       OB_FAIL(GCTX.schema_service_->get_tenant_schema_guard(MTL_ID(), schema_guard_))) {
@@ -65,11 +67,12 @@ int ObDASSyncAccessP::before_process()
   return ret;
 }
 
-int ObDASSyncAccessP::process()
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::process()
 {
   int ret = OB_SUCCESS;
-  ObDASTaskArg &task = arg_;
-  ObDASTaskResp &task_resp = result_;
+  ObDASTaskArg &task = this->arg_;
+  ObDASTaskResp &task_resp = this->result_;
   ObIDASTaskOp *task_op = task.get_task_op();
   ObIDASTaskResult *task_result = task_resp.get_op_result();
   bool has_more = false;
@@ -125,28 +128,33 @@ int ObDASSyncAccessP::process()
   return OB_SUCCESS;
 }
 
-int ObDASSyncAccessP::after_process(int error_code)
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::after_process(int error_code)
 {
   int ret = OB_SUCCESS;
-  if (OB_FAIL(ObDASSyncRpcProcessor::after_process(error_code))) {
+  if (OB_FAIL(RpcProcessor::after_process(error_code))) {
     LOG_WARN("do das sync base rpc process failed", K(ret));
   }
   //执行相关的错误信息不用传递给RPC框架，RPC框架不处理具体的RPC执行错误信息，始终返回OB_SUCCESS
   return OB_SUCCESS;
 }
 
-void ObDASSyncAccessP::cleanup()
+template <obrpc::ObRpcPacketCode pcode>
+void ObDASBaseAccessP<pcode>::cleanup()
 {
   ObActiveSessionGuard::setup_default_ash();
   das_factory_.cleanup();
-  ObDASSyncAccessP::get_das_factory() = nullptr;
+  get_das_access_factory() = nullptr;
   if (das_remote_info_.trans_desc_ != nullptr) {
     MTL(transaction::ObTransService*)->release_tx(*das_remote_info_.trans_desc_);
     das_remote_info_.trans_desc_ = nullptr;
   }
-  ObDASSyncRpcProcessor::cleanup();
+  RpcProcessor::cleanup();
 }
 
+template class ObDASBaseAccessP<obrpc::OB_DAS_SYNC_ACCESS>;
+template class ObDASBaseAccessP<obrpc::OB_DAS_ASYNC_ACCESS>;
+
 int ObDASSyncFetchP::process()
 {
   int ret = OB_SUCCESS;
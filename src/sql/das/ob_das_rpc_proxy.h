@@ -27,6 +27,8 @@ public:
   virtual ~ObDASRpcProxy() {}
   //stream rpc interface
   RPC_S(@PR5 remote_sync_access, obrpc::OB_DAS_SYNC_ACCESS, (sql::ObDASTaskArg), sql::ObDASTaskResp);
+  // async rpc interface, used to send remote das tasks to multiple servers concurrently
+  RPC_AP(@PR5 remote_async_access, obrpc::OB_DAS_ASYNC_ACCESS, (sql::ObDASTaskArg), sql::ObDASTaskResp);
   // sync rpc for das task result
   RPC_S(@PR5 sync_fetch_das_result, obrpc::OB_DAS_SYNC_FETCH_RESULT, (sql::ObDASDataFetchReq), sql::ObDASDataFetchRes);
   // async rpc to erase das task result
@@ -28,6 +28,56 @@ using namespace common;
 using namespace transaction;
 namespace sql
 {
+int ObDASAsyncAccessCB::process()
+{
+  ObThreadCondGuard guard(cond_);
+  int ret = OB_SUCCESS;
+  is_processed_ = true;
+  ret = cond_.broadcast();
+  return ret;
+}
+
+void ObDASAsyncAccessCB::on_invalid()
+{
+  ObThreadCondGuard guard(cond_);
+  int ret = OB_SUCCESS;
+  is_invalid_ = true;
+  ret = cond_.broadcast();
+  LOG_WARN("ObDASAsyncAccessCB invalid, check object serialization impl or oom",
+           K(trace_id_), K(ret));
+}
+
+void ObDASAsyncAccessCB::on_timeout()
+{
+  ObThreadCondGuard guard(cond_);
+  int ret = OB_SUCCESS;
+  is_timeout_ = true;
+  ret = cond_.broadcast();
+  LOG_WARN("ObDASAsyncAccessCB timeout, check timeout value, peer cpu load, network "
+           "packet drop rate", K(trace_id_), K(ret));
+}
+
+rpc::frame::ObReqTransport::AsyncCB *ObDASAsyncAccessCB::clone(const rpc::frame::SPAlloc &alloc) const
+{
+  UNUSED(alloc);
+  //the callback is owned by ObDASAsyncAccessCtx, which waits for all the responses
+  return const_cast<rpc::frame::ObReqTransport::AsyncCB *>(
+      static_cast<const rpc::frame::ObReqTransport::AsyncCB *const>(this));
+}
+
+void ObDASAsyncAccessCtx::destroy()
+{
+  for (int64_t i = 0; i < callbacks_.count(); ++i) {
+    if (OB_NOT_NULL(callbacks_.at(i))) {
+      callbacks_.at(i)->~ObDASAsyncAccessCB();
+    }
+  }
+  callbacks_.reset();
+  allocator_.reset();
+  inflight_size_ = 0;
+  finished_cnt_ = 0;
+}
+
 ObDataAccessService &ObDataAccessService::get_instance()
 {
   static ObDataAccessService instance;
@@ -82,6 +132,15 @@ int ObDataAccessService::execute_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_
     task_op.errcode_ = ret;
   }
   OB_ASSERT(task_op.errcode_ == ret);
+  if (OB_FAIL(ret)) {
+    ret = try_retry_das_task(das_ref, task_op);
+  }
+  return ret;
+}
+
+int ObDataAccessService::try_retry_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op)
+{
+  int ret = task_op.errcode_;
   if (OB_FAIL(ret) && GCONF._enable_partition_level_retry && task_op.can_part_retry()) {
     //only fast select can be retry with partition level
     int tmp_ret = retry_das_task(das_ref, task_op);
@@ -94,6 +153,212 @@ int ObDataAccessService::execute_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_
   return ret;
 }
 
+bool ObDataAccessService::need_async_execute(ObDASRef &das_ref) const
+{
+  bool bret = false;
+  if (GCONF._enable_das_async_access && !das_ref.is_execute_directly()) {
+    //it is worth to wait the async callbacks only if two remote tasks at least can overlap
+    int64_t remote_task_cnt = 0;
+    DASTaskIter task_iter = das_ref.begin_task_iter();
+    while (remote_task_cnt < 2 && !task_iter.is_end()) {
+      if (can_async_execute(**task_iter)) {
+        ++remote_task_cnt;
+      }
+      ++task_iter;
+    }
+    bret = (remote_task_cnt >= 2);
+  }
+  return bret;
+}
+
+bool ObDataAccessService::can_async_execute(const ObIDASTaskOp &task_op) const
+{
+  //the results of the das dml op are decoded with the das allocator of the sql thread,
+  //only the scan results own their memory and can be decoded in the rpc io thread
+  return !IS_DAS_DML_OP(task_op)
+      && task_op.get_tablet_loc() != nullptr
+      && task_op.get_tablet_loc()->server_ != ctrl_addr_;
+}
+
+int ObDataAccessService::execute_all_task_async(ObDASRef &das_ref)
+{
+  int ret = OB_SUCCESS;
+  const int64_t max_inflight_size = GCONF._das_async_access_max_inflight_size;
+  ObDASAsyncAccessCtx async_ctx;
+  DASTaskIter task_iter = das_ref.begin_task_iter();
+  while (OB_SUCC(ret) && !task_iter.is_end()) {
+    ObIDASTaskOp &task_op = **task_iter;
+    if (!can_async_execute(task_op)) {
+      //the local and dml tasks are executed while the remote ones are in flight
+      if (OB_FAIL(execute_das_task(das_ref, task_op))) {
+        LOG_WARN("execute das task failed", K(ret), K(task_op));
+      }
+    } else {
+      while (OB_SUCC(ret) && async_ctx.inflight_size_ >= max_inflight_size && !async_ctx.all_finished()) {
+        if (OB_FAIL(wait_async_das_task(das_ref, async_ctx))) {
+          LOG_WARN("wait async das task failed", K(ret), K(async_ctx));
+        }
+      }
+      if (OB_SUCC(ret) && OB_FAIL(launch_async_das_task(das_ref, task_op, async_ctx))) {
+        LOG_WARN("launch async das task failed", K(ret), K(task_op));
+      }
+    }
+    ++task_iter;
+  }
+  //the callbacks refer to the das task ops and async_ctx,
+  //so all of them must be answered before return, even if some task failed
+  while (!async_ctx.all_finished()) {
+    int wait_ret = wait_async_das_task(das_ref, async_ctx);
+    if (OB_SUCCESS != wait_ret) {
+      LOG_WARN("wait async das task failed", K(ret), K(wait_ret), K(async_ctx));
+    }
+    ret = COVER_SUCC(wait_ret);
+  }
+  return ret;
+}
+
+int ObDataAccessService::launch_async_das_task(ObDASRef &das_ref,
+                                               ObIDASTaskOp &task_op,
+                                               ObDASAsyncAccessCtx &async_ctx)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  ObPhysicalPlanCtx *plan_ctx = das_ref.get_exec_ctx().get_physical_plan_ctx();
+  int64_t timeout = plan_ctx->get_timeout_timestamp() - ObTimeUtility::current_time();
+  uint64_t tenant_id = session->get_rpc_tenant_id();
+  ObCurTraceId::TraceId *trace_id = ObCurTraceId::get_trace_id();
+  ObIDASTaskResult *op_result = nullptr;
+  ObDASAsyncAccessCB *cb = nullptr;
+  void *buf = nullptr;
+  ObDASTaskArg task_arg;
+  ObDASRemoteInfo remote_info;
+  remote_info.exec_ctx_ = &das_ref.get_exec_ctx();
+  remote_info.frame_info_ = das_ref.get_expr_frame_info();
+  remote_info.trans_desc_ = session->get_tx_desc();
+  remote_info.snapshot_ = *task_op.get_snapshot();
+  remote_info.need_tx_ = (remote_info.trans_desc_ != nullptr);
+  //the request is serialized before remote_async_access returns,
+  //so the remote info on the stack is enough
+  task_arg.set_remote_info(&remote_info);
+  ObDASRemoteInfo::get_remote_info() = &remote_info;
+  if (OB_FAIL(task_arg.add_task_op(&task_op))) {
+    LOG_WARN("failed to add das task op", K(ret), K(task_op));
+  } else if (FALSE_IT(task_arg.set_timeout_ts(session->get_query_timeout_ts()))) {
+  } else if (FALSE_IT(task_arg.set_ctrl_svr(ctrl_addr_))) {
+  } else if (FALSE_IT(task_arg.get_runner_svr() = task_op.tablet_loc_->server_)) {
+  } else if (OB_FAIL(collect_das_task_info(task_arg, remote_info))) {
+    LOG_WARN("collect das task info failed", K(ret));
+  } else if (OB_UNLIKELY(timeout <= 0)) {
+    ret = OB_TIMEOUT;
+    LOG_WARN("das is timeout", K(ret), K(plan_ctx->get_timeout_timestamp()), K(timeout));
+  } else if (OB_ISNULL(trace_id)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("fail to get trace id", K(ret));
+  } else if (OB_ISNULL(buf = async_ctx.allocator_.alloc(sizeof(ObDASAsyncAccessCB)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc memory failed", K(ret), "size", sizeof(ObDASAsyncAccessCB));
+  } else if (FALSE_IT(cb = new(buf) ObDASAsyncAccessCB(async_ctx.cond_,
+                                                       &task_op,
+                                                       task_arg.get_serialize_size(),
+                                                       *trace_id))) {
+  } else if (OB_FAIL(das_ref.get_das_factory().create_das_task_result(task_op.get_type(), op_result))) {
+    LOG_WARN("create das task result failed", K(ret));
+  } else if (OB_FAIL(op_result->init(task_op))) {
+    LOG_WARN("init task result failed", K(ret));
+  } else if (OB_FAIL(cb->get_task_resp().add_op_result(op_result))) {
+    LOG_WARN("failed to add op result", K(ret));
+  } else if (OB_FAIL(async_ctx.callbacks_.push_back(cb))) {
+    LOG_WARN("store async das callback failed", K(ret));
+  } else if (OB_FAIL(das_rpc_proxy_
+                     .to(task_arg.get_runner_svr())
+                     .by(tenant_id)
+                     .timeout(timeout)
+                     .remote_async_access(task_arg, cb))) {
+    LOG_WARN("rpc remote async access failed", K(ret), K(task_arg));
+    //the callback will never be invoked once the request is not posted
+    async_ctx.callbacks_.pop_back();
+    // RPC fail, add task's LSID to trans_result
+    // indicate some transaction participant may touched
+    session->get_trans_result().add_touched_ls(task_op.get_ls_id());
+  } else {
+    async_ctx.inflight_size_ += cb->get_req_size();
+    cb = nullptr;
+  }
+  if (OB_NOT_NULL(cb)) {
+    cb->~ObDASAsyncAccessCB();
+    cb = nullptr;
+  }
+  if (OB_FAIL(ret)) {
+    //the task is not in flight, it is retried at once like a failed sync task
+    task_op.errcode_ = ret;
+    ret = try_retry_das_task(das_ref, task_op);
+  }
+  return ret;
+}
+
+int ObDataAccessService::wait_async_das_task(ObDASRef &das_ref, ObDASAsyncAccessCtx &async_ctx)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObDASAsyncAccessCB*, 8> finished_cbs;
+  {
+    ObThreadCondGuard guard(async_ctx.cond_);
+    for (int64_t i = 0; OB_SUCC(ret) && i < async_ctx.callbacks_.count(); ++i) {
+      ObDASAsyncAccessCB *cb = async_ctx.callbacks_.at(i);
+      if (!cb->is_visited() && cb->is_finished()) {
+        if (OB_FAIL(finished_cbs.push_back(cb))) {
+          LOG_WARN("store finished callback failed", K(ret));
+        } else {
+          cb->set_visited(true);
+        }
+      }
+    }
+    if (OB_SUCC(ret) && finished_cbs.empty()) {
+      // wait for timeout or until notified.
+      async_ctx.cond_.wait_us(500);
+    }
+  }
+  //merge the responses out of the lock, so that the rpc io threads are not blocked
+  for (int64_t i = 0; i < finished_cbs.count(); ++i) {
+    ObDASAsyncAccessCB *cb = finished_cbs.at(i);
+    int tmp_ret = process_async_task_resp(das_ref, *cb);
+    if (OB_SUCCESS != tmp_ret) {
+      LOG_WARN("process async das task response failed", K(tmp_ret), KPC(cb));
+    }
+    ret = COVER_SUCC(tmp_ret);
+    async_ctx.inflight_size_ -= cb->get_req_size();
+    ++async_ctx.finished_cnt_;
+  }
+  return ret;
+}
+
+int ObDataAccessService::process_async_task_resp(ObDASRef &das_ref, ObDASAsyncAccessCB &cb)
+{
+  int ret = OB_SUCCESS;
+  ObIDASTaskOp &task_op = *cb.get_task_op();
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  if (cb.is_timeout()) {
+    ret = OB_TIMEOUT;
+    LOG_WARN("async das task is timeout", K(ret), K(cb));
+  } else if (cb.is_invalid()) {
+    ret = OB_RPC_PACKET_INVALID;
+    LOG_WARN("async das task response is invalid", K(ret), K(cb));
+  } else if (OB_FAIL(cb.get_ret_code().rcode_)) {
+    LOG_WARN("rpc remote async access failed", K(ret), K(cb));
+  }
+  if (OB_FAIL(ret)) {
+    // RPC fail, add task's LSID to trans_result
+    // indicate some transaction participant may touched
+    session->get_trans_result().add_touched_ls(task_op.get_ls_id());
+  } else if (OB_FAIL(process_remote_task_resp(das_ref, task_op, cb.get_task_resp()))) {
+    LOG_WARN("process remote das task response failed", K(ret), K(task_op));
+  }
+  task_op.errcode_ = ret;
+  if (OB_FAIL(ret)) {
+    ret = try_retry_das_task(das_ref, task_op);
+  }
+  return ret;
+}
+
 int ObDataAccessService::get_das_task_id(int64_t &das_id)
 {
   int ret = OB_SUCCESS;
@@ -280,7 +545,6 @@ int ObDataAccessService::do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &tas
   uint64_t tenant_id = session->get_rpc_tenant_id();
   ObIDASTaskOp *task_op = task_arg.get_task_op();
   ObIDASTaskResult *op_result = nullptr;
-  ObDASExtraData *extra_result = nullptr;
   ObDASRemoteInfo remote_info;
   remote_info.exec_ctx_ = &das_ref.get_exec_ctx();
   remote_info.frame_info_ = das_ref.get_expr_frame_info();
@@ -312,29 +576,41 @@ int ObDataAccessService::do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &tas
       // RPC fail, add task's LSID to trans_result
       // indicate some transaction participant may touched
       session->get_trans_result().add_touched_ls(task_op->get_ls_id());
-    } else {
-      ObDASUtils::log_user_error_and_warn(task_resp.get_rcode());
-      if (OB_FAIL(task_resp.get_err_code())) {
-        LOG_WARN("error occurring in remote das task", K(ret), K(task_arg));
-      } else if (OB_FAIL(task_op->decode_task_result(op_result))) {
-        LOG_WARN("decode das task result failed", K(ret));
-      } else if (task_resp.has_more()
-                  && OB_FAIL(setup_extra_result(das_ref, task_resp,
-                  task_op, extra_result))) {
-        LOG_WARN("setup extra result failed", KR(ret));
-      } else if (task_resp.has_more() && OB_FAIL(op_result->link_extra_result(*extra_result))) {
-        LOG_WARN("link extra result failed", K(ret));
-      }
-      if (OB_NOT_NULL(session->get_tx_desc())) {
-        int tmp_ret = MTL(transaction::ObTransService*)
-          ->add_tx_exec_result(*session->get_tx_desc(),
-                                task_resp.get_trans_result());
-        if (tmp_ret != OB_SUCCESS) {
-          LOG_WARN("merge response partition failed", K(ret), K(tmp_ret), K(task_resp));
-        }
-        ret = COVER_SUCC(tmp_ret);
-      }
+    } else if (OB_FAIL(process_remote_task_resp(das_ref, *task_op, task_resp))) {
+      LOG_WARN("process remote das task response failed", K(ret), K(task_arg));
+    }
+  }
+  return ret;
+}
+
+int ObDataAccessService::process_remote_task_resp(ObDASRef &das_ref,
+                                                  ObIDASTaskOp &task_op,
+                                                  ObDASTaskResp &task_resp)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  ObIDASTaskResult *op_result = task_resp.get_op_result();
+  ObDASExtraData *extra_result = nullptr;
+  ObDASUtils::log_user_error_and_warn(task_resp.get_rcode());
+  if (OB_FAIL(task_resp.get_err_code())) {
+    LOG_WARN("error occurring in remote das task", K(ret), K(task_op));
+  } else if (OB_FAIL(task_op.decode_task_result(op_result))) {
+    LOG_WARN("decode das task result failed", K(ret));
+  } else if (task_resp.has_more()
+              && OB_FAIL(setup_extra_result(das_ref, task_resp,
+              &task_op, extra_result))) {
+    LOG_WARN("setup extra result failed", KR(ret));
+  } else if (task_resp.has_more() && OB_FAIL(op_result->link_extra_result(*extra_result))) {
+    LOG_WARN("link extra result failed", K(ret));
+  }
+  if (OB_NOT_NULL(session->get_tx_desc())) {
+    int tmp_ret = MTL(transaction::ObTransService*)
+      ->add_tx_exec_result(*session->get_tx_desc(),
+                            task_resp.get_trans_result());
+    if (tmp_ret != OB_SUCCESS) {
+      LOG_WARN("merge response partition failed", K(ret), K(tmp_ret), K(task_resp));
     }
+    ret = COVER_SUCC(tmp_ret);
   }
   return ret;
 }
@@ -13,6 +13,8 @@
 #ifndef OBDEV_SRC_SQL_DAS_OB_DATA_ACCESS_SERVICE_H_
 #define OBDEV_SRC_SQL_DAS_OB_DATA_ACCESS_SERVICE_H_
 #include "share/ob_define.h"
+#include "lib/lock/ob_thread_cond.h"
+#include "lib/profile/ob_trace_id.h"
 #include "sql/das/ob_das_rpc_proxy.h"
 #include "sql/das/ob_das_id_cache.h"
 #include "sql/das/ob_das_task_result.h"
@@ -25,6 +27,81 @@ class ObDASTaskArg;
 class ObDASTaskResp;
 class ObPhyTableLocation;
 class ObDASExtraData;
+
+class ObDASAsyncAccessCB
+    : public obrpc::ObDASRpcProxy::AsyncCB<obrpc::OB_DAS_ASYNC_ACCESS>
+{
+public:
+  ObDASAsyncAccessCB(common::ObThreadCond &cond,
+                     ObIDASTaskOp *task_op,
+                     int64_t req_size,
+                     const common::ObCurTraceId::TraceId &trace_id)
+    : is_processed_(false),
+      is_timeout_(false),
+      is_invalid_(false),
+      is_visited_(false),
+      cond_(cond),
+      task_op_(task_op),
+      req_size_(req_size),
+      trace_id_(trace_id)
+  { }
+  virtual ~ObDASAsyncAccessCB() { }
+  virtual int process() override;
+  virtual void on_invalid() override;
+  virtual void on_timeout() override;
+  virtual rpc::frame::ObReqTransport::AsyncCB *clone(const rpc::frame::SPAlloc &alloc) const override;
+  virtual void set_args(const AsyncCB::Request &arg) override { UNUSED(arg); }
+  ObDASTaskResp &get_task_resp() { return result_; }
+  const obrpc::ObRpcResultCode &get_ret_code() const { return rcode_; }
+  ObIDASTaskOp *get_task_op() const { return task_op_; }
+  int64_t get_req_size() const { return req_size_; }
+  //the following flags must be accessed with cond_ locked
+  bool is_finished() const { return is_processed_ || is_timeout_ || is_invalid_; }
+  bool is_processed() const { return is_processed_; }
+  bool is_timeout() const { return is_timeout_; }
+  bool is_invalid() const { return is_invalid_; }
+  bool is_visited() const { return is_visited_; }
+  void set_visited(bool value) { is_visited_ = value; }
+  TO_STRING_KV(KP_(task_op), K_(req_size), K_(is_processed), K_(is_timeout),
+               K_(is_invalid), K_(is_visited), K_(rcode));
+private:
+  //set by the rpc io thread once the response or the error arrives
+  bool is_processed_;
+  bool is_timeout_;
+  bool is_invalid_;
+  //set by the sql thread once the response has been merged into the das task op
+  bool is_visited_;
+  common::ObThreadCond &cond_;
+  ObIDASTaskOp *task_op_;
+  int64_t req_size_;
+  common::ObCurTraceId::TraceId trace_id_;
+};
+
+//the remote das tasks of one ObDASRef which are in flight at the same time
+struct ObDASAsyncAccessCtx
+{
+public:
+  ObDASAsyncAccessCtx()
+    : allocator_("DASAsyncCB", common::OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID()),
+      callbacks_(),
+      inflight_size_(0),
+      finished_cnt_(0)
+  {
+    cond_.init(common::ObWaitEventIds::DEFAULT_COND_WAIT);
+  }
+  ~ObDASAsyncAccessCtx() { destroy(); }
+  void destroy();
+  bool all_finished() const { return finished_cnt_ >= callbacks_.count(); }
+  TO_STRING_KV(K_(inflight_size), K_(finished_cnt), "cb_cnt", callbacks_.count());
+public:
+  common::ObArenaAllocator allocator_;
+  common::ObSEArray<ObDASAsyncAccessCB*, 8> callbacks_;
+  //the serialized size of the requests which have been sent out but not answered
+  int64_t inflight_size_;
+  int64_t finished_cnt_;
+  common::ObThreadCond cond_;
+};
+
 class ObDataAccessService
 {
 public:
@@ -39,6 +116,10 @@ public:
            const common::ObAddr &self_addr);
   //开启DAS Task分区相关的事务控制，并执行task对应的op
   int execute_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
+  //send all the remote scan tasks of das_ref with async rpc and wait for all of them,
+  //the other tasks are executed one by one while the remote ones are in flight
+  int execute_all_task_async(ObDASRef &das_ref);
+  bool need_async_execute(ObDASRef &das_ref) const;
   //关闭DAS Task的执行流程，并释放task持有的资源，并结束相关的事务控制
   int end_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
   int get_das_task_id(int64_t &das_id);
@@ -51,8 +132,20 @@ private:
   int clear_task_exec_env(ObDASRef &das_ref, ObIDASTaskOp &task_op);
   int refresh_partition_location(ObDASRef &das_ref, ObIDASTaskOp &task_op);
   int retry_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
+  //retry the task failed with task_op.errcode_ if it can be retried with partition level,
+  //shared by the sync and async execution
+  int try_retry_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
   int do_local_das_task(ObDASRef &das_ref, ObDASTaskArg &task_arg);
   int do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &das_task);
+  int process_remote_task_resp(ObDASRef &das_ref,
+                               ObIDASTaskOp &task_op,
+                               ObDASTaskResp &task_resp);
+  bool can_async_execute(const ObIDASTaskOp &task_op) const;
+  int launch_async_das_task(ObDASRef &das_ref,
+                            ObIDASTaskOp &task_op,
+                            ObDASAsyncAccessCtx &async_ctx);
+  int wait_async_das_task(ObDASRef &das_ref, ObDASAsyncAccessCtx &async_ctx);
+  int process_async_task_resp(ObDASRef &das_ref, ObDASAsyncAccessCB &cb);
   int setup_extra_result(ObDASRef &das_ref,
                          ObDASTaskResp &task_resp,
                          ObIDASTaskOp *task_op,
@@ -627,6 +627,7 @@ public:
                         const ObDatum &src_cell,
                         const bool is_number/*false*/);
   static int get_llc_size();
+  static int llc_add_value(const uint64_t value, const common::ObString &llc_bitmap_buf);
 
   typedef int (ObAggregateProcessor::*process_fun)(GroupRow &group_row);
   typedef int (ObAggregateProcessor::*collect_fun)(const int64_t group_id, const ObExpr *diff_expr);
@@ -847,7 +848,6 @@ private:
   static uint64_t llc_calc_hash_value(const ObChunkDatumStore::StoredRow &stored_row,
                                       const ObIArray<ObExpr *> &param_exprs,
                                       bool &has_null_cell);
-  static int llc_add_value(const uint64_t value, const common::ObString &llc_bitmap_buf);
   static int llc_add(ObDatum &result, const ObDatum &new_value);
   void set_expr_datum_null(ObExpr *expr);
 
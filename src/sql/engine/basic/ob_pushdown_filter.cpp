@@ -16,6 +16,7 @@
 #include "sql/engine/ob_exec_context.h"
 #include "sql/resolver/expr/ob_raw_expr_util.h"
 #include "sql/code_generator/ob_static_engine_cg.h"
+#include "sql/engine/expr/ob_expr_like.h"
 #include "storage/blocksstable/encoding/ob_encoding_query_util.h"
 #include "storage/blocksstable/ob_datum_row.h"
 
@@ -104,7 +105,8 @@ const common::ObCmpOp ObPushdownWhiteFilterNode::WHITE_OP_TO_CMP_OP[] = {
   CO_MAX, // WHITE_OP_BT
   CO_MAX, // WHITE_OP_IN
   CO_MAX, // WHITE_OP_NU
-  CO_MAX  // WHITE_OP_NN
+  CO_MAX, // WHITE_OP_NN
+  CO_MAX  // WHITE_OP_LI
 };
 
 int ObPushdownWhiteFilterNode::set_op_type(const ObItemType &type)
@@ -138,6 +140,9 @@ int ObPushdownWhiteFilterNode::set_op_type(const ObItemType &type)
     case T_FUN_SYS_ISNULL:
       op_type_ = WHITE_OP_NU;
       break;
+    case T_OP_LIKE:
+      op_type_ = WHITE_OP_LI;
+      break;
     default:
       ret = OB_ERR_UNEXPECTED;
       break;
@@ -183,6 +188,21 @@ int ObPushdownFilterConstructor::is_white_mode(const ObRawExpr* raw_expr, bool &
       case T_FUN_SYS_ISNULL:
         is_white = true;
         break;
+      case T_OP_LIKE: {
+        // like of string column in mysql mode, the pattern should be in collation of the column,
+        // escape validation of oracle mode is left to the expr.
+        // observer before 4.1 can not execute WHITE_OP_LI, keep it black during upgrade
+        const ObRawExpr *col_expr = raw_expr->get_param_expr(0);
+        const ObRawExpr *pattern_expr = raw_expr->get_param_expr(1);
+        is_white = GET_MIN_CLUSTER_VERSION() >= CLUSTER_VERSION_4_1_0_0
+            && !lib::is_oracle_mode()
+            && 3 == raw_expr->get_param_count()
+            && col_expr->get_result_type().is_varchar_or_char()
+            && pattern_expr->get_result_type().is_varchar_or_char()
+            && col_expr->get_result_type().get_collation_type()
+                == pattern_expr->get_result_type().get_collation_type();
+        break;
+      }
       default:
         break;
     }
@@ -977,6 +997,8 @@ int ObWhiteFilterExecutor::init_evaluated_datums()
     check_null_params();
     if (WHITE_OP_IN == filter_.get_op_type() && OB_FAIL(init_obj_set())) {
       LOG_WARN("Failed to init Object hash set in filter node", K(ret));
+    } else if (WHITE_OP_LI == filter_.get_op_type() && OB_FAIL(init_like_pattern())) {
+      LOG_WARN("Failed to init like pattern in filter node", K(ret));
     }
   }
   return ret;
@@ -985,7 +1007,9 @@ int ObWhiteFilterExecutor::init_evaluated_datums()
 void ObWhiteFilterExecutor::check_null_params()
 {
   null_param_contained_ = false;
-  for (int64_t i = 0; !null_param_contained_ && i < params_.count(); i++) {
+  // null escape of like is replaced by the default one
+  const int64_t check_count = WHITE_OP_LI == filter_.get_op_type() ? 1 : params_.count();
+  for (int64_t i = 0; !null_param_contained_ && i < check_count && i < params_.count(); i++) {
     if ((lib::is_mysql_mode() && params_.at(i).is_null())
         || (lib::is_oracle_mode() && params_.at(i).is_null_oracle())) {
       null_param_contained_ = true;
@@ -1015,6 +1039,89 @@ int ObWhiteFilterExecutor::init_obj_set()
   return ret;
 }
 
+int ObWhiteFilterExecutor::init_like_pattern()
+{
+  int ret = OB_SUCCESS;
+  like_pattern_type_ = LIKE_PATTERN_GENERAL;
+  like_instr_.reset();
+  if (OB_UNLIKELY(2 != params_.count() || 3 != filter_.expr_->arg_cnt_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected params of like filter", K(ret), K_(params));
+  } else if (null_param_contained_) {
+    // the result is null, nothing to match
+  } else {
+    const ObCollationType escape_cs_type = filter_.expr_->args_[2]->datum_meta_.cs_type_;
+    const ObObj &escape = params_.at(1);
+    ObString escape_val("\\");
+    if (!escape.is_null() && 0 < escape.get_string_len()) {
+      escape_val = escape.get_string();
+    }
+    like_cs_type_ = filter_.expr_->args_[1]->datum_meta_.cs_type_;
+    if (OB_FAIL(ObExprLike::calc_escape_wc(escape_cs_type, escape_val, like_escape_wc_))) {
+      LOG_WARN("Failed to calc escape wc", K(ret), K(escape_val), K(escape_cs_type));
+      if (OB_INVALID_ARGUMENT == ret) {
+        LOG_USER_ERROR(OB_INVALID_ARGUMENT, "ESCAPE");
+      }
+    } else if (CS_TYPE_UTF8MB4_BIN == like_cs_type_ || CS_TYPE_BINARY == like_cs_type_) {
+      const ObString pattern = params_.at(0).get_string();
+      const bool percent_start = pattern.length() > 0 && '%' == pattern[0];
+      const bool percent_end = pattern.length() > (percent_start ? 1 : 0)
+                               && '%' == pattern[pattern.length() - 1];
+      const ObString instr(pattern.length() - percent_start - percent_end,
+                           pattern.ptr() + percent_start);
+      bool is_literal = like_escape_wc_ < 0x80;
+      for (int64_t i = 0; is_literal && i < instr.length(); ++i) {
+        is_literal = '%' != instr[i] && '_' != instr[i] && like_escape_wc_ != instr[i];
+      }
+      if (is_literal) {
+        like_instr_ = instr;
+        like_pattern_type_ = percent_start
+            ? (percent_end ? LIKE_PATTERN_INSTR : LIKE_PATTERN_SUFFIX)
+            : (percent_end ? LIKE_PATTERN_PREFIX : LIKE_PATTERN_EXACT);
+      }
+    }
+  }
+  return ret;
+}
+
+bool ObWhiteFilterExecutor::like_match(const ObString &text) const
+{
+  bool matched = false;
+  const int64_t text_len = text.length();
+  const int64_t instr_len = like_instr_.length();
+  switch (like_pattern_type_) {
+    case LIKE_PATTERN_EXACT: {
+      matched = text_len == instr_len && 0 == MEMCMP(text.ptr(), like_instr_.ptr(), instr_len);
+      break;
+    }
+    case LIKE_PATTERN_PREFIX: {
+      matched = text_len >= instr_len && 0 == MEMCMP(text.ptr(), like_instr_.ptr(), instr_len);
+      break;
+    }
+    case LIKE_PATTERN_SUFFIX: {
+      matched = text_len >= instr_len
+                && 0 == MEMCMP(text.ptr() + text_len - instr_len, like_instr_.ptr(), instr_len);
+      break;
+    }
+    case LIKE_PATTERN_INSTR: {
+      matched = 0 == instr_len
+                || nullptr != MEMMEM(text.ptr(), text_len, like_instr_.ptr(), instr_len);
+      break;
+    }
+    default: {
+      const ObString pattern = params_.at(0).get_string();
+      if (0 == text_len && 0 == pattern.length()) {
+        matched = true;
+      } else {
+        matched = ObCharset::wildcmp(like_cs_type_, text, pattern, like_escape_wc_,
+                                     static_cast<int32_t>('_'), static_cast<int32_t>('%'));
+      }
+      break;
+    }
+  }
+  return matched;
+}
+
 int ObWhiteFilterExecutor::exist_in_obj_set(const ObObj &obj, bool &is_exist) const
 {
   int ret = param_set_.exist_refactored(obj);
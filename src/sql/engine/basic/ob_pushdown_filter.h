@@ -173,7 +173,7 @@ enum ObWhiteFilterOperatorType
   WHITE_OP_IN, // in (1, 2, 3)
   WHITE_OP_NU, // is null
   WHITE_OP_NN, // is not null
-  // WHITE_OP_LI, // like
+  WHITE_OP_LI, // like
   WHITE_OP_MAX,
 };
 class ObPushdownWhiteFilterNode : public ObPushdownFilterNode
@@ -435,7 +435,9 @@ public:
                         ObPushdownWhiteFilterNode &filter,
                         ObPushdownOperator &op)
       : ObPushdownFilterExecutor(alloc, op, PushdownExecutorType::WHITE_FILTER_EXECUTOR),
-      null_param_contained_(false), params_(alloc), filter_(filter) {}
+      null_param_contained_(false), like_pattern_type_(LIKE_PATTERN_GENERAL),
+      like_cs_type_(common::CS_TYPE_INVALID), like_escape_wc_(0), like_instr_(),
+      params_(alloc), filter_(filter) {}
   ~ObWhiteFilterExecutor()
   {
     params_.reset();
@@ -455,14 +457,31 @@ public:
   bool is_obj_set_created() const { return param_set_.created(); };
   OB_INLINE ObWhiteFilterOperatorType get_op_type() const
   { return filter_.get_op_type(); }
+  // Whether @text matches the pattern of LIKE filter, @text should not be null
+  bool like_match(const common::ObString &text) const;
   INHERIT_TO_STRING_KV("ObPushdownWhiteFilterExecutor", ObPushdownFilterExecutor,
                        K_(null_param_contained), K_(params), K(param_set_.created()),
-                       K_(filter));
+                       K_(filter), K_(like_pattern_type), K_(like_instr));
 private:
+  // Patterns without '_' and escape and with '%' only at both ends are matched by memcmp/memmem
+  // under binary collations, others are matched by wildcmp of the collation.
+  enum ObLikePatternType
+  {
+    LIKE_PATTERN_GENERAL = 0,
+    LIKE_PATTERN_EXACT,   // abc
+    LIKE_PATTERN_PREFIX,  // abc%
+    LIKE_PATTERN_SUFFIX,  // %abc
+    LIKE_PATTERN_INSTR,   // %abc%
+  };
   void check_null_params();
   int init_obj_set();
+  int init_like_pattern();
 private:
   bool null_param_contained_;
+  ObLikePatternType like_pattern_type_;
+  common::ObCollationType like_cs_type_;
+  int32_t like_escape_wc_;
+  common::ObString like_instr_;
   common::ObFixedArray<common::ObObj, common::ObIAllocator> params_;
   common::hash::ObHashSet<common::ObObj> param_set_;
   ObPushdownWhiteFilterNode &filter_;
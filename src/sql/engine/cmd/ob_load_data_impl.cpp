@@ -2789,7 +2789,9 @@ int ObLoadDataSPImpl::ToolBox::init(ObExecContext &ctx, ObLoadDataStmt &load_stm
     } else if (0 == hint_batch_size) {
       batch_row_count = DEFAULT_BUFFERRED_ROW_COUNT;
     } else {
-      batch_row_count = std::max(1L, std::min(DEFAULT_BUFFERRED_ROW_COUNT, hint_batch_size));
+      // a larger batch amortizes the parse and plan cost of the generated insert stmt
+      // and the per task rpc over more rows of the same tablet
+      batch_row_count = std::max(1L, std::min(MAX_BUFFERRED_ROW_COUNT, hint_batch_size));
     }
     LOG_DEBUG("batch size", K(hint_batch_size), K(batch_row_count));
   }
@@ -18,6 +18,12 @@
 #ifndef _OB_LOAD_DATA_PARSER_H_
 #define _OB_LOAD_DATA_PARSER_H_
 
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 namespace oceanbase
 {
 namespace sql
@@ -82,6 +88,8 @@ public:
     bool is_same_escape_enclosed_;
     bool is_simple_format_;
   };
+public:
+  static const int64_t SCAN_BLOCK_SIZE = 16;
 public:
   ObCSVGeneralParser() {}
   int init(const ObDataInFileStruct &format,
@@ -134,6 +142,15 @@ private:
     return 1;
   }
 
+  /*
+   * skip the bytes going straight through the state machine of scan_proto,
+   * i.e. not a terminator, enclose or escape byte and a single byte char,
+   * 16 bytes are classified at a time. str stops at the first byte which
+   * needs the state machine, or the tail which is less than 16 bytes.
+   */
+  template<common::ObCharsetType cs_type>
+  inline const char *skip_plain_bytes(const char *str, const char *end) const;
+
   int handle_irregular_line(int field_idx,
                             int line_no,
                             common::ObIArray<LineErrRec> &errors);
@@ -229,6 +246,64 @@ inline int ObCSVGeneralParser::mbcharlen<common::CHARSET_GB18030>(const char *pt
   return mb_len;
 }
 
+template<common::ObCharsetType cs_type>
+inline const char *ObCSVGeneralParser::skip_plain_bytes(const char *str, const char *end) const
+{
+  // multi-byte charsets only skip ascii, so that a skipped byte never belongs to a multi-byte char
+  const bool only_ascii = (common::CHARSET_BINARY != cs_type);
+  const char enclosed_c = static_cast<char>(format_.field_enclosed_char_);
+  const char escaped_c = static_cast<char>(format_.field_escaped_char_);
+#if defined(__x86_64__)
+  const __m128i field_term = _mm_set1_epi8(opt_param_.field_term_c_);
+  const __m128i line_term = _mm_set1_epi8(opt_param_.line_term_c_);
+  const __m128i enclosed = _mm_set1_epi8(enclosed_c);
+  const __m128i escaped = _mm_set1_epi8(escaped_c);
+  while (str + SCAN_BLOCK_SIZE <= end) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str));
+    const __m128i hit = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, field_term), _mm_cmpeq_epi8(v, line_term)),
+        _mm_or_si128(_mm_cmpeq_epi8(v, enclosed), _mm_cmpeq_epi8(v, escaped)));
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(hit));
+    if (only_ascii) {
+      mask |= static_cast<uint32_t>(_mm_movemask_epi8(v));
+    }
+    if (0 != mask) {
+      str += __builtin_ctz(mask);
+      break;
+    }
+    str += SCAN_BLOCK_SIZE;
+  }
+#elif defined(__aarch64__)
+  const uint8x16_t field_term = vdupq_n_u8(static_cast<uint8_t>(opt_param_.field_term_c_));
+  const uint8x16_t line_term = vdupq_n_u8(static_cast<uint8_t>(opt_param_.line_term_c_));
+  const uint8x16_t enclosed = vdupq_n_u8(static_cast<uint8_t>(enclosed_c));
+  const uint8x16_t escaped = vdupq_n_u8(static_cast<uint8_t>(escaped_c));
+  const uint8x16_t non_ascii = vdupq_n_u8(0x80);
+  while (str + SCAN_BLOCK_SIZE <= end) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(str));
+    uint8x16_t hit = vorrq_u8(vorrq_u8(vceqq_u8(v, field_term), vceqq_u8(v, line_term)),
+                              vorrq_u8(vceqq_u8(v, enclosed), vceqq_u8(v, escaped)));
+    if (only_ascii) {
+      hit = vorrq_u8(hit, vcgeq_u8(v, non_ascii));
+    }
+    // narrow every byte of the compare result to 4 bits
+    const uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hit), 4)), 0);
+    if (0 != mask) {
+      str += (__builtin_ctzll(mask) >> 2);
+      break;
+    }
+    str += SCAN_BLOCK_SIZE;
+  }
+#else
+  UNUSED(end);
+  UNUSED(only_ascii);
+  UNUSED(enclosed_c);
+  UNUSED(escaped_c);
+#endif
+  return str;
+}
+
 template<common::ObCharsetType cs_type, typename handle_func, bool DO_ESCAPE>
 int ObCSVGeneralParser::scan_proto(const char *&str,
                                    const char *end,
@@ -331,6 +406,7 @@ int ObCSVGeneralParser::scan_proto(const char *&str,
           if (!is_term) {
             int mb_len = mbcharlen<cs_type>(str, end);
             str += mb_len;
+            str = skip_plain_bytes<cs_type>(str, end);
           }
         }
       }
@@ -63,6 +63,8 @@ public:
 namespace sql {
 
 static const int64_t DEFAULT_BUFFERRED_ROW_COUNT = 100; //must < 2^15
+// upper bound of the load_batch_size hint, row idx of a task is stored as int16_t
+static const int64_t MAX_BUFFERRED_ROW_COUNT = 8192; //must < 2^15
 static const int64_t DEFAULT_PARALLEL_THREAD_COUNT = 4;
 static const int64_t EXPECTED_INSERT_COLUMN_NUM = 64;
 static const int64_t RPC_BATCH_INSERT_TIMEOUT_US = 10 * 1000 * 1000; //10s
@@ -80,6 +82,8 @@ enum class ObLoadTaskResultFlag {
 
 static_assert(static_cast<int64_t>(ObLoadTaskResultFlag::INVALID_MAX_FLAG) < 64,
               "ObLoadTaskResultFlag max value should less than 64");
+static_assert(MAX_BUFFERRED_ROW_COUNT < INT16_MAX,
+              "row idx of a load data task should fit in int16_t");
 
 enum class ObTaskResFlag {
   RPC_TIMEOUT = 0,
@@ -481,6 +481,98 @@ int ObTableInsertOp::inner_get_next_row()
   return ret;
 }
 
+int ObTableInsertOp::inner_get_next_batch(const int64_t max_row_cnt)
+{
+  int ret = OB_SUCCESS;
+  const ObBatchRows *child_brs = nullptr;
+  if (iter_end_) {
+    LOG_DEBUG("can't get gi task, iter end", K(MY_SPEC.id_), K(iter_end_));
+    brs_.end_ = true;
+    brs_.size_ = 0;
+  } else {
+    while (OB_SUCC(ret) && !iter_end_) {
+      if (OB_FAIL(try_check_status())) {
+        LOG_WARN("check status failed", K(ret));
+      } else if (OB_FAIL(get_next_batch_from_child(max_row_cnt, child_brs))) {
+        // do nothing: log is done in previous call
+      } else if (OB_FAIL(insert_batch_to_das(child_brs))) {
+        LOG_WARN("insert batch to das failed", K(ret));
+      } else if (child_brs->end_) {
+        iter_end_ = true;
+      } else if (MY_SPEC.is_returning_) {
+        break;
+      }
+    }
+
+    if (OB_SUCC(ret) && iter_end_) {
+      if (!MY_SPEC.has_instead_of_trigger_ && OB_FAIL(ins_rows_post_proc())) {
+        LOG_WARN("do insert rows post process failed", K(ret));
+      }
+    }
+    if (OB_SUCC(ret) && !MY_SPEC.is_returning_) {
+      // insert without returning outputs nothing, same as inner_get_next_row
+      brs_.size_ = 0;
+      brs_.end_ = true;
+    }
+    // all error, we must rollback with single execute when batch executed
+    if (OB_FAIL(ret)) {
+      ObMultiStmtItem &multi_stmt_item = ctx_.get_sql_ctx()->multi_stmt_item_;
+      if (MY_SPEC.ins_ctdefs_.at(0).at(0)->das_ctdef_.is_batch_stmt_ && !multi_stmt_item.is_ins_multi_val_opt()) {
+        int tmp_ret = ret;
+        ret = OB_BATCHED_MULTI_STMT_ROLLBACK;
+        LOG_TRACE("batch exec with some exception, rollback with single execute", K(ret), K(tmp_ret));
+      }
+    }
+  }
+  return ret;
+}
+
+OB_INLINE int ObTableInsertOp::get_next_batch_from_child(const int64_t max_row_cnt,
+                                                         const ObBatchRows *&child_brs)
+{
+  int ret = OB_SUCCESS;
+  clear_evaluated_flag();
+  if (OB_FAIL(child_->get_next_batch(max_row_cnt, child_brs))) {
+    LOG_WARN("fail to get next batch", K(ret));
+  } else if (OB_LIKELY(!child_brs->end_ && child_brs->size_ > 0)) {
+    LOG_TRACE("child output batch", "batch_size", child_brs->size_);
+  }
+  return ret;
+}
+
+int ObTableInsertOp::insert_batch_to_das(const ObBatchRows *child_brs)
+{
+  int ret = OB_SUCCESS;
+  // The das ctx and the insert rtdefs reference the operator eval_ctx_,
+  // setting batch_idx for eval_ctx_ makes them all point to the current row,
+  // see ObTableLockOp::lock_batch_to_das.
+  ObEvalCtx::BatchInfoScopeGuard operator_evalctx_guard(eval_ctx_);
+  operator_evalctx_guard.set_batch_size(child_brs->size_);
+  (void) brs_.copy(child_brs);
+  for (int64_t i = 0; OB_SUCC(ret) && i < child_brs->size_; ++i) {
+    if (child_brs->skip_->at(i)) {
+      continue;
+    }
+    operator_evalctx_guard.set_batch_idx(i);
+    // every row is converted and checked from scratch, same as get_next_row_from_child
+    clear_datum_eval_flag();
+    if (MY_SPEC.has_instead_of_trigger_) {
+      if (OB_FAIL(do_instead_of_trigger_insert())) {
+        LOG_WARN("failed to do instead of trigger", K(ret));
+      }
+    } else if (OB_FAIL(insert_row_to_das())) {
+      LOG_WARN("insert row to das failed", K(ret), K(i));
+    } else if (is_error_logging_ && err_log_rt_def_.first_err_ret_ != OB_SUCCESS) {
+      // the row has been written into the error logging table, do not output it
+      clear_datum_eval_flag();
+      brs_.skip_->set(i);
+      err_log_rt_def_.curr_err_log_record_num_++;
+      err_log_rt_def_.reset();
+    }
+  }
+  return ret;
+}
+
 int ObTableInsertOp::inner_close()
 {
   NG_TRACE(insert_close);
@@ -78,6 +78,7 @@ public:
 protected:
   virtual int inner_open() override;
   virtual int inner_get_next_row() override;
+  virtual int inner_get_next_batch(const int64_t max_row_cnt) override;
   virtual int inner_rescan() override;
   virtual int inner_close() override;
 protected:
@@ -89,6 +90,9 @@ protected:
                       ObDASTabletLoc *&tablet_loc);
   int open_table_for_each();
   int get_next_row_from_child();
+  int get_next_batch_from_child(const int64_t max_row_cnt,
+                                const ObBatchRows *&child_brs);
+  int insert_batch_to_das(const ObBatchRows *child_brs);
   int do_instead_of_trigger_insert();
   int close_table_for_each();
 
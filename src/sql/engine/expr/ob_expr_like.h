@@ -152,6 +152,10 @@ public:
 
   static int like_varchar(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
   static int eval_like_expr_batch_only_text_vectorized(BATCH_EVAL_FUNC_ARG_DECL);
+  // also used by like white filter pushed down to storage
+  static int calc_escape_wc(const common::ObCollationType escape_coll,
+                            const common::ObString &escape,
+                            int32_t &escape_wc);
 private:
   static int set_instr_info(common::ObIAllocator *exec_allocator,
                             const common::ObCollationType cs_type,
@@ -164,9 +168,6 @@ private:
                        int32_t char_len,
                        int32_t escape_wc,
                        bool &res);
-  static int calc_escape_wc(const common::ObCollationType escape_coll,
-                            const common::ObString &escape,
-                            int32_t &escape_wc);
   template <typename T>
   inline static int calc_with_instr_mode(T &result,
                                           const common::ObCollationType cs_type,
@@ -101,7 +101,8 @@ ObHashJoinSpec::ObHashJoinSpec(common::ObIAllocator &alloc, const ObPhyOperatorT
   is_naaj_(false),
   is_sna_(false),
   is_shared_ht_(false),
-  is_ns_equal_cond_(alloc)
+  is_ns_equal_cond_(alloc),
+  disable_cache_aware_(false)
 {
 }
 
@@ -113,7 +114,8 @@ OB_SERIALIZE_MEMBER((ObHashJoinSpec, ObJoinSpec),
                     is_naaj_,
                     is_sna_,
                     is_shared_ht_,
-                    is_ns_equal_cond_);
+                    is_ns_equal_cond_,
+                    disable_cache_aware_);
 
 int ObHashJoinOp::PartHashJoinTable::init(ObIAllocator &alloc)
 {
@@ -2759,14 +2761,15 @@ bool ObHashJoinOp::can_use_cache_aware_opt()
       force_enable = !!(opt & HJ_TP_OPT_ENABLE_CACHE_AWARE);
     }
   }
-  enable_cache_aware = ((enable_cache_aware
-                    && total_partition_cnt >= CACHE_AWARE_PART_CNT) || force_enable)
+  enable_cache_aware = (need_cache_aware_join(enable_cache_aware,
+                                              total_partition_cnt,
+                                              MY_SPEC.disable_cache_aware_) || force_enable)
                     && INNER_JOIN == MY_SPEC.join_type_
                     && !is_shared_;
   LOG_TRACE("trace check cache aware opt", K(total_memory_size), K(total_row_count),
     K(row_count_cache_aware), K(enable_cache_aware),
     K(sql_mem_processor_.get_mem_bound()), K(part_count_), K(cur_dumped_partition_),
-    K(level1_part_count_), K(level2_part_count_));
+    K(level1_part_count_), K(level2_part_count_), K(MY_SPEC.disable_cache_aware_));
   if (!enable_cache_aware) {
     level1_part_count_ = 0;
     level2_part_count_ = 0;
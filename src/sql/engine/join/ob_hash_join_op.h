@@ -256,6 +256,9 @@ public:
   bool is_shared_ht_;
   // record which equal cond is null safe equal
   common::ObFixedArray<bool, common::ObIAllocator> is_ns_equal_cond_;
+  // optimizer is sure the probe side is too small for cache aware hash join,
+  // otherwise it is decided by the actual build size, see ObLogJoin::is_cache_aware_hash_join_disabled
+  bool disable_cache_aware_;
 };
 
 // hash join has no expression result overwrite problem:
@@ -1044,6 +1047,13 @@ private:
                       PredFunc pred);
 
   bool can_use_cache_aware_opt();
+  // cache aware hash join pays off when the in-memory build rows fill enough L2 sized partitions
+  static bool need_cache_aware_join(const bool mem_enough,
+                                    const int64_t total_partition_cnt,
+                                    const bool disabled_by_plan)
+  {
+    return mem_enough && !disabled_by_plan && total_partition_cnt >= CACHE_AWARE_PART_CNT;
+  }
   int read_hashrow_normal();
   int read_hashrow_for_cache_aware(NextFunc next_func);
   int init_histograms(HashJoinHistogram *&part_histograms, int64_t part_count);
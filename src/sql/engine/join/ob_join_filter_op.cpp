@@ -620,6 +620,12 @@ int ObJoinFilterOp::insert_by_row_batch(const ObBatchRows *child_brs)
         }
       }
     }
+    // each key only touches one cache line aligned block, prefetch them before inserting
+    for (int64_t i = 0; OB_SUCC(ret) && i < child_brs->size_; ++i) {
+      if (!child_brs->skip_->at(i)) {
+        filter_create_->prefetch_bits_block(batch_hash_values_[i]);
+      }
+    }
     for (int64_t i = 0; OB_SUCC(ret) && i < child_brs->size_; ++i) {
       if (MY_SPEC.is_partition_filter()) {
         ObDatum &datum = MY_SPEC.calc_tablet_id_expr_->locate_expr_datum(eval_ctx_, i);
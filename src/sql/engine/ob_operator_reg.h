@@ -288,7 +288,7 @@ class ObTableInsertSpec;
 class ObTableInsertOp;
 class ObTableInsertOpInput;
 REGISTER_OPERATOR(ObLogInsert, PHY_INSERT, ObTableInsertSpec,
-                  ObTableInsertOp, ObTableInsertOpInput);
+                  ObTableInsertOp, ObTableInsertOpInput, VECTORIZED_OP);
 
 // PDML-delete
 class ObLogDelete;
@@ -11,7 +11,9 @@
  */
 
 #define USING_LOG_PREFIX SQL_ENG
-//#include <immintrin.h>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
 #include "ob_px_bloom_filter.h"
 #include "lib/hash_func/murmur_hash.h"
 #include "lib/container/ob_se_array.h"
@@ -56,9 +58,7 @@ int ObPxBloomFilter::init(int64_t data_length, ObIAllocator &allocator, double f
     (void)calc_num_of_hash_func();
     bits_array_length_ = ceil((double)bits_count_ / 64);
     void *bits_array_buf = NULL;
-    bool simd_support = blocksstable::is_avx512_valid();
-    might_contain_ = simd_support ? &ObPxBloomFilter::might_contain_simd
-                     : &ObPxBloomFilter::might_contain_nonsimd;
+    might_contain_ = choose_might_contain_func();
     if (OB_ISNULL(bits_array_buf = allocator.alloc(
                                        (CACHE_LINE_SIZE + bits_array_length_) * sizeof(int64_t)))) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
@@ -71,7 +71,7 @@ int ObPxBloomFilter::init(int64_t data_length, ObIAllocator &allocator, double f
       MEMSET(bits_array_, 0, bits_array_length_ * sizeof(int64_t));
       is_inited_ = true;
       LOG_TRACE("init px bloom filter", K(data_length_), K(bits_array_buf),
-                 K(bits_array_), K(hash_func_count_), K(simd_support));
+                 K(bits_array_), K(hash_func_count_));
     }
   }
   return ret;
@@ -176,6 +176,40 @@ int ObPxBloomFilter::might_contain_nonsimd(uint64_t hash, bool &is_match)
   return ret;
 }
 
+// same as might_contain_simd, but the rotate of AVX512VL is replaced by a shift,
+// the shift count is masked to keep the semantic of `1L << hash_high`.
+#if defined(__x86_64__)
+__attribute__((target("avx2")))
+#endif
+int ObPxBloomFilter::might_contain_avx2(uint64_t hash, bool &is_match)
+{
+  int ret = OB_SUCCESS;
+#if defined(__x86_64__)
+  uint32_t hash_high = (uint32_t)(hash >> 32);
+  uint64_t block_begin = (hash & ((bits_count_ >> (LOG_HASH_COUNT + 6)) - 1)) << LOG_HASH_COUNT;
+  __m256i hash_values = _mm256_set1_epi64x(hash_high);
+  hash_values = _mm256_srlv_epi64(hash_values, _mm256_set_epi64x(24, 16, 8, 0));
+  hash_values = _mm256_and_si256(hash_values, _mm256_set1_epi64x(WORD_SIZE - 1));
+  hash_values = _mm256_sllv_epi64(_mm256_set1_epi64x(1), hash_values);
+  __m256i bf_values = _mm256_loadu_si256(reinterpret_cast<__m256i *>(&bits_array_[block_begin]));
+  is_match = 1 == _mm256_testc_si256(bf_values, hash_values);
+#else
+  ret = might_contain_nonsimd(hash, is_match);
+#endif
+  return ret;
+}
+
+ObPxBloomFilter::GetFunc ObPxBloomFilter::choose_might_contain_func()
+{
+  GetFunc func = &ObPxBloomFilter::might_contain_nonsimd;
+  if (blocksstable::is_avx512_valid()) {
+    func = &ObPxBloomFilter::might_contain_simd;
+  } else if (blocksstable::is_avx2_valid()) {
+    func = &ObPxBloomFilter::might_contain_avx2;
+  }
+  return func;
+}
+
 bool ObPxBloomFilter::set(uint64_t word_index, uint64_t bit_index)
 {
   if (!get(word_index, bit_index)) {
@@ -354,8 +388,7 @@ OB_DEF_DESERIALIZE(ObPxBloomFilter)
     }
     if (OB_SUCC(ret)) {
       bits_array_ = bits_array;
-      might_contain_ = blocksstable::is_avx512_valid() ? &ObPxBloomFilter::might_contain_simd
-                       : &ObPxBloomFilter::might_contain_nonsimd;
+      might_contain_ = choose_might_contain_func();
     }
   }
   return ret;
@@ -98,6 +98,8 @@ private:
   void calc_num_of_bits();
   int might_contain_nonsimd(uint64_t hash, bool &is_match);
   int might_contain_simd(uint64_t hash, bool &is_match);
+  int might_contain_avx2(uint64_t hash, bool &is_match);
+  static GetFunc choose_might_contain_func();
 
 private:
   int64_t data_length_;          //原始数据长度
@@ -1222,6 +1222,7 @@ int ObSortOpImpl::do_partition_sort(common::ObArray<ObChunkDatumStore::StoredRow
         if (enable_encode_sortkey_) {
           ObAdaptiveQS aqs(rows, allocator, rows_last, rows_idx, part_cnt_ + hash_expr_cnt);
           aqs.sort(rows_last, rows_idx);
+          sort_encoded_key_ties(rows, rows_last, rows_idx, part_cnt_ + hash_expr_cnt);
         } else {
           std::sort(rows.begin() + rows_last, rows.begin() + rows_idx, CopyableComparer(comp_));
         }
@@ -1232,6 +1233,33 @@ int ObSortOpImpl::do_partition_sort(common::ObArray<ObChunkDatumStore::StoredRow
   return ret;
 }
 
+void ObSortOpImpl::sort_encoded_key_ties(common::ObArray<ObChunkDatumStore::StoredRow *> &rows,
+                                         const int64_t rows_begin, const int64_t rows_end,
+                                         const int64_t encode_pos)
+{
+  if (encode_pos + 1 < comp_.get_cnt() && rows_end - rows_begin > 1) {
+    const int64_t cmp_start = comp_.cmp_start_;
+    const int64_t cmp_end = comp_.cmp_end_;
+    comp_.set_cmp_range(encode_pos + 1, comp_.get_cnt());
+    int64_t tie_begin = rows_begin;
+    for (int64_t i = rows_begin + 1; OB_SUCCESS == comp_.ret_ && i <= rows_end; ++i) {
+      bool is_tie = false;
+      if (i < rows_end) {
+        const ObDatum &l = rows.at(tie_begin)->cells()[encode_pos];
+        const ObDatum &r = rows.at(i)->cells()[encode_pos];
+        is_tie = l.len_ == r.len_ && 0 == MEMCMP(l.ptr_, r.ptr_, l.len_);
+      }
+      if (!is_tie) {
+        if (i - tie_begin > 1) {
+          std::sort(&rows.at(tie_begin), &rows.at(0) + i, CopyableComparer(comp_));
+        }
+        tie_begin = i;
+      }
+    }
+    comp_.set_cmp_range(cmp_start, cmp_end);
+  }
+}
+
 int ObSortOpImpl::do_dump()
 {
   int ret = OB_SUCCESS;
@@ -1462,6 +1490,7 @@ int ObSortOpImpl::sort_inmem_data()
         ObAdaptiveQS aqs(rows_, mem_context_->get_malloc_allocator(), begin, rows_.count(),
                          get_prefix_pos());
         aqs.sort(begin, rows_.count());
+        sort_encoded_key_ties(rows_, begin, rows_.count(), get_prefix_pos());
       } else {
         std::sort(&rows_.at(begin), &rows_.at(0) + rows_.count(), CopyableComparer(comp_));
       }
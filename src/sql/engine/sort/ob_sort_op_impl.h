@@ -420,6 +420,11 @@ protected:
   bool is_equal_part(const ObChunkDatumStore::StoredRow *l, const ObChunkDatumStore::StoredRow *r);
   int do_partition_sort(common::ObArray<ObChunkDatumStore::StoredRow *> &rows,
                         const int64_t rows_begin, const int64_t rows_end);
+  // encoded sort key may be followed by keys that can not be encoded, rows with equal
+  // encoded key are sorted by them after adaptive quick sort
+  void sort_encoded_key_ties(common::ObArray<ObChunkDatumStore::StoredRow *> &rows,
+                             const int64_t rows_begin, const int64_t rows_end,
+                             const int64_t encode_pos);
   void set_iteration_age(ObChunkDatumStore::IterationAge *iter_age);
   DISALLOW_COPY_AND_ASSIGN(ObSortOpImpl);
 protected:
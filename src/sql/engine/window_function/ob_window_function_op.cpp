@@ -312,7 +312,11 @@ DEF_TO_STRING(ObWindowFunctionOp::AggrCell)
   J_COLON();
   pos += ObWindowFunctionOp::WinFuncCell::to_string(buf + pos, buf_len - pos);
   J_COMMA();
-  J_KV(K_(finish_prepared), K_(result));
+  J_KV(K_(finish_prepared), K_(result), K_(use_extremum_window));
+  if (use_extremum_window_) {
+    J_COMMA();
+    J_KV(K_(extremum_window));
+  }
   J_OBJ_END();
   return pos;
 }
@@ -974,6 +978,128 @@ void ObWindowFunctionOp::Frame::prune_frame(const Frame &part_frame,
   }
 }
 
+void ObWindowFunctionOp::ExtremumWindow::init(const bool is_max,
+                                              ObDatumCmpFuncType cmp_func,
+                                              const uint64_t tenant_id)
+{
+  is_max_ = is_max;
+  cmp_func_ = cmp_func;
+  items_.set_label("WfExtremumWin");
+  for (int64_t i = 0; i < ARRAYSIZEOF(allocs_); ++i) {
+    allocs_[i].set_tenant_id(tenant_id);
+    allocs_[i].set_label("WfExtremumWin");
+    allocs_[i].set_ctx_id(ObCtxIds::WORK_AREA);
+  }
+}
+
+void ObWindowFunctionOp::ExtremumWindow::reset()
+{
+  frame_ = Frame();
+  items_.reuse();
+  begin_ = 0;
+  live_size_ = 0;
+  for (int64_t i = 0; i < ARRAYSIZEOF(allocs_); ++i) {
+    allocs_[i].reuse();
+  }
+  cur_alloc_ = 0;
+}
+
+void ObWindowFunctionOp::ExtremumWindow::destroy()
+{
+  frame_ = Frame();
+  items_.destroy();
+  begin_ = 0;
+  live_size_ = 0;
+  for (int64_t i = 0; i < ARRAYSIZEOF(allocs_); ++i) {
+    allocs_[i].reset();
+  }
+  cur_alloc_ = 0;
+}
+
+int ObWindowFunctionOp::ExtremumWindow::push(const int64_t idx, const ObDatum &val)
+{
+  int ret = OB_SUCCESS;
+  ObDatum copied;
+  if (OB_ISNULL(cmp_func_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("cmp_func is NULL", K(ret));
+  } else if (val.is_null()) {
+    // ignore null, the same as max_calc/min_calc
+  } else {
+    // Equal values are kept, so that the head is always the first extremum of the frame,
+    // which is the one the aggregate processor returns.
+    bool stop = false;
+    while (!stop && items_.count() > begin_) {
+      const ObDatum &last = items_.at(items_.count() - 1).val_;
+      const int cmp = cmp_func_(last, val);
+      if (is_max_ ? cmp < 0 : cmp > 0) {
+        live_size_ -= last.len_;
+        items_.pop_back();
+      } else {
+        stop = true;
+      }
+    }
+    if (OB_FAIL(copied.deep_copy(val, allocs_[cur_alloc_]))) {
+      LOG_WARN("deep copy datum failed", K(ret), K(val));
+    } else if (OB_FAIL(items_.push_back(Item(idx, copied)))) {
+      LOG_WARN("push back failed", K(ret));
+    } else {
+      live_size_ += copied.len_;
+      if ((begin_ >= MIN_SHRINK_ITEM_CNT && begin_ * 2 >= items_.count())
+          || allocs_[cur_alloc_].used() >= MAX(MIN_SHRINK_SIZE, live_size_ * 2)) {
+        if (OB_FAIL(shrink())) {
+          LOG_WARN("shrink failed", K(ret), KPC(this));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+void ObWindowFunctionOp::ExtremumWindow::pop_before(const int64_t head)
+{
+  while (items_.count() > begin_ && items_.at(begin_).idx_ < head) {
+    live_size_ -= items_.at(begin_).val_.len_;
+    ++begin_;
+  }
+}
+
+void ObWindowFunctionOp::ExtremumWindow::get_result(ObDatum &val) const
+{
+  if (items_.count() > begin_) {
+    val = items_.at(begin_).val_;
+  } else {
+    val.set_null();
+  }
+}
+
+int ObWindowFunctionOp::ExtremumWindow::shrink()
+{
+  int ret = OB_SUCCESS;
+  const int64_t next_alloc = 1 - cur_alloc_;
+  allocs_[next_alloc].reuse();
+  // copy values first, items stay valid if it fails
+  for (int64_t i = begin_; OB_SUCC(ret) && i < items_.count(); ++i) {
+    ObDatum &val = items_.at(i).val_;
+    if (OB_FAIL(val.deep_copy(val, allocs_[next_alloc]))) {
+      LOG_WARN("deep copy datum failed", K(ret), K(val));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    const int64_t cnt = items_.count() - begin_;
+    for (int64_t i = 0; i < cnt; ++i) {
+      items_.at(i) = items_.at(begin_ + i);
+    }
+    while (items_.count() > cnt) {
+      items_.pop_back();
+    }
+    begin_ = 0;
+    allocs_[cur_alloc_].reuse();
+    cur_alloc_ = next_alloc;
+  }
+  return ret;
+}
+
 template<class FuncType>
 int ObWindowFunctionOp::FuncAllocer::alloc(WinFuncCell *&return_func,
     WinFuncInfo &wf_info, ObWindowFunctionOp &op, const int64_t tenant_id)
@@ -1104,6 +1230,7 @@ int ObWindowFunctionOp::init()
               } else {
                 aggr_func->aggr_processor_.set_dir_id(dir_id_);
                 aggr_func->aggr_processor_.set_io_event_observer(&io_event_observer_);
+                init_extremum_window(*aggr_func, tenant_id);
                 wf_cell = aggr_func;
               }
             }
@@ -1406,7 +1533,14 @@ int ObWindowFunctionOp::compute(RowsReader &row_reader, WinFuncCell &wf_cell,
               K(row_idx), K(upper_has_null), K(lower_has_null), K(wf_cell));
     if (!upper_has_null && !lower_has_null && Frame::valid_frame(part_frame, new_frame)) {
       Frame::prune_frame(part_frame, new_frame);
-      if (wf_cell.is_aggr()) {
+      if (wf_cell.is_aggr() && static_cast<AggrCell &>(wf_cell).use_extremum_window_) {
+        if (OB_FAIL(compute_extremum(static_cast<AggrCell &>(wf_cell), new_frame, val))) {
+          LOG_WARN("compute extremum failed", K(ret), K(new_frame));
+        } else {
+          last_valid_frame = new_frame;
+          LOG_DEBUG("finish compute", K(row_idx), K(last_valid_frame), K(val));
+        }
+      } else if (wf_cell.is_aggr()) {
         AggrCell *aggr_func = static_cast<AggrCell *>(&wf_cell);
         const ObRADatumStore::StoredRow *cur_row = NULL;
         if (!Frame::same_frame(last_valid_frame, new_frame)) {
@@ -1529,6 +1663,65 @@ int ObWindowFunctionOp::compute(RowsReader &row_reader, WinFuncCell &wf_cell,
   return ret;
 }
 
+void ObWindowFunctionOp::init_extremum_window(AggrCell &aggr_func, const uint64_t tenant_id)
+{
+  const WinFuncInfo &wf_info = aggr_func.wf_info_;
+  const ObAggrInfo &aggr_info = wf_info.aggr_info_;
+  // Frames starting at UNBOUNDED PRECEDING never slide out any row, the aggregate processor
+  // handles them incrementally already.
+  if ((T_FUN_MAX == wf_info.func_type_ || T_FUN_MIN == wf_info.func_type_)
+      && common::REMOVE_EXTRENUM == wf_info.remove_type_
+      && !(wf_info.upper_.is_unbounded_ && wf_info.upper_.is_preceding_)
+      && !aggr_info.has_distinct_
+      && 1 == aggr_info.param_exprs_.count()
+      && NULL != aggr_info.expr_
+      && NULL != aggr_info.param_exprs_.at(0)
+      && aggr_info.expr_->datum_meta_.type_ == aggr_info.param_exprs_.at(0)->datum_meta_.type_
+      && NULL != aggr_info.expr_->basic_funcs_
+      && NULL != aggr_info.expr_->basic_funcs_->null_first_cmp_) {
+    aggr_func.extremum_window_.init(T_FUN_MAX == wf_info.func_type_,
+                                    aggr_info.expr_->basic_funcs_->null_first_cmp_,
+                                    tenant_id);
+    aggr_func.use_extremum_window_ = true;
+  }
+}
+
+int ObWindowFunctionOp::compute_extremum(AggrCell &aggr_func, const Frame &new_frame,
+                                         ObDatum &val)
+{
+  int ret = OB_SUCCESS;
+  ExtremumWindow &window = aggr_func.extremum_window_;
+  ObExpr *param_expr = aggr_func.wf_info_.aggr_info_.param_exprs_.at(0);
+  const ObRADatumStore::StoredRow *cur_row = NULL;
+  ObDatum *param_datum = NULL;
+  int64_t start = new_frame.head_;
+  if (window.can_slide(new_frame)) {
+    window.pop_before(new_frame.head_);
+    start = max(new_frame.head_, window.frame_.tail_ + 1);
+  } else {
+    window.reset();
+  }
+  for (int64_t i = start; OB_SUCC(ret) && i <= new_frame.tail_; ++i) {
+    if (OB_FAIL(input_rows_.cur_->get_row(i, cur_row))) {
+      LOG_WARN("get cur row failed", K(ret), K(i));
+    } else if (FALSE_IT(clear_evaluated_flag())) {
+    } else if (OB_FAIL(cur_row->to_expr(get_all_expr(), eval_ctx_))) {
+      LOG_WARN("Failed to to_expr", K(ret));
+    } else if (OB_FAIL(param_expr->eval(eval_ctx_, param_datum))) {
+      LOG_WARN("eval param expr failed", K(ret), K(i));
+    } else if (OB_FAIL(window.push(i, *param_datum))) {
+      LOG_WARN("push extremum window failed", K(ret), K(i));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    window.frame_ = new_frame;
+    window.get_result(val);
+  } else {
+    window.reset();
+  }
+  return ret;
+}
+
 int ObWindowFunctionOp::inner_get_next_row()
 {
   int ret = OB_SUCCESS;
@@ -223,6 +223,59 @@ public:
     int64_t tail_;
   };
 
+  // Monotonic queue of (row idx, value) for MIN/MAX over a sliding frame. Frames of
+  // consecutive rows only move forward, so each row is pushed and popped at most once
+  // per partition and the extremum is always the queue head, while the generic path has
+  // to restart the aggregation every time the extremum slides out of the frame.
+  class ExtremumWindow
+  {
+  public:
+    struct Item
+    {
+      Item() : idx_(-1), val_() {}
+      Item(const int64_t idx, const common::ObDatum &val) : idx_(idx), val_(val) {}
+      TO_STRING_KV(K_(idx), K_(val));
+
+      int64_t idx_;
+      common::ObDatum val_;
+    };
+    static const int64_t MIN_SHRINK_SIZE = 1L << 20;
+    static const int64_t MIN_SHRINK_ITEM_CNT = 1024;
+
+    ExtremumWindow()
+      : frame_(), is_max_(false), cmp_func_(NULL), items_(), begin_(0), cur_alloc_(0),
+        live_size_(0) {}
+    ~ExtremumWindow() { destroy(); }
+    void init(const bool is_max, common::ObDatumCmpFuncType cmp_func, const uint64_t tenant_id);
+    void reset();
+    void destroy();
+    // whether %frame can be reached from frame_ by only sliding forward
+    bool can_slide(const Frame &frame) const
+    {
+      return frame_.head_ >= 0 && frame.head_ >= frame_.head_ && frame.tail_ >= frame_.tail_;
+    }
+    // NULL values are ignored, the same as the aggregate processor does.
+    int push(const int64_t idx, const common::ObDatum &val);
+    void pop_before(const int64_t head);
+    void get_result(common::ObDatum &val) const;
+    TO_STRING_KV(K_(frame), K_(is_max), K_(begin), "item_cnt", items_.count(), K_(cur_alloc),
+                 K_(live_size));
+  private:
+    // move live values to the other allocator and drop the popped items
+    int shrink();
+  public:
+    Frame frame_;
+  private:
+    bool is_max_;
+    common::ObDatumCmpFuncType cmp_func_;
+    // items in [begin_, count) are alive, values are decreasing for max and increasing for min
+    common::ObArray<Item> items_;
+    int64_t begin_;
+    common::ObArenaAllocator allocs_[2];
+    int64_t cur_alloc_;
+    int64_t live_size_;
+  };
+
   class RowsStore
   {
   public:
@@ -450,7 +503,9 @@ public:
         aggr_processor_(op_.eval_ctx_, aggr_infos, "WindowAggProc"),
         result_(),
         got_result_(false),
-        remove_type_(wf_info.remove_type_)
+        remove_type_(wf_info.remove_type_),
+        use_extremum_window_(false),
+        extremum_window_()
     {}
     virtual ~AggrCell() { aggr_processor_.destroy(); }
     int trans(const ObRADatumStore::StoredRow &row)
@@ -487,6 +542,7 @@ public:
       aggr_processor_.reuse();
       result_.reset();
       got_result_ = false;
+      extremum_window_.reset();
     }
   public:
     bool finish_prepared_;
@@ -494,6 +550,10 @@ public:
     ObDatum result_;
     bool got_result_;
     uint64_t remove_type_;
+    // MIN/MAX with a sliding frame head, computed by %extremum_window_ instead of
+    // %aggr_processor_
+    bool use_extremum_window_;
+    ExtremumWindow extremum_window_;
   };
 
   class NonAggrCell : public WinFuncCell
@@ -691,6 +751,8 @@ protected:
   int input_one_row(WinFuncCell &func_ctx, bool &part_end);
   int compute(RowsReader &row_reader, WinFuncCell &wf_cell, const int64_t row_idx,
               common::ObDatum &val);
+  void init_extremum_window(AggrCell &aggr_func, const uint64_t tenant_id);
+  int compute_extremum(AggrCell &aggr_func, const Frame &new_frame, common::ObDatum &val);
   int check_same_partition(const ExprFixedArray &other_exprs,
                            bool &is_same_part,
                            const ExprFixedArray *curr_exprs = NULL);
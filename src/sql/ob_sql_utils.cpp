@@ -3920,6 +3920,23 @@ bool ObSQLUtils::check_can_encode_sortkey(const common::ObIArray<OrderItem> &ord
   return can_sort_opt;
 }
 
+int64_t ObSQLUtils::get_encodable_sortkey_cnt(const common::ObIArray<OrderItem> &order_keys,
+                                              const int64_t start_key)
+{
+  int64_t cnt = 0;
+  for (int64_t i = start_key; i < order_keys.count(); i++) {
+    if (OB_ISNULL(order_keys.at(i).expr_)
+        || !ObOrderPerservingEncoder::can_encode_sortkey(
+                          order_keys.at(i).expr_->get_data_type(),
+                          order_keys.at(i).expr_->get_collation_type())) {
+      break;
+    } else {
+      cnt++;
+    }
+  }
+  return cnt;
+}
+
 int ObSQLUtils::create_encode_sortkey_expr(
   ObRawExprFactory &expr_factory,
   ObExecContext* exec_ctx,
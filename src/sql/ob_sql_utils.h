@@ -506,6 +506,9 @@ public:
   static bool is_one_part_table_can_skip_part_calc(const share::schema::ObTableSchema &schema);
 
   static bool check_can_encode_sortkey(const common::ObIArray<OrderItem> &order_keys);
+  // count of leading keys from @start_key that can be encoded into one memcmp-able sortkey
+  static int64_t get_encodable_sortkey_cnt(const common::ObIArray<OrderItem> &order_keys,
+                                           const int64_t start_key);
   static int create_encode_sortkey_expr(ObRawExprFactory &expr_factory,
                                         ObExecContext* exec_ctx,
                                         const common::ObIArray<OrderItem> &order_keys,
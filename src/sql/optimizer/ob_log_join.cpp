@@ -1030,6 +1030,34 @@ int ObLogJoin::is_left_unique(bool &left_unique) const
   return ret;
 }
 
+/*
+ * Cache aware hash join partitions both build and probe rows into cache sized radix
+ * partitions before probing. The hash join operator decides it by the actual size of the
+ * build side in memory. The plan only rules it out when the probe side is estimated far
+ * smaller than the build side, so that the extra partitioning pass is never amortized.
+ */
+bool ObLogJoin::is_cache_aware_hash_join_disabled() const
+{
+  bool bret = false;
+  const ObLogicalOperator *left_child = get_child(first_child);
+  const ObLogicalOperator *right_child = get_child(second_child);
+  if (HASH_JOIN == join_algo_
+      && NULL != left_child
+      && NULL != right_child) {
+    bret = is_probe_too_small_for_cache_aware(left_child->get_card(), right_child->get_card());
+  }
+  return bret;
+}
+
+bool ObLogJoin::is_probe_too_small_for_cache_aware(const double build_rows, const double probe_rows)
+{
+  // the partitioning pass is amortized once the probe side reaches half of the build side,
+  // estimates within a factor of 4 of that bound are left to the operator
+  static const double MIN_PROBE_BUILD_RATIO = 0.5;
+  static const double EST_UNCERTAINTY = 4.0;
+  return probe_rows * EST_UNCERTAINTY < build_rows * MIN_PROBE_BUILD_RATIO;
+}
+
 int ObLogJoin::compute_table_set()
 {
   int ret = OB_SUCCESS;
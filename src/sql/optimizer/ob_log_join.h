@@ -60,6 +60,9 @@ namespace sql
     inline bool is_shared_hash_join() const
     { return HASH_JOIN == join_algo_ && DIST_BC2HOST_NONE == join_dist_algo_; }
     int is_left_unique(bool &left_unique) const;
+    // Whether the plan rules out the radix partitioned (cache aware) in-memory hash join
+    bool is_cache_aware_hash_join_disabled() const;
+    static bool is_probe_too_small_for_cache_aware(const double build_rows, const double probe_rows);
     inline int add_join_condition(ObRawExpr *expr) { return join_conditions_.push_back(expr); }
     inline int add_join_filter(ObRawExpr *expr) { return join_filters_.push_back(expr); }
     const common::ObIArray<ObRawExpr *> &get_equal_join_conditions() const { return join_conditions_; }
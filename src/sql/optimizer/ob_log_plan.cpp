@@ -6698,7 +6698,11 @@ int ObLogPlan::check_scalar_groupby_pushdown(const ObIArray<ObAggFunRawExpr *> &
     if (OB_ISNULL(cur_aggr = aggrs.at(i))) {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("get unexpected null", K(ret));
-    } else if (T_FUN_COUNT != cur_aggr->get_expr_type()) {
+    } else if (T_FUN_COUNT != cur_aggr->get_expr_type() &&
+               T_FUN_MIN != cur_aggr->get_expr_type() &&
+               T_FUN_MAX != cur_aggr->get_expr_type() &&
+               T_FUN_SUM != cur_aggr->get_expr_type() &&
+               T_FUN_APPROX_COUNT_DISTINCT_SYNOPSIS != cur_aggr->get_expr_type()) {
       can_push = false;
     } else if (cur_aggr->is_param_distinct() || 1 < cur_aggr->get_real_param_count()) {
       /* mysql mode, support count(distinct c1, c2). if this distinct can be eliminated,
@@ -6712,6 +6716,35 @@ int ObLogPlan::check_scalar_groupby_pushdown(const ObIArray<ObAggFunRawExpr *> &
     } else if (!first_param->is_column_ref_expr() ||
                table_item->table_id_ != static_cast<ObColumnRefRawExpr*>(first_param)->get_table_id()) {
       can_push = false;
+    } else if (T_FUN_COUNT != cur_aggr->get_expr_type()) {
+      // min/max/sum/approx count distinct are calculated by storage on the column type directly
+      const ObObjTypeClass param_tc = first_param->get_result_type().get_type_class();
+      const ObObjTypeClass result_tc = cur_aggr->get_result_type().get_type_class();
+      if (T_FUN_SUM == cur_aggr->get_expr_type()) {
+        can_push = ((ObIntTC == param_tc || ObUIntTC == param_tc || ObNumberTC == param_tc)
+                    && ObNumberTC == result_tc)
+                   || (ObDoubleTC == param_tc && ObDoubleTC == result_tc);
+      } else {
+        switch (param_tc) {
+          case ObIntTC:
+          case ObUIntTC:
+          case ObFloatTC:
+          case ObDoubleTC:
+          case ObNumberTC:
+          case ObDateTimeTC:
+          case ObDateTC:
+          case ObTimeTC:
+          case ObYearTC:
+          case ObStringTC:
+          case ObOTimestampTC: {
+            break;
+          }
+          default: {
+            can_push = false;
+            break;
+          }
+        }
+      }
     }
   }
   return ret;
@@ -48,7 +48,7 @@ int ObLogSort::create_encode_sortkey_expr(const common::ObIArray<OrderItem> &ord
     // Prefix sort and hash-based sort both can combine with encode sort.
     // And prefix sort is prior to hash-based sort(part sort).
     if (is_prefix_sort() || is_part_sort()) {
-      int64_t orig_pos = is_prefix_sort() ? get_prefix_pos() : get_part_cnt();
+      int64_t orig_pos = get_encode_start_pos();
       for (int64_t i = 0; OB_SUCC(ret) && i < orig_pos; ++i) {
         if (OB_FAIL(encode_sortkeys_.push_back(order_keys.at(i)))) {
           LOG_WARN("failed to add encodekey", K(ret));
@@ -59,15 +59,30 @@ int ObLogSort::create_encode_sortkey_expr(const common::ObIArray<OrderItem> &ord
     } else {
       ecd_pos = 0;
     }
+    // Leading keys which can be encoded are combined into one memcmp-able key,
+    // keys after them are kept to break ties of the encoded key.
+    const int64_t ecd_end = ecd_pos + ObSQLUtils::get_encodable_sortkey_cnt(order_keys, ecd_pos);
     ObRawExprFactory &expr_factory = get_plan()->get_optimizer_context().get_expr_factory();
     ObExecContext* exec_ctx = get_plan()->get_optimizer_context().get_exec_ctx();
+    ObSEArray<OrderItem, 8> ecd_keys;
     OrderItem encode_sortkey;
-    if (OB_FAIL(ObSQLUtils::create_encode_sortkey_expr(
-        expr_factory, exec_ctx, order_keys, ecd_pos, encode_sortkey))) {
+    for (int64_t i = ecd_pos; OB_SUCC(ret) && i < ecd_end; ++i) {
+      if (OB_FAIL(ecd_keys.push_back(order_keys.at(i)))) {
+        LOG_WARN("failed to push back encode key", K(ret));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(ObSQLUtils::create_encode_sortkey_expr(
+        expr_factory, exec_ctx, ecd_keys, 0, encode_sortkey))) {
       LOG_WARN("failed to create encode sortkey expr", K(ret));
     } else if (OB_FAIL(encode_sortkeys_.push_back(encode_sortkey))) {
       LOG_WARN("failed to push back encode sortkey", K(ret));
     } else { /* do nothing*/ }
+    for (int64_t i = ecd_end; OB_SUCC(ret) && i < order_keys.count(); ++i) {
+      if (OB_FAIL(encode_sortkeys_.push_back(order_keys.at(i)))) {
+        LOG_WARN("failed to add tie-breaking sortkey", K(ret));
+      }
+    }
   }
   return ret;
 }
@@ -122,7 +137,7 @@ int ObLogSort::get_op_exprs(ObIArray<ObRawExpr*> &all_exprs)
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("get unexpected null", K(get_plan()), K(ret));
   } else if (GCONF._enable_newsort
-      && ObSQLUtils::check_can_encode_sortkey(sort_keys_)
+      && ObSQLUtils::get_encodable_sortkey_cnt(sort_keys_, get_encode_start_pos()) > 0
       && OB_FAIL(create_encode_sortkey_expr(sort_keys_))) {
     LOG_WARN("failed to create encode sortkey expr", K(ret));
   } else {
@@ -71,6 +71,11 @@ namespace sql
     inline bool enable_encode_sortkey_opt() const { return encode_sortkeys_.count()!=0; }
     inline int64_t get_part_cnt() const { return part_cnt_; }
     inline int64_t get_prefix_pos() const { return prefix_pos_; }
+    // keys before this position are not encoded, they are used by prefix sort or part sort
+    inline int64_t get_encode_start_pos() const
+    {
+      return is_prefix_sort() ? prefix_pos_ : (is_part_sort() ? part_cnt_ : 0);
+    }
     inline ObRawExpr *get_topn_expr() const { return topn_expr_; }
     inline void set_topk_limit_expr(ObRawExpr *top_limit_expr)
     {
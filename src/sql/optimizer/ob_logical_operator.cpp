@@ -5082,6 +5082,7 @@ int ObLogicalOperator::allocate_normal_join_filter(const ObIArray<JoinFilterInfo
     DistAlgo join_dist_algo = static_cast<ObLogJoin*>(this)->get_join_distributed_method();
     for (int i = 0; i < infos.count() && OB_SUCC(ret); ++i) {
       bool right_has_exchange = false;
+      int64_t filter_len = 0;
       filter_create = NULL;
       filter_use = NULL;
       const JoinFilterInfo &info = infos.at(i);
@@ -5097,6 +5098,10 @@ int ObLogicalOperator::allocate_normal_join_filter(const ObIArray<JoinFilterInfo
                                          node,
                                          right_has_exchange))) {
         LOG_WARN("failed to find table scan", K(ret));
+      } else if (OB_FAIL(calc_join_filter_length(get_child(first_child),
+                                                 info.lexprs_,
+                                                 filter_len))) {
+        LOG_WARN("failed to calc join filter length", K(ret));
       } else if (OB_ISNULL(node)) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("unexpect null table scan", K(ret));
@@ -5111,10 +5116,8 @@ int ObLogicalOperator::allocate_normal_join_filter(const ObIArray<JoinFilterInfo
         get_child(first_child)->set_parent(join_filter_create);
         join_filter_create->set_parent(this);
         set_child(first_child, join_filter_create);
-        join_filter_create->set_filter_length(join_filter_create->
-            get_child(first_child)->get_card());
-        join_filter_use->set_filter_length(
-            join_filter_create->get_child(first_child)->get_card());
+        join_filter_create->set_filter_length(filter_len);
+        join_filter_use->set_filter_length(filter_len);
         for (int64_t i = 0; OB_SUCC(ret) && i < node->get_parent()->get_num_of_child(); ++i) {
           if (node->get_parent()->get_child(i) == node) {
             node->get_parent()->set_child(i, join_filter_use);
@@ -5157,6 +5160,38 @@ int ObLogicalOperator::allocate_normal_join_filter(const ObIArray<JoinFilterInfo
   return ret;
 }
 
+// Duplicated build keys set the same bits, so the bloom filter is sized by the
+// distinct count of the build keys rather than the build rows.
+int ObLogicalOperator::calc_join_filter_length(ObLogicalOperator *build_op,
+                                               const ObIArray<ObRawExpr*> &build_exprs,
+                                               int64_t &filter_len)
+{
+  int ret = OB_SUCCESS;
+  double build_ndv = 0.0;
+  filter_len = 0;
+  if (OB_ISNULL(build_op) || OB_ISNULL(get_plan())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(build_op), K(get_plan()), K(ret));
+  } else if (OB_FALSE_IT(get_plan()->get_selectivity_ctx().init_op_ctx(
+      &build_op->get_output_equal_sets(), build_op->get_card()))) {
+  } else if (OB_FAIL(ObOptSelectivity::calculate_distinct(get_plan()->get_update_table_metas(),
+                                                          get_plan()->get_selectivity_ctx(),
+                                                          build_exprs,
+                                                          build_op->get_card(),
+                                                          build_ndv))) {
+    LOG_WARN("failed to calculate distinct", K(ret));
+  } else {
+    filter_len = get_join_filter_length(build_op->get_card(), build_ndv);
+    LOG_TRACE("calc join filter length", K(build_op->get_card()), K(build_ndv), K(filter_len));
+  }
+  return ret;
+}
+
+int64_t ObLogicalOperator::get_join_filter_length(const double build_card, const double build_ndv)
+{
+  return static_cast<int64_t>(std::max(std::min(build_ndv, build_card), 1.0));
+}
+
 int ObLogicalOperator::mark_bloom_filter_id_to_receive_op(ObLogicalOperator *filter_use, int64_t filter_id)
 {
   int ret = OB_SUCCESS;
@@ -1779,6 +1779,10 @@ private:
                                      int64_t &filter_id);
   int allocate_normal_join_filter(const ObIArray<JoinFilterInfo> &infos,
                                   int64_t &filter_id);
+  int calc_join_filter_length(ObLogicalOperator *build_op,
+                              const ObIArray<ObRawExpr*> &build_exprs,
+                              int64_t &filter_len);
+  static int64_t get_join_filter_length(const double build_card, const double build_ndv);
   int mark_bloom_filter_id_to_receive_op(ObLogicalOperator *filter_use, int64_t filter_id);
   int push_down_bloom_filter_expr(ObLogicalOperator *op,
       ObLogicalOperator *join_filter_op, double join_filter_rate);
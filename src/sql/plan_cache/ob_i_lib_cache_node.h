@@ -103,6 +103,8 @@ public:
       rwlock_(),
       ref_count_(0),
       lib_cache_(lib_cache),
+      node_id_(common::OB_INVALID_ID),
+      evict_version_(0),
       co_list_lock_(common::ObLatchIds::PLAN_SET_LOCK),
       co_list_(allocator_)
   {
@@ -160,8 +162,12 @@ public:
   lib::MemoryContext &get_mem_context() { return mem_context_; }
   int64_t get_mem_size();
   ObPlanCache *get_lib_cache() const { return lib_cache_; }
+  uint64_t get_node_id() const { return node_id_; }
+  void set_node_id(const uint64_t node_id) { node_id_ = node_id; }
+  uint64_t get_evict_version() const { return ATOMIC_LOAD(&evict_version_); }
+  void inc_evict_version() { ATOMIC_INC(&evict_version_); }
 
-  VIRTUAL_TO_STRING_KV(K_(ref_count), K_(lock_timeout_ts));
+  VIRTUAL_TO_STRING_KV(K_(ref_count), K_(lock_timeout_ts), K_(node_id), K_(evict_version));
 
 protected:
   void set_lock_timeout_threshold(int64_t threshold)
@@ -209,6 +215,12 @@ protected:
   int64_t lock_timeout_ts_;
   StmtStat node_stat_;
   ObPlanCache *lib_cache_;
+  // id of the node in the node id map of the plan cache, sessions refer to the node by
+  // this id without holding a reference on it
+  uint64_t node_id_;
+  // bumped when the node is removed from the plan cache, an id remembered together with
+  // an older version must not be used any more
+  volatile uint64_t evict_version_;
   common::SpinRWLock co_list_lock_;
   CacheObjList co_list_;
 };
@@ -333,7 +333,8 @@ ObPlanCache::ObPlanCache()
    ref_count_(0),
    ref_handle_mgr_(),
    pcm_(NULL),
-   destroy_(0)
+   destroy_(0),
+   last_node_id_(0)
 {
 }
 
@@ -366,6 +367,11 @@ int ObPlanCache::init(int64_t hash_bucket, common::ObAddr addr,
                                                   ObModIds::OB_HASH_NODE_PLAN_CACHE,
                                                   tenant_id))) {
       SQL_PC_LOG(WARN, "failed to init PlanCache", K(ret));
+    } else if (OB_FAIL(id_node_map_.create(hash::cal_next_prime(hash_bucket),
+                                           ObModIds::OB_HASH_BUCKET_PLAN_CACHE,
+                                           ObModIds::OB_HASH_NODE_PLAN_CACHE,
+                                           tenant_id))) {
+      SQL_PC_LOG(WARN, "failed to init node id map", K(ret));
     } else {
       cn_factory_.set_lib_cache(this);
       ObMemAttr attr = get_mem_attr();
@@ -786,8 +792,17 @@ int ObPlanCache::get_plan_cache(ObILibCacheCtx &ctx,
 {
   int ret = OB_SUCCESS;
   ObPlanCacheCtx &pc_ctx = static_cast<ObPlanCacheCtx&>(ctx);
+  ObSQLSessionInfo *session = pc_ctx.sql_ctx_.session_info_;
   pc_ctx.key_ = &(pc_ctx.fp_result_.pc_key_);
-  if (OB_FAIL(get_cache_obj(ctx, pc_ctx.key_, guard))) {
+  // only text statements are remembered by the session, ps statements are already
+  // looked up by stmt id
+  const bool use_last_hit = OB_NOT_NULL(session)
+                            && !pc_ctx.fp_result_.pc_key_.is_ps_mode_
+                            && ObLibCacheNameSpace::NS_CRSR == pc_ctx.fp_result_.pc_key_.namespace_;
+  bool is_hit = false;
+  if (use_last_hit && OB_FAIL(get_plan_by_last_hit_node(pc_ctx, guard, is_hit))) {
+    SQL_PC_LOG(DEBUG, "failed to get plan by last hit node", K(ret));
+  } else if (!is_hit && OB_FAIL(get_cache_obj(ctx, pc_ctx.key_, guard, use_last_hit))) {
     SQL_PC_LOG(DEBUG, "failed to get plan", K(ret));
   }
   // check the returned error code and whether the plan has expired
@@ -801,6 +816,89 @@ int ObPlanCache::get_plan_cache(ObILibCacheCtx &ctx,
   return ret;
 }
 
+int ObPlanCache::get_plan_by_last_hit_node(ObPlanCacheCtx &pc_ctx,
+                                           ObCacheObjGuard &guard,
+                                           bool &is_hit)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = pc_ctx.sql_ctx_.session_info_;
+  ObILibCacheNode *cache_node = NULL;
+  ObILibCacheObject *cache_obj = NULL;
+  uint64_t node_id = OB_INVALID_ID;
+  is_hit = false;
+  if (OB_ISNULL(session) || OB_ISNULL(pc_ctx.key_)) {
+    ret = OB_INVALID_ARGUMENT;
+    SQL_PC_LOG(WARN, "invalid null argument", K(ret), K(session), K(pc_ctx.key_));
+  } else if (OB_INVALID_ID == (node_id = session->get_pc_last_hit_node_id())) {
+    // nothing remembered
+  } else {
+    // get the read lock and increase reference count
+    ObLibCacheRlockAndRef r_ref_lock(LC_NODE_RD_HANDLE);
+    int hash_err = id_node_map_.read_atomic(node_id, r_ref_lock);
+    if (OB_HASH_NOT_EXIST == hash_err) {
+      // the node has been removed from the plan cache
+      session->reset_pc_last_hit_node();
+    } else if (OB_SUCCESS != hash_err || OB_SUCCESS != r_ref_lock.get_value(cache_node)) {
+      // fall back to cache_key_node_map_
+      cache_node = NULL;
+    } else {
+      if (session->get_pc_last_hit_evict_version() != cache_node->get_evict_version()) {
+        // the node is being removed from the plan cache
+        session->reset_pc_last_hit_node();
+      } else if (!static_cast<ObPCVSet*>(cache_node)->get_plan_cache_key().is_equal(*pc_ctx.key_)) {
+        // another statement, keep the node id for the next time
+      } else {
+        is_hit = true;
+        if (OB_FAIL(cache_node->update_node_stat(pc_ctx))) {
+          SQL_PC_LOG(WARN, "failed to update node stat",  K(ret));
+        } else if (OB_FAIL(cache_node->get_cache_obj(pc_ctx, pc_ctx.key_, cache_obj))) {
+          if (OB_SQL_PC_NOT_EXIST != ret) {
+            LOG_DEBUG("cache_node fail to get cache obj", K(ret));
+          }
+        } else {
+          guard.cache_obj_ = cache_obj;
+          LOG_DEBUG("succ to get cache obj by last hit node", KPC(pc_ctx.key_));
+        }
+        NG_TRACE(pc_choose_plan);
+      }
+      // release lock whatever
+      (void)cache_node->unlock();
+      (void)cache_node->dec_ref_count(LC_NODE_RD_HANDLE);
+    }
+  }
+  return ret;
+}
+
+int ObPlanCache::add_node_id(ObILibCacheNode *node)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(node)) {
+    ret = OB_INVALID_ARGUMENT;
+    SQL_PC_LOG(WARN, "invalid null argument", K(ret));
+  } else {
+    node->set_node_id(ATOMIC_AAF(&last_node_id_, 1));
+    if (OB_FAIL(id_node_map_.set_refactored(node->get_node_id(), node))) {
+      SQL_PC_LOG(WARN, "failed to add node to id map", K(ret), KPC(node));
+      node->set_node_id(OB_INVALID_ID);
+    }
+  }
+  return ret;
+}
+
+void ObPlanCache::remove_node_id(ObILibCacheNode *node)
+{
+  int ret = OB_SUCCESS;
+  if (OB_NOT_NULL(node)) {
+    // sessions that got the node by id before it is erased see the new version
+    node->inc_evict_version();
+    if (OB_INVALID_ID != node->get_node_id()
+        && OB_FAIL(id_node_map_.erase_refactored(node->get_node_id()))
+        && OB_HASH_NOT_EXIST != ret) {
+      SQL_PC_LOG(WARN, "failed to erase node from id map", K(ret), KPC(node));
+    }
+  }
+}
+
 int ObPlanCache::add_cache_obj(ObILibCacheCtx &ctx,
                                ObILibCacheKey *key,
                                ObILibCacheObject *cache_obj)
@@ -833,8 +931,16 @@ int ObPlanCache::add_cache_obj(ObILibCacheCtx &ctx,
     }
     if (OB_SUCC(ret)) {
       cache_node->inc_ref_count(LC_NODE_HANDLE); //inc ref count in block
+      // only the pcv sets of text statements are looked up by the id remembered in the
+      // session, a node missing in id_node_map_ is still found by its key. the id is added
+      // before the key, so that a concurrent remove_cache_node always finds it
+      if (ObLibCacheNameSpace::NS_CRSR == cache_obj->get_ns()
+          && OB_SUCCESS != add_node_id(cache_node)) {
+        SQL_PC_LOG(DEBUG, "failed to add node id", KPC(cache_node));
+      }
       int hash_err = cache_key_node_map_.set_refactored(cache_key, cache_node);
       if (OB_HASH_EXIST == hash_err) { //may be this node has been set by other thread。
+        remove_node_id(cache_node);
         cache_node->unlock();
         // before add_cache_obj again, first need to release the cache key and cache node
         // that has not been added to cache_key_node_map_.
@@ -876,6 +982,7 @@ int ObPlanCache::add_cache_obj(ObILibCacheCtx &ctx,
             ret = OB_ERR_UNEXPECTED;
             LOG_WARN("unexpected error", K(ret), K(tmp_ret), K(del_node), K(cache_node));
           } else {
+            remove_node_id(cache_node);
             cache_node->unlock();
             cache_node->dec_ref_count(LC_NODE_HANDLE); //cache node dec ref in block
             cache_node->dec_ref_count(LC_NODE_HANDLE); //cache node dec ref in alloc
@@ -886,6 +993,7 @@ int ObPlanCache::add_cache_obj(ObILibCacheCtx &ctx,
         }
       } else {
         SQL_PC_LOG(TRACE, "failed to add node to key_node_map", K(ret), KPC(cache_obj));
+        remove_node_id(cache_node);
         cache_node->unlock();
         cache_node->dec_ref_count(LC_NODE_HANDLE); //cache node dec ref in block
         cache_node->dec_ref_count(LC_NODE_HANDLE); //cache node dec ref in alloc
@@ -909,7 +1017,8 @@ int ObPlanCache::add_cache_obj(ObILibCacheCtx &ctx,
 
 int ObPlanCache::get_cache_obj(ObILibCacheCtx &ctx,
                                ObILibCacheKey *key,
-                               ObCacheObjGuard &guard)
+                               ObCacheObjGuard &guard,
+                               const bool remember_hit_node /*= false*/)
 {
   int ret = OB_SUCCESS;
   ObILibCacheNode *cache_node = NULL;
@@ -936,6 +1045,11 @@ int ObPlanCache::get_cache_obj(ObILibCacheCtx &ctx,
     } else {
       guard.cache_obj_ = cache_obj;
       LOG_DEBUG("succ to get cache obj", KPC(key));
+      if (remember_hit_node && OB_INVALID_ID != cache_node->get_node_id()) {
+        // only set by get_plan_cache, ctx is a ObPlanCacheCtx with a session then
+        static_cast<ObPlanCacheCtx&>(ctx).sql_ctx_.session_info_->set_pc_last_hit_node(
+            cache_node->get_node_id(), cache_node->get_evict_version());
+      }
     }
     // release lock whatever
     (void)cache_node->unlock();
@@ -1279,6 +1393,7 @@ int ObPlanCache::remove_cache_node(ObILibCacheKey *key)
   hash_err = cache_key_node_map_.erase_refactored(key, &del_node);
   if (OB_SUCCESS == hash_err) {
     if (NULL != del_node) {
+      remove_node_id(del_node);
       del_node->dec_ref_count(LC_NODE_HANDLE);
     } else {
       ret = OB_ERR_UNEXPECTED;
@@ -159,6 +159,7 @@ public:
   static const int64_t EVICT_KEY_NUM = 8;
   static const int64_t MAX_TENANT_MEM = ((int64_t)(1) << 40); // 1T
   typedef common::hash::ObHashMap<ObILibCacheKey*, ObILibCacheNode*> CacheKeyNodeMap;
+  typedef common::hash::ObHashMap<uint64_t, ObILibCacheNode*> IdCacheNodeMap;
   typedef common::ObSEArray<uint64_t, 1024> PlanIdArray;
 
   ObPlanCache();
@@ -194,7 +195,10 @@ public:
   int ref_cache_obj(const ObCacheObjID obj_id, ObCacheObjGuard& guard);
   int ref_plan(const ObCacheObjID obj_id, ObCacheObjGuard& guard);
   int add_cache_obj(ObILibCacheCtx &ctx, ObILibCacheKey *key, ObILibCacheObject *cache_obj);
-  int get_cache_obj(ObILibCacheCtx &ctx, ObILibCacheKey *key, ObCacheObjGuard &guard);
+  int get_cache_obj(ObILibCacheCtx &ctx,
+                    ObILibCacheKey *key,
+                    ObCacheObjGuard &guard,
+                    const bool remember_hit_node = false);
   int cache_node_exists(ObILibCacheKey* key, bool& is_exists);
   int add_exists_cache_obj_by_stmt_id(ObILibCacheCtx &ctx,
                                       ObILibCacheObject *cache_obj);
@@ -336,6 +340,14 @@ private:
                      ObILibCacheObject *cache_obj);
   int get_plan_cache(ObILibCacheCtx &ctx,
                      ObCacheObjGuard &guard);
+  // try the pcv set hit by the last text statement of the session before the lookup of
+  // cache_key_node_map_, is_hit is false if the caller must fall back to the map
+  int get_plan_by_last_hit_node(ObPlanCacheCtx &pc_ctx,
+                                ObCacheObjGuard &guard,
+                                bool &is_hit);
+  // add the node to id_node_map_ / remove it, the caller holds a reference on the node
+  int add_node_id(ObILibCacheNode *node);
+  void remove_node_id(ObILibCacheNode *node);
   int get_value(ObILibCacheKey *key,
                 ObILibCacheNode *&node,
                 ObLibCacheAtomicOp &op);
@@ -387,6 +399,10 @@ private:
   ObLCObjectManager co_mgr_;
   ObLCNodeFactory cn_factory_;
   CacheKeyNodeMap cache_key_node_map_;
+  // pcv sets of text statements by node id, a session remembers the node id and evict
+  // version of the pcv set it hit last instead of holding a reference on it
+  IdCacheNodeMap id_node_map_;
+  volatile uint64_t last_node_id_;
 };
 
 template<typename _callback>
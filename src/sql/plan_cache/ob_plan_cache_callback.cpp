@@ -30,6 +30,15 @@ void ObLibCacheAtomicOp::operator()(LibCacheKV &entry)
   }
 }
 
+void ObLibCacheAtomicOp::operator()(LibCacheIdKV &entry)
+{
+  if (NULL != entry.second) {
+    entry.second->inc_ref_count(ref_handle_);
+    cache_node_ = entry.second;
+    SQL_PC_LOG(DEBUG, "succ to get cache_node by id", "ref_count", cache_node_->get_ref_count());
+  }
+}
+
 //get cache node and lock
 int ObLibCacheAtomicOp::get_value(ObILibCacheNode *&cache_node)
 {
@@ -24,6 +24,7 @@ class ObLibCacheAtomicOp
 {
 protected:
   typedef common::hash::HashMapPair<ObILibCacheKey*, ObILibCacheNode *> LibCacheKV;
+  typedef common::hash::HashMapPair<uint64_t, ObILibCacheNode *> LibCacheIdKV;
 
 public:
   ObLibCacheAtomicOp(const CacheRefHandleID ref_handle)
@@ -35,6 +36,7 @@ public:
   virtual int get_value(ObILibCacheNode *&cache_node);
   // get cache node and increase reference count
   void operator()(LibCacheKV &entry);
+  void operator()(LibCacheIdKV &entry);
 
 protected:
   // when get value, need lock
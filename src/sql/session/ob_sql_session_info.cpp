@@ -130,6 +130,8 @@ ObSQLSessionInfo::ObSQLSessionInfo() :
       with_tenant_ctx_(NULL),
       request_manager_(NULL),
       plan_cache_(NULL),
+      pc_last_hit_node_id_(OB_INVALID_ID),
+      pc_last_hit_evict_version_(0),
       ps_cache_(NULL),
       found_rows_(1),
       affected_rows_(-1),
@@ -322,6 +324,7 @@ void ObSQLSessionInfo::reset(bool skip_sys_var)
       mem_context_ = NULL;
     }
     cur_exec_ctx_ = nullptr;
+    reset_pc_last_hit_node();
     if (NULL != plan_cache_) {
       plan_cache_->dec_ref_count();
       plan_cache_ = NULL;
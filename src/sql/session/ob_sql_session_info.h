@@ -521,7 +521,11 @@ public:
   void reset(bool skip_sys_var);
   void clean_status();
   void set_plan_cache_manager(ObPlanCacheManager *pcm) { plan_cache_manager_ = pcm; }
-  void set_plan_cache(ObPlanCache *cache) { plan_cache_ = cache; }
+  void set_plan_cache(ObPlanCache *cache)
+  {
+    reset_pc_last_hit_node();
+    plan_cache_ = cache;
+  }
   void set_ps_cache(ObPsCache *cache) { ps_cache_ = cache; }
   const common::ObWarningBuffer &get_show_warnings_buffer() const { return show_warnings_buf_; }
   const common::ObWarningBuffer &get_warnings_buffer() const { return warnings_buf_; }
@@ -536,6 +540,21 @@ public:
   ObPrivSet get_user_priv_set() const { return user_priv_set_; }
   ObPrivSet get_db_priv_set() const { return db_priv_set_; }
   ObPlanCache *get_plan_cache();
+  // node id and evict version of the pcv set hit by the last text statement of this
+  // session, used by the plan cache to skip the lookup of its key map when the same
+  // statement is executed repeatedly. no reference is held on the pcv set
+  uint64_t get_pc_last_hit_node_id() const { return pc_last_hit_node_id_; }
+  uint64_t get_pc_last_hit_evict_version() const { return pc_last_hit_evict_version_; }
+  void set_pc_last_hit_node(const uint64_t node_id, const uint64_t evict_version)
+  {
+    pc_last_hit_node_id_ = node_id;
+    pc_last_hit_evict_version_ = evict_version;
+  }
+  void reset_pc_last_hit_node()
+  {
+    pc_last_hit_node_id_ = common::OB_INVALID_ID;
+    pc_last_hit_evict_version_ = 0;
+  }
   ObPsCache *get_ps_cache();
   ObPlanCacheManager *get_plan_cache_manager() { return plan_cache_manager_; }
   obmysql::ObMySQLRequestManager *get_request_manager();
@@ -979,6 +998,8 @@ private:
   share::ObTenantSpaceFetcher* with_tenant_ctx_;
   obmysql::ObMySQLRequestManager *request_manager_;
   ObPlanCache *plan_cache_;
+  uint64_t pc_last_hit_node_id_;
+  uint64_t pc_last_hit_evict_version_;
   ObPsCache *ps_cache_;
   //记录select stmt中scan出来的结果集行数，供设置sql_calc_found_row时，found_row()使用；
   int64_t found_rows_;
@@ -15,6 +15,8 @@
 #include "lib/oblog/ob_log_module.h"
 #include "lib/number/ob_number_v2.h"
 #include "common/sql_mode/ob_sql_mode_utils.h"
+#include "sql/engine/expr/ob_expr_add.h"
+#include "sql/engine/aggregate/ob_aggregate_processor.h"
 #include "storage/blocksstable/ob_micro_block_reader.h"
 #include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
 #include "storage/blocksstable/ob_index_block_row_struct.h"
@@ -30,7 +32,13 @@ ObAggCell::ObAggCell(
     const share::schema::ObColumnParam *col_param,
     sql::ObExpr *expr,
     common::ObIAllocator &allocator)
-    : col_idx_(col_idx), datum_(), col_param_(col_param), expr_(expr), allocator_(allocator)
+    : col_idx_(col_idx), stored_col_idx_(-1), datum_(), col_param_(col_param), expr_(expr),
+      allocator_(allocator),
+      col_datums_(nullptr),
+      cell_datas_(nullptr),
+      datum_buf_(nullptr),
+      datum_buf_size_(0),
+      batch_size_(0)
 {
 }
 
@@ -42,7 +50,17 @@ ObAggCell::~ObAggCell()
 void ObAggCell::reset()
 {
   col_idx_ = -1;
+  stored_col_idx_ = -1;
   expr_ = nullptr;
+  if (nullptr != col_datums_) {
+    // cell_datas_ and datum_buf_ are allocated together with col_datums_
+    allocator_.free(col_datums_);
+    col_datums_ = nullptr;
+  }
+  cell_datas_ = nullptr;
+  datum_buf_ = nullptr;
+  datum_buf_size_ = 0;
+  batch_size_ = 0;
 }
 
 void ObAggCell::reuse()
@@ -67,6 +85,76 @@ int ObAggCell::fill_result(sql::ObEvalCtx &ctx,bool need_padding)
   return ret;
 }
 
+int ObAggCell::init_batch_buf(const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  if (OB_UNLIKELY(batch_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid batch size", K(ret), K(batch_size));
+  } else if (OB_ISNULL(col_param_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected, col param is null", K(ret), K(col_idx_));
+  } else if (OB_UNLIKELY(nullptr != col_datums_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("Batch buffer is inited twice", K(ret), K(*this));
+  } else {
+    // fixed length cells are copied into the datum buffers by the batch decode,
+    // while var length cells are pointed to the micro block data
+    const int64_t datum_buf_size = common::ObDatum::get_reserved_size(
+        common::ObDatum::get_obj_datum_map_type(col_param_->get_meta_type().get_type()));
+    const int64_t alloc_size = (sizeof(common::ObDatum) + sizeof(char *) + datum_buf_size) * batch_size;
+    if (OB_ISNULL(buf = allocator_.alloc(alloc_size))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("Failed to alloc batch buffer", K(ret), K(alloc_size), K(batch_size));
+    } else {
+      col_datums_ = static_cast<common::ObDatum *>(buf);
+      for (int64_t i = 0; i < batch_size; ++i) {
+        new (col_datums_ + i) common::ObDatum();
+      }
+      cell_datas_ = reinterpret_cast<const char **>(col_datums_ + batch_size);
+      datum_buf_ = reinterpret_cast<char *>(cell_datas_ + batch_size);
+      datum_buf_size_ = datum_buf_size;
+      batch_size_ = batch_size;
+    }
+  }
+  return ret;
+}
+
+int ObAggCell::decode_batch(
+    blocksstable::ObIMicroBlockReader *reader,
+    const int64_t *row_ids,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  common::ObSEArray<int32_t, 1> cols;
+  common::ObSEArray<const share::schema::ObColumnParam *, 1> col_params;
+  common::ObSEArray<common::ObDatum *, 1> datums;
+  if (OB_ISNULL(reader) || OB_ISNULL(row_ids) || OB_UNLIKELY(row_count > batch_size_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KP(reader), KP(row_ids), K(row_count), K(*this));
+  } else if (OB_UNLIKELY(blocksstable::ObIMicroBlockReader::Decoder != reader->get_type())) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("Batch decode is only supported by micro block decoder", K(ret), K(reader->get_type()));
+  } else if (OB_FAIL(cols.push_back(col_idx_))) {
+    LOG_WARN("Failed to push back col idx", K(ret));
+  } else if (OB_FAIL(col_params.push_back(nullptr))) {
+    LOG_WARN("Failed to push back col param", K(ret));
+  } else if (OB_FAIL(datums.push_back(col_datums_))) {
+    LOG_WARN("Failed to push back datums", K(ret));
+  } else {
+    // datums may be pointed to the last micro block by var length decode
+    for (int64_t i = 0; i < row_count; ++i) {
+      col_datums_[i].ptr_ = datum_buf_ + i * datum_buf_size_;
+    }
+    if (OB_FAIL(static_cast<blocksstable::ObMicroBlockDecoder *>(reader)->get_rows(
+                cols, col_params, row_ids, cell_datas_, row_count, datums))) {
+      LOG_WARN("Failed to decode rows", K(ret), K(row_count), K(*this));
+    }
+  }
+  return ret;
+}
+
 int ObAggCell::fill_default_if_need(blocksstable::ObStorageDatum &datum)
 {
   int ret = OB_SUCCESS;
@@ -100,6 +188,26 @@ int ObAggCell::pad_column_if_need(blocksstable::ObStorageDatum &datum)
   return ret;
 }
 
+int ObAggCell::read_agg_col_info(
+    const blocksstable::ObMicroIndexInfo &index_info,
+    blocksstable::ObAggColumnInfo &col_info,
+    bool &found) const
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObAggRowReader agg_reader;
+  found = false;
+  if (stored_col_idx_ < 0 || !index_info.is_pre_aggregated()) {
+  } else if (OB_FAIL(agg_reader.init(index_info.get_agg_row_buf(), index_info.get_agg_buf_size()))) {
+    LOG_WARN("Failed to init agg row reader", K(ret), K(index_info));
+  } else if (stored_col_idx_ >= agg_reader.get_column_count()) {
+  } else if (OB_FAIL(agg_reader.read(stored_col_idx_, col_info))) {
+    LOG_WARN("Failed to read pre-aggregated column", K(ret), K_(stored_col_idx), K(agg_reader));
+  } else {
+    found = true;
+  }
+  return ret;
+}
+
 ObFirstRowAggCell::ObFirstRowAggCell(
     const int32_t col_idx,
     const share::schema::ObColumnParam *col_param,
@@ -237,14 +345,32 @@ int ObCountAggCell::process(const blocksstable::ObMicroIndexInfo &index_info)
   } else if (!exclude_null_) {
     row_count_ += index_info.get_row_count();
   } else {
-    // TODO, extract from pre-agginfo
-    ret = OB_NOT_SUPPORTED;
-    LOG_WARN("exclude null is not supported", K(ret));
+    blocksstable::ObAggColumnInfo col_info;
+    bool found = false;
+    if (OB_FAIL(read_agg_col_info(index_info, col_info, found))) {
+      LOG_WARN("Failed to read agg column info", K(ret), K(*this));
+    } else if (OB_UNLIKELY(!found)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected, null count is not pre-aggregated", K(ret), K(*this), K(index_info));
+    } else {
+      row_count_ += index_info.get_row_count() - col_info.null_count_;
+    }
   }
   LOG_DEBUG("after count index info", K(ret), K(index_info.get_row_count()), K(row_count_));
   return ret;
 }
 
+bool ObCountAggCell::can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  bool bret = true;
+  if (exclude_null_) {
+    blocksstable::ObAggColumnInfo col_info;
+    bool found = false;
+    bret = OB_SUCCESS == read_agg_col_info(index_info, col_info, found) && found;
+  }
+  return bret;
+}
+
 int ObCountAggCell::fill_result(sql::ObEvalCtx &ctx, bool need_padding)
 {
   UNUSED(need_padding);
@@ -269,9 +395,597 @@ int ObCountAggCell::fill_result(sql::ObEvalCtx &ctx, bool need_padding)
   return ret;
 }
 
+ObMinMaxAggCell::ObMinMaxAggCell(
+    const int32_t col_idx,
+    const share::schema::ObColumnParam *col_param,
+    sql::ObExpr *expr,
+    common::ObIAllocator &allocator,
+    const bool is_min)
+    : ObAggCell(col_idx, col_param, expr, allocator),
+      cmp_func_(nullptr),
+      buf_(nullptr),
+      buf_size_(0),
+      is_min_(is_min)
+{
+  datum_.set_null();
+}
+
+int ObMinMaxAggCell::init()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(col_param_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected, col param is null", K(ret), K(col_idx_));
+  } else {
+    const common::ObObjMeta &col_type = col_param_->get_meta_type();
+    cmp_func_ = common::ObDatumFuncs::get_nullsafe_cmp_func(col_type.get_type(),
+                                                            col_type.get_type(),
+                                                            common::NULL_FIRST,
+                                                            col_type.get_collation_type(),
+                                                            lib::is_oracle_mode());
+    if (OB_ISNULL(cmp_func_)) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("Agg min/max of this column type is not supported", K(ret), K(col_type));
+    }
+  }
+  return ret;
+}
+
+void ObMinMaxAggCell::reset()
+{
+  ObAggCell::reset();
+  if (nullptr != buf_) {
+    allocator_.free(buf_);
+    buf_ = nullptr;
+  }
+  buf_size_ = 0;
+  cmp_func_ = nullptr;
+  datum_.set_null();
+}
+
+void ObMinMaxAggCell::reuse()
+{
+  datum_.set_null();
+}
+
+int ObMinMaxAggCell::process(blocksstable::ObDatumRow &row)
+{
+  return process_datum(row.storage_datums_[col_idx_]);
+}
+
+int ObMinMaxAggCell::process(
+    blocksstable::ObIMicroBlockReader *reader,
+    int64_t *row_ids,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObStorageDatum datum;
+  if (OB_FAIL(decode_batch(reader, row_ids, row_count))) {
+    LOG_WARN("Failed to decode batch", K(ret), K(row_count), K(*this));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+    static_cast<common::ObDatum &>(datum) = col_datums_[i];
+    if (OB_FAIL(process_datum(datum))) {
+      LOG_WARN("Failed to process datum", K(ret), K(i), K(row_ids[i]));
+    }
+  }
+  return ret;
+}
+
+int ObMinMaxAggCell::process_datum(blocksstable::ObStorageDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(fill_default_if_need(datum))) {
+    LOG_WARN("Failed to fill default", K(ret), K(*this));
+  } else if (datum.is_null()) {
+  } else if (OB_FAIL(update(datum))) {
+    LOG_WARN("Failed to update min/max", K(ret), K(datum), K(*this));
+  }
+  return ret;
+}
+
+int ObMinMaxAggCell::process(const blocksstable::ObMicroIndexInfo &index_info)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObAggColumnInfo col_info;
+  bool found = false;
+  if (OB_FAIL(read_agg_col_info(index_info, col_info, found))) {
+    LOG_WARN("Failed to read agg column info", K(ret), K(*this));
+  } else if (OB_UNLIKELY(!found)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected, min/max is not pre-aggregated", K(ret), K(*this), K(index_info));
+  } else if (!col_info.has_min_max()) {
+    // all cells are null
+  } else if (OB_FAIL(update(is_min_ ? col_info.min_ : col_info.max_))) {
+    LOG_WARN("Failed to update min/max", K(ret), K(col_info), K(*this));
+  }
+  return ret;
+}
+
+bool ObMinMaxAggCell::can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  blocksstable::ObAggColumnInfo col_info;
+  bool found = false;
+  return OB_SUCCESS == read_agg_col_info(index_info, col_info, found) && found &&
+         (col_info.has_min_max() || index_info.get_row_count() == col_info.null_count_);
+}
+
+int ObMinMaxAggCell::update(const blocksstable::ObStorageDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  bool need_update = datum_.is_null();
+  if (!need_update) {
+    const int cmp_ret = cmp_func_(datum, datum_);
+    need_update = is_min_ ? cmp_ret < 0 : cmp_ret > 0;
+  }
+  if (need_update) {
+    // values are deep copied into buf_, which is reused until a longer value comes
+    const int64_t copy_size = datum.get_deep_copy_size();
+    int64_t pos = 0;
+    if (copy_size > buf_size_) {
+      char *new_buf = nullptr;
+      if (OB_ISNULL(new_buf = static_cast<char *>(allocator_.alloc(copy_size)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("Failed to alloc memory for min/max datum", K(ret), K(copy_size));
+      } else {
+        if (nullptr != buf_) {
+          allocator_.free(buf_);
+        }
+        buf_ = new_buf;
+        buf_size_ = copy_size;
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(datum_.deep_copy(datum, buf_, buf_size_, pos))) {
+      LOG_WARN("Failed to deep copy datum", K(ret), K(datum), K_(buf_size));
+    }
+  }
+  return ret;
+}
+
+ObSumAggCell::ObSumAggCell(
+    const int32_t col_idx,
+    const share::schema::ObColumnParam *col_param,
+    sql::ObExpr *expr,
+    common::ObIAllocator &allocator)
+    : ObAggCell(col_idx, col_param, expr, allocator),
+      sum_tc_(common::ObNullTC),
+      int_sum_(0),
+      uint_sum_(0),
+      double_sum_(0),
+      num_sum_(),
+      has_value_(false)
+{
+  num_sum_.set_zero();
+}
+
+int ObSumAggCell::init()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(col_param_) || OB_ISNULL(expr_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected, col param or expr is null", K(ret), K(col_idx_), KP_(expr));
+  } else {
+    const common::ObObjTypeClass res_tc = ob_obj_type_class(expr_->datum_meta_.type_);
+    sum_tc_ = col_param_->get_meta_type().get_type_class();
+    switch (sum_tc_) {
+      case common::ObIntTC:
+      case common::ObUIntTC:
+      case common::ObNumberTC: {
+        if (common::ObNumberTC != res_tc) {
+          ret = OB_NOT_SUPPORTED;
+        }
+        break;
+      }
+      case common::ObDoubleTC: {
+        if (common::ObDoubleTC != res_tc) {
+          ret = OB_NOT_SUPPORTED;
+        }
+        break;
+      }
+      default: {
+        ret = OB_NOT_SUPPORTED;
+        break;
+      }
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("Agg sum of this column type is not supported", K(ret), K_(sum_tc), K(res_tc));
+    }
+  }
+  return ret;
+}
+
+void ObSumAggCell::reset()
+{
+  ObAggCell::reset();
+  reuse();
+  sum_tc_ = common::ObNullTC;
+}
+
+void ObSumAggCell::reuse()
+{
+  int_sum_ = 0;
+  uint_sum_ = 0;
+  double_sum_ = 0;
+  num_sum_.set_zero();
+  has_value_ = false;
+}
+
+int ObSumAggCell::process(blocksstable::ObDatumRow &row)
+{
+  return process_datum(row.storage_datums_[col_idx_]);
+}
+
+int ObSumAggCell::process(
+    blocksstable::ObIMicroBlockReader *reader,
+    int64_t *row_ids,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObStorageDatum datum;
+  if (OB_FAIL(decode_batch(reader, row_ids, row_count))) {
+    LOG_WARN("Failed to decode batch", K(ret), K(row_count), K(*this));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+    static_cast<common::ObDatum &>(datum) = col_datums_[i];
+    if (OB_FAIL(process_datum(datum))) {
+      LOG_WARN("Failed to process datum", K(ret), K(i), K(row_ids[i]));
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::process_datum(blocksstable::ObStorageDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(fill_default_if_need(datum))) {
+    LOG_WARN("Failed to fill default", K(ret), K(*this));
+  } else if (datum.is_null()) {
+  } else {
+    switch (sum_tc_) {
+      case common::ObIntTC: {
+        ret = add_int(datum.get_int());
+        break;
+      }
+      case common::ObUIntTC: {
+        ret = add_uint(datum.get_uint());
+        break;
+      }
+      case common::ObNumberTC: {
+        ret = add_number(common::number::ObNumber(datum.get_number()));
+        break;
+      }
+      case common::ObDoubleTC: {
+        double_sum_ += datum.get_double();
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        break;
+      }
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("Failed to add sum", K(ret), K(datum), K(*this));
+    } else {
+      has_value_ = true;
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::process(const blocksstable::ObMicroIndexInfo &index_info)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObAggColumnInfo col_info;
+  bool found = false;
+  if (OB_FAIL(read_agg_col_info(index_info, col_info, found))) {
+    LOG_WARN("Failed to read agg column info", K(ret), K(*this));
+  } else if (OB_UNLIKELY(!found)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected, sum is not pre-aggregated", K(ret), K(*this), K(index_info));
+  } else if (index_info.get_row_count() == col_info.null_count_) {
+    // all cells are null
+  } else {
+    switch (col_info.sum_type_) {
+      case blocksstable::AGG_SUM_INT: {
+        ret = add_int(col_info.int_sum_);
+        break;
+      }
+      case blocksstable::AGG_SUM_UINT: {
+        ret = add_uint(col_info.uint_sum_);
+        break;
+      }
+      case blocksstable::AGG_SUM_DOUBLE: {
+        double_sum_ += col_info.double_sum_;
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        break;
+      }
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("Failed to add pre-aggregated sum", K(ret), K(col_info), K(*this));
+    } else {
+      has_value_ = true;
+    }
+  }
+  return ret;
+}
+
+bool ObSumAggCell::can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  bool bret = false;
+  blocksstable::ObAggColumnInfo col_info;
+  bool found = false;
+  if (OB_SUCCESS != read_agg_col_info(index_info, col_info, found) || !found) {
+  } else if (index_info.get_row_count() == col_info.null_count_) {
+    bret = true;
+  } else {
+    switch (sum_tc_) {
+      case common::ObIntTC: {
+        bret = blocksstable::AGG_SUM_INT == col_info.sum_type_;
+        break;
+      }
+      case common::ObUIntTC: {
+        bret = blocksstable::AGG_SUM_UINT == col_info.sum_type_;
+        break;
+      }
+      case common::ObDoubleTC: {
+        bret = blocksstable::AGG_SUM_DOUBLE == col_info.sum_type_;
+        break;
+      }
+      default: {
+        // sum of number is not pre-aggregated
+        break;
+      }
+    }
+  }
+  return bret;
+}
+
+int ObSumAggCell::fill_result(sql::ObEvalCtx &ctx, bool need_padding)
+{
+  UNUSED(need_padding);
+  int ret = OB_SUCCESS;
+  ObDatum &result = expr_->locate_datum_for_write(ctx);
+  sql::ObEvalInfo &eval_info = expr_->get_eval_info(ctx);
+  if (!has_value_) {
+    result.set_null();
+  } else if (common::ObDoubleTC == sum_tc_) {
+    result.set_double(double_sum_);
+  } else {
+    common::number::ObNumber result_num;
+    char local_buff[common::number::ObNumber::MAX_CALC_BYTE_LEN * 2];
+    common::ObDataBuffer local_alloc(local_buff, common::number::ObNumber::MAX_CALC_BYTE_LEN * 2);
+    if (OB_FAIL(get_number_sum(result_num, local_alloc))) {
+      LOG_WARN("Failed to get number sum", K(ret), K(*this));
+    } else {
+      result.set_number(result_num);
+    }
+  }
+  if (OB_SUCC(ret)) {
+    eval_info.evaluated_ = true;
+    LOG_DEBUG("fill result", K(result));
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_int(const int64_t value)
+{
+  int ret = OB_SUCCESS;
+  const int64_t sum = int_sum_ + value;
+  if (sql::ObExprAdd::is_int_int_out_of_range(int_sum_, value, sum)) {
+    common::number::ObNumber num;
+    char local_buff[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+    common::ObDataBuffer local_alloc(local_buff, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+    if (OB_FAIL(num.from(int_sum_, local_alloc))) {
+      LOG_WARN("Failed to cons number from int", K(ret), K_(int_sum));
+    } else if (OB_FAIL(add_number(num))) {
+      LOG_WARN("Failed to add number", K(ret), K(num));
+    } else {
+      int_sum_ = value;
+    }
+  } else {
+    int_sum_ = sum;
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_uint(const uint64_t value)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t sum = uint_sum_ + value;
+  if (sql::ObExprAdd::is_uint_uint_out_of_range(uint_sum_, value, sum)) {
+    common::number::ObNumber num;
+    char local_buff[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+    common::ObDataBuffer local_alloc(local_buff, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+    if (OB_FAIL(num.from(uint_sum_, local_alloc))) {
+      LOG_WARN("Failed to cons number from uint", K(ret), K_(uint_sum));
+    } else if (OB_FAIL(add_number(num))) {
+      LOG_WARN("Failed to add number", K(ret), K(num));
+    } else {
+      uint_sum_ = value;
+    }
+  } else {
+    uint_sum_ = sum;
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_number(const common::number::ObNumber &value)
+{
+  int ret = OB_SUCCESS;
+  common::number::ObNumber result;
+  char local_buff[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+  common::ObDataBuffer local_alloc(local_buff, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+  if (OB_FAIL(num_sum_.add_v3(value, result, local_alloc))) {
+    LOG_WARN("Failed to add number", K(ret), K_(num_sum), K(value));
+  } else if (OB_UNLIKELY(result.get_length() > common::number::ObNumber::MAX_CALC_LEN)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected number length", K(ret), K(result));
+  } else {
+    if (result.get_length() > 0) {
+      MEMCPY(num_digits_, result.get_digits(), result.get_length() * sizeof(uint32_t));
+    }
+    num_sum_.assign(result.get_desc_value(), num_digits_);
+  }
+  return ret;
+}
+
+int ObSumAggCell::get_number_sum(
+    common::number::ObNumber &result,
+    common::ObDataBuffer &allocator) const
+{
+  int ret = OB_SUCCESS;
+  common::number::ObNumber local_sum;
+  if (common::ObNumberTC == sum_tc_) {
+    result = num_sum_;
+  } else if (common::ObIntTC == sum_tc_ && OB_FAIL(local_sum.from(int_sum_, allocator))) {
+    LOG_WARN("Failed to cons number from int", K(ret), K_(int_sum));
+  } else if (common::ObUIntTC == sum_tc_ && OB_FAIL(local_sum.from(uint_sum_, allocator))) {
+    LOG_WARN("Failed to cons number from uint", K(ret), K_(uint_sum));
+  } else if (OB_FAIL(num_sum_.add_v3(local_sum, result, allocator))) {
+    LOG_WARN("Failed to add number", K(ret), K_(num_sum), K(local_sum));
+  }
+  return ret;
+}
+
+ObApproxCountDistinctAggCell::ObApproxCountDistinctAggCell(
+    const int32_t col_idx,
+    const share::schema::ObColumnParam *col_param,
+    sql::ObExpr *expr,
+    common::ObIAllocator &allocator)
+    : ObAggCell(col_idx, col_param, expr, allocator),
+      hash_func_(nullptr),
+      llc_bitmap_(nullptr),
+      llc_size_(0)
+{
+}
+
+int ObApproxCountDistinctAggCell::init()
+{
+  int ret = OB_SUCCESS;
+  sql::ObExprBasicFuncs *basic_funcs = nullptr;
+  if (OB_ISNULL(col_param_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected, col param is null", K(ret), K(col_idx_));
+  } else if (OB_ISNULL(basic_funcs = common::ObDatumFuncs::get_basic_func(
+              col_param_->get_meta_type().get_type(),
+              col_param_->get_meta_type().get_collation_type()))) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("Agg approx count distinct of this column type is not supported", K(ret),
+             K(col_param_->get_meta_type()));
+  } else if (FALSE_IT(llc_size_ = sql::ObAggregateProcessor::get_llc_size())) {
+  } else if (OB_ISNULL(llc_bitmap_ = static_cast<char *>(allocator_.alloc(llc_size_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc memory for llc bitmap", K(ret), K_(llc_size));
+  } else {
+    // same hash as the param column expr in ObAggregateProcessor
+    hash_func_ = basic_funcs->default_hash_;
+    MEMSET(llc_bitmap_, 0, llc_size_);
+  }
+  return ret;
+}
+
+void ObApproxCountDistinctAggCell::reset()
+{
+  ObAggCell::reset();
+  if (nullptr != llc_bitmap_) {
+    allocator_.free(llc_bitmap_);
+    llc_bitmap_ = nullptr;
+  }
+  llc_size_ = 0;
+  hash_func_ = nullptr;
+}
+
+void ObApproxCountDistinctAggCell::reuse()
+{
+  if (nullptr != llc_bitmap_) {
+    MEMSET(llc_bitmap_, 0, llc_size_);
+  }
+}
+
+int ObApproxCountDistinctAggCell::process(blocksstable::ObDatumRow &row)
+{
+  return process_datum(row.storage_datums_[col_idx_]);
+}
+
+int ObApproxCountDistinctAggCell::process(
+    blocksstable::ObIMicroBlockReader *reader,
+    int64_t *row_ids,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObStorageDatum datum;
+  if (OB_FAIL(decode_batch(reader, row_ids, row_count))) {
+    LOG_WARN("Failed to decode batch", K(ret), K(row_count), K(*this));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+    static_cast<common::ObDatum &>(datum) = col_datums_[i];
+    if (OB_FAIL(process_datum(datum))) {
+      LOG_WARN("Failed to process datum", K(ret), K(i), K(row_ids[i]));
+    }
+  }
+  return ret;
+}
+
+int ObApproxCountDistinctAggCell::process(const blocksstable::ObMicroIndexInfo &index_info)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!can_use_index_info(index_info))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected, approx count distinct can only skip blocks of null", K(ret),
+             K(*this), K(index_info));
+  }
+  return ret;
+}
+
+bool ObApproxCountDistinctAggCell::can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  // the sketch can not be pre-aggregated, only blocks of null are skipped
+  blocksstable::ObAggColumnInfo col_info;
+  bool found = false;
+  return OB_SUCCESS == read_agg_col_info(index_info, col_info, found) && found &&
+         index_info.get_row_count() == col_info.null_count_;
+}
+
+int ObApproxCountDistinctAggCell::process_datum(blocksstable::ObStorageDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(fill_default_if_need(datum))) {
+    LOG_WARN("Failed to fill default", K(ret), K(*this));
+  } else if (datum.is_null()) {
+  } else if (OB_FAIL(sql::ObAggregateProcessor::llc_add_value(
+              hash_func_(datum, 0), common::ObString(llc_size_, llc_bitmap_)))) {
+    LOG_WARN("Failed to add llc value", K(ret), K(datum), K(*this));
+  }
+  return ret;
+}
+
+int ObApproxCountDistinctAggCell::fill_result(sql::ObEvalCtx &ctx, bool need_padding)
+{
+  UNUSED(need_padding);
+  int ret = OB_SUCCESS;
+  char *res_buf = nullptr;
+  if (OB_ISNULL(res_buf = expr_->get_str_res_mem(ctx, llc_size_))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc memory for llc bitmap result", K(ret), K_(llc_size));
+  } else {
+    ObDatum &result = expr_->locate_datum_for_write(ctx);
+    sql::ObEvalInfo &eval_info = expr_->get_eval_info(ctx);
+    MEMCPY(res_buf, llc_bitmap_, llc_size_);
+    result.set_string(res_buf, llc_size_);
+    eval_info.evaluated_ = true;
+    LOG_DEBUG("fill result", K(result));
+  }
+  return ret;
+}
+
 ObAggRow::ObAggRow(common::ObIAllocator &allocator) :
     agg_cells_(allocator),
     need_exclude_null_(false),
+    need_access_data_(false),
     allocator_(allocator)
 {
 }
@@ -285,11 +999,13 @@ void ObAggRow::reset()
 {
   for (int64_t i = 0; i < agg_cells_.count(); ++i) {
     if (agg_cells_.at(i)) {
+      agg_cells_.at(i)->~ObAggCell();
       allocator_.free(agg_cells_.at(i));
     }
   }
   agg_cells_.reset();
   need_exclude_null_ = false;
+  need_access_data_ = false;
 }
 
 void ObAggRow::reuse()
@@ -301,13 +1017,14 @@ void ObAggRow::reuse()
   }
 }
 
-int ObAggRow::init(const ObTableAccessParam &param)
+int ObAggRow::init(const ObTableAccessParam &param, const int64_t batch_size)
 {
   int ret = OB_SUCCESS;
   const common::ObIArray<share::schema::ObColumnParam *> *out_cols_param = param.iter_param_.get_col_params();
-  if (OB_ISNULL(out_cols_param)) {
+  const ObTableReadInfo *read_info = param.iter_param_.get_read_info();
+  if (OB_ISNULL(out_cols_param) || OB_ISNULL(read_info)) {
     ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("unexpected null out cols param", K(ret), K_(param.iter_param));
+    LOG_WARN("unexpected null out cols param or read info", K(ret), K_(param.iter_param));
   } else if (OB_FAIL(agg_cells_.init(param.output_exprs_->count() + param.aggregate_exprs_->count()))) {
     LOG_WARN("Failed to init agg cells array", K(ret), K(param.output_exprs_->count()));
   } else {
@@ -330,26 +1047,79 @@ int ObAggRow::init(const ObTableAccessParam &param)
       for (int64_t i = 0; OB_SUCC(ret) && i < param.aggregate_exprs_->count(); ++i) {
         int32_t col_idx = param.iter_param_.agg_cols_project_->at(i);
         sql::ObExpr *expr = param.aggregate_exprs_->at(i);
-        if (T_FUN_COUNT == expr->type_) {
-          bool exclude_null = false;
-          const share::schema::ObColumnParam *col_param = nullptr;
-          if (OB_COUNT_AGG_PD_COLUMN_ID != col_idx) {
-            col_param = out_cols_param->at(col_idx);
-            exclude_null = col_param->is_nullable_for_write();
-          } else {
-            exclude_null = false;
+        const share::schema::ObColumnParam *col_param =
+            OB_COUNT_AGG_PD_COLUMN_ID != col_idx ? out_cols_param->at(col_idx) : nullptr;
+        cell = nullptr;
+        switch (expr->type_) {
+          case T_FUN_COUNT: {
+            const bool exclude_null = nullptr != col_param && col_param->is_nullable_for_write();
+            need_exclude_null_ = need_exclude_null_ || exclude_null;
+            if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObCountAggCell))) ||
+                OB_ISNULL(cell = new(buf) ObCountAggCell(col_idx, col_param, expr, allocator_, exclude_null))) {
+              ret = OB_ALLOCATE_MEMORY_FAILED;
+              LOG_WARN("Failed to alloc memroy for agg cell", K(ret), K(i));
+            } else if (OB_FAIL(agg_cells_.push_back(cell))) {
+              LOG_WARN("Failed to push back agg cell", K(ret), K(i));
+            }
+            break;
           }
-          need_exclude_null_ = need_exclude_null_ || exclude_null;
-          if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObCountAggCell))) ||
-              OB_ISNULL(cell = new(buf) ObCountAggCell(col_idx, col_param, expr, allocator_, exclude_null))) {
-            ret = OB_ALLOCATE_MEMORY_FAILED;
-            LOG_WARN("Failed to alloc memroy for agg cell", K(ret), K(i));
-          } else if (OB_FAIL(agg_cells_.push_back(cell))) {
-            LOG_WARN("Failed to push back agg cell", K(ret), K(i));
+          case T_FUN_MIN:
+          case T_FUN_MAX: {
+            ObMinMaxAggCell *min_max_cell = nullptr;
+            if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObMinMaxAggCell))) ||
+                OB_ISNULL(cell = min_max_cell = new(buf) ObMinMaxAggCell(
+                    col_idx, col_param, expr, allocator_, T_FUN_MIN == expr->type_))) {
+              ret = OB_ALLOCATE_MEMORY_FAILED;
+              LOG_WARN("Failed to alloc memroy for agg cell", K(ret), K(i));
+            } else if (OB_FAIL(agg_cells_.push_back(cell))) {
+              LOG_WARN("Failed to push back agg cell", K(ret), K(i));
+            } else if (OB_FAIL(min_max_cell->init())) {
+              LOG_WARN("Failed to init min/max agg cell", K(ret), K(i));
+            }
+            break;
+          }
+          case T_FUN_SUM: {
+            ObSumAggCell *sum_cell = nullptr;
+            if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObSumAggCell))) ||
+                OB_ISNULL(cell = sum_cell = new(buf) ObSumAggCell(col_idx, col_param, expr, allocator_))) {
+              ret = OB_ALLOCATE_MEMORY_FAILED;
+              LOG_WARN("Failed to alloc memroy for agg cell", K(ret), K(i));
+            } else if (OB_FAIL(agg_cells_.push_back(cell))) {
+              LOG_WARN("Failed to push back agg cell", K(ret), K(i));
+            } else if (OB_FAIL(sum_cell->init())) {
+              LOG_WARN("Failed to init sum agg cell", K(ret), K(i));
+            }
+            break;
+          }
+          case T_FUN_APPROX_COUNT_DISTINCT_SYNOPSIS: {
+            ObApproxCountDistinctAggCell *ndv_cell = nullptr;
+            if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObApproxCountDistinctAggCell))) ||
+                OB_ISNULL(cell = ndv_cell = new(buf) ObApproxCountDistinctAggCell(
+                    col_idx, col_param, expr, allocator_))) {
+              ret = OB_ALLOCATE_MEMORY_FAILED;
+              LOG_WARN("Failed to alloc memroy for agg cell", K(ret), K(i));
+            } else if (OB_FAIL(agg_cells_.push_back(cell))) {
+              LOG_WARN("Failed to push back agg cell", K(ret), K(i));
+            } else if (OB_FAIL(ndv_cell->init())) {
+              LOG_WARN("Failed to init approx count distinct agg cell", K(ret), K(i));
+            }
+            break;
+          }
+          default: {
+            ret = OB_NOT_SUPPORTED;
+            LOG_WARN("Agg function is not supported", K(ret), K(expr->type_));
+            break;
+          }
+        }
+        if (OB_SUCC(ret) && OB_COUNT_AGG_PD_COLUMN_ID != col_idx) {
+          // map to column index in sstable row to locate pre-aggregated data
+          cell->set_stored_col_idx(read_info->get_columns_index().at(col_idx));
+          if (cell->need_access_data()) {
+            need_access_data_ = true;
+            if (OB_FAIL(cell->init_batch_buf(batch_size))) {
+              LOG_WARN("Failed to init batch buf", K(ret), K(i), K(batch_size));
+            }
           }
-        } else {
-          ret = OB_NOT_SUPPORTED;
-          LOG_WARN("Agg min/max/sum is not supported", K(ret));
         }
       }
     }
@@ -360,7 +1130,8 @@ int ObAggRow::init(const ObTableAccessParam &param)
 ObAggregatedStore::ObAggregatedStore(const int64_t batch_size, sql::ObEvalCtx &eval_ctx, ObTableAccessContext &context)
     : ObBlockBatchedRowStore(batch_size, eval_ctx, context),
       is_firstrow_aggregated_(false),
-      agg_row_(*context_.stmt_allocator_)
+      agg_row_(*context_.stmt_allocator_),
+      row_buf_()
 {
 }
 
@@ -373,6 +1144,7 @@ void ObAggregatedStore::reset()
 {
   ObBlockBatchedRowStore::reset();
   agg_row_.reset();
+  row_buf_.reset();
   is_firstrow_aggregated_ = false;
 }
 
@@ -402,8 +1174,11 @@ int ObAggregatedStore::init(const ObTableAccessParam &param)
         K(param.aggregate_exprs_->count()), K(param.iter_param_.agg_cols_project_->count()));
   } else if (OB_FAIL(ObBlockBatchedRowStore::init(param))) {
     LOG_WARN("Failed to init ObBlockBatchedRowStore", K(ret));
-  } else if (OB_FAIL(agg_row_.init(param))) {
+  } else if (OB_FAIL(agg_row_.init(param, batch_size_))) {
     LOG_WARN("Failed to init agg cells", K(ret));
+  } else if (agg_row_.need_access_data() &&
+             OB_FAIL(row_buf_.init(*context_.stmt_allocator_, param.iter_param_.get_out_col_cnt()))) {
+    LOG_WARN("Failed to init row buf", K(ret), K(param.iter_param_.get_out_col_cnt()));
   }
   if (OB_FAIL(ret)) {
     reset();
@@ -428,6 +1203,18 @@ int ObAggregatedStore::fill_index_info(const blocksstable::ObMicroIndexInfo &ind
   return ret;
 }
 
+bool ObAggregatedStore::can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  bool bret = filter_is_null() && can_batched_aggregate() &&
+              index_info.can_blockscan() &&
+              !index_info.is_left_border() &&
+              !index_info.is_right_border();
+  for (int64_t i = 0; bret && i < agg_row_.get_agg_count(); ++i) {
+    bret = agg_row_.at(i)->can_use_index_info(index_info);
+  }
+  return bret;
+}
+
 int ObAggregatedStore::fill_rows(
      const int64_t group_idx,
      blocksstable::ObIMicroBlockReader *reader,
@@ -450,7 +1237,8 @@ int ObAggregatedStore::fill_rows(
     int64_t micro_row_count = 0;
     if (OB_FAIL(reader->get_row_count(micro_row_count))) {
       LOG_WARN("Failed to get micro row count", K(ret));
-    } else if(FALSE_IT(need_get_row_ids = agg_row_.need_exclude_null() || micro_row_count != covered_row_count)) {
+    } else if(FALSE_IT(need_get_row_ids = agg_row_.need_exclude_null() || agg_row_.need_access_data() ||
+                                          micro_row_count != covered_row_count)) {
     } else if (!need_get_row_ids) {
       row_count = nullptr == bitmap ? covered_row_count : bitmap->popcnt();
       for (int64_t i = 0; OB_SUCC(ret) && i < agg_row_.get_agg_count(); ++i) {
@@ -463,6 +1251,9 @@ int ObAggregatedStore::fill_rows(
         begin_index = end_index;
       }
     } else {
+      // cells which need access data decode their column in batch from the micro block decoder,
+      // and fall back to read row by row from the flat micro block reader
+      const bool batch_access_data = can_batch_access_data(reader);
       while (OB_SUCC(ret)) {
         if (OB_FAIL(get_row_ids(reader, begin_index, end_index, row_count, false, bitmap))) {
           if (OB_UNLIKELY(OB_ITER_END != ret)) {
@@ -471,10 +1262,48 @@ int ObAggregatedStore::fill_rows(
         } else {
           for (int64_t i = 0; OB_SUCC(ret) && i < agg_row_.get_agg_count(); ++i) {
             ObAggCell *cell = agg_row_.at(i);
-            if (OB_FAIL(cell->process(reader, row_ids_, row_count))) {
+            if (cell->need_access_data() && !batch_access_data) {
+            } else if (OB_FAIL(cell->process(reader, row_ids_, row_count))) {
               LOG_WARN("Failed to process agg cell", K(ret), K(i), K(*cell), K(begin_index), K(end_index));
             }
           }
+          if (OB_FAIL(ret) || !agg_row_.need_access_data() || batch_access_data) {
+          } else if (OB_FAIL(fill_rows_by_row(reader, row_count))) {
+            LOG_WARN("Failed to fill rows by row", K(ret), K(row_count), K(begin_index), K(end_index));
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+bool ObAggregatedStore::can_batch_access_data(blocksstable::ObIMicroBlockReader *reader) const
+{
+  bool bret = agg_row_.need_access_data() &&
+              blocksstable::ObIMicroBlockReader::Decoder == reader->get_type();
+  // columns added after the micro block is written are filled with default row by row
+  const int64_t column_count = bret ? reader->get_column_count() : 0;
+  for (int64_t i = 0; bret && i < agg_row_.get_agg_count(); ++i) {
+    const ObAggCell *cell = agg_row_.at(i);
+    bret = !cell->need_access_data() ||
+           (cell->get_col_idx() < column_count && cell->get_stored_col_idx() < column_count);
+  }
+  return bret;
+}
+
+int ObAggregatedStore::fill_rows_by_row(blocksstable::ObIMicroBlockReader *reader, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t idx = 0; OB_SUCC(ret) && idx < row_count; ++idx) {
+    if (OB_FAIL(reader->get_row(row_ids_[idx], row_buf_))) {
+      LOG_WARN("Failed to get row", K(ret), K(idx), K(row_ids_[idx]));
+    } else {
+      for (int64_t i = 0; OB_SUCC(ret) && i < agg_row_.get_agg_count(); ++i) {
+        ObAggCell *cell = agg_row_.at(i);
+        if (!cell->need_access_data()) {
+        } else if (OB_FAIL(cell->process(row_buf_))) {
+          LOG_WARN("Failed to process agg cell", K(ret), K(i), K(*cell), K_(row_buf));
         }
       }
     }
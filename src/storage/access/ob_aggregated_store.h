@@ -18,6 +18,7 @@
 #include "ob_block_batched_row_store.h"
 #include "storage/blocksstable/ob_datum_row.h"
 #include "storage/blocksstable/ob_index_block_row_struct.h"
+#include "storage/blocksstable/ob_index_block_aggregator.h"
 
 namespace oceanbase
 {
@@ -47,15 +48,44 @@ public:
       const int64_t row_count) = 0;
   virtual int process(const blocksstable::ObMicroIndexInfo &index_info) = 0;
   virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding);
-  TO_STRING_KV(K_(col_idx), K_(datum), KPC(col_param_), K_(expr));
+  // Whether this cell can be aggregated by the index info without reading the micro block
+  virtual bool can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+  {
+    UNUSED(index_info);
+    return true;
+  }
+  // Whether cell values must be decoded in batch scan
+  virtual bool need_access_data() const { return false; }
+  // Alloc the datum buffers to decode @batch_size cells of this column at once
+  int init_batch_buf(const int64_t batch_size);
+  OB_INLINE void set_stored_col_idx(const int32_t stored_col_idx) { stored_col_idx_ = stored_col_idx; }
+  OB_INLINE int32_t get_col_idx() const { return col_idx_; }
+  OB_INLINE int32_t get_stored_col_idx() const { return stored_col_idx_; }
+  TO_STRING_KV(K_(col_idx), K_(stored_col_idx), K_(datum), KPC(col_param_), K_(expr), K_(batch_size));
 protected:
   int fill_default_if_need(blocksstable::ObStorageDatum &datum);
   int pad_column_if_need(blocksstable::ObStorageDatum &datum);
+  // Decode this column of @row_ids into col_datums_ by the micro block decoder
+  int decode_batch(
+      blocksstable::ObIMicroBlockReader *reader,
+      const int64_t *row_ids,
+      const int64_t row_count);
+  // Read pre-aggregated data of this column from the index info, @found is false if absent
+  int read_agg_col_info(
+      const blocksstable::ObMicroIndexInfo &index_info,
+      blocksstable::ObAggColumnInfo &col_info,
+      bool &found) const;
   int32_t col_idx_;
+  int32_t stored_col_idx_;
   blocksstable::ObStorageDatum datum_;
   const share::schema::ObColumnParam *col_param_;
   sql::ObExpr *expr_;
   common::ObIAllocator &allocator_;
+  common::ObDatum *col_datums_;
+  const char **cell_datas_;
+  char *datum_buf_;
+  int64_t datum_buf_size_;
+  int64_t batch_size_;
 };
 
 // mysql compatibility, select a,count(a), output first value of a
@@ -99,13 +129,114 @@ public:
       int64_t *row_ids,
       const int64_t row_count) override;
   virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
-   virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
-   TO_STRING_KV(K_(col_idx), K_(datum), K_(col_param), K_(expr), K_(exclude_null), K_(row_count));
+  virtual bool can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const override;
+  virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
+  TO_STRING_KV(K_(col_idx), K_(datum), K_(col_param), K_(expr), K_(exclude_null), K_(row_count));
 private:
   bool exclude_null_;
   int64_t row_count_;
 };
-// TODO sum/min/max
+
+class ObMinMaxAggCell : public ObAggCell
+{
+public:
+  ObMinMaxAggCell(
+      const int32_t col_idx,
+      const share::schema::ObColumnParam *col_param,
+      sql::ObExpr *expr,
+      common::ObIAllocator &allocator,
+      const bool is_min);
+  virtual ~ObMinMaxAggCell() { reset(); };
+  int init();
+  virtual void reset() override;
+  virtual void reuse() override;
+  virtual int process(blocksstable::ObDatumRow &row) override;
+  virtual int process(
+      blocksstable::ObIMicroBlockReader *reader,
+      int64_t *row_ids,
+      const int64_t row_count) override;
+  virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual bool can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const override;
+  virtual bool need_access_data() const override { return true; }
+  TO_STRING_KV(K_(col_idx), K_(datum), K_(col_param), K_(expr), K_(is_min), K_(buf_size));
+private:
+  int process_datum(blocksstable::ObStorageDatum &datum);
+  int update(const blocksstable::ObStorageDatum &datum);
+  common::ObDatumCmpFuncType cmp_func_;
+  char *buf_;
+  int64_t buf_size_;
+  bool is_min_;
+};
+
+class ObSumAggCell : public ObAggCell
+{
+public:
+  ObSumAggCell(
+      const int32_t col_idx,
+      const share::schema::ObColumnParam *col_param,
+      sql::ObExpr *expr,
+      common::ObIAllocator &allocator);
+  virtual ~ObSumAggCell() { reset(); };
+  int init();
+  virtual void reset() override;
+  virtual void reuse() override;
+  virtual int process(blocksstable::ObDatumRow &row) override;
+  virtual int process(
+      blocksstable::ObIMicroBlockReader *reader,
+      int64_t *row_ids,
+      const int64_t row_count) override;
+  virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual bool can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const override;
+  virtual bool need_access_data() const override { return true; }
+  virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
+  TO_STRING_KV(K_(col_idx), K_(col_param), K_(expr), K_(sum_tc), K_(int_sum), K_(uint_sum),
+               K_(double_sum), K_(num_sum), K_(has_value));
+private:
+  int process_datum(blocksstable::ObStorageDatum &datum);
+  int add_int(const int64_t value);
+  int add_uint(const uint64_t value);
+  int add_number(const common::number::ObNumber &value);
+  int get_number_sum(common::number::ObNumber &result, common::ObDataBuffer &allocator) const;
+  common::ObObjTypeClass sum_tc_;
+  // int/uint sums are accumulated locally and folded into num_sum_ when overflow
+  int64_t int_sum_;
+  uint64_t uint_sum_;
+  double double_sum_;
+  common::number::ObNumber num_sum_;
+  uint32_t num_digits_[common::number::ObNumber::MAX_CALC_LEN];
+  bool has_value_;
+};
+
+// APPROX_COUNT_DISTINCT_SYNOPSIS, builds the same HyperLogLog bitmap as ObAggregateProcessor,
+// which is merged by the pulled up APPROX_COUNT_DISTINCT_SYNOPSIS_MERGE
+class ObApproxCountDistinctAggCell : public ObAggCell
+{
+public:
+  ObApproxCountDistinctAggCell(
+      const int32_t col_idx,
+      const share::schema::ObColumnParam *col_param,
+      sql::ObExpr *expr,
+      common::ObIAllocator &allocator);
+  virtual ~ObApproxCountDistinctAggCell() { reset(); };
+  int init();
+  virtual void reset() override;
+  virtual void reuse() override;
+  virtual int process(blocksstable::ObDatumRow &row) override;
+  virtual int process(
+      blocksstable::ObIMicroBlockReader *reader,
+      int64_t *row_ids,
+      const int64_t row_count) override;
+  virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual bool can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const override;
+  virtual bool need_access_data() const override { return true; }
+  virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
+  TO_STRING_KV(K_(col_idx), K_(col_param), K_(expr), KP_(hash_func), KP_(llc_bitmap), K_(llc_size));
+private:
+  int process_datum(blocksstable::ObStorageDatum &datum);
+  sql::ObExprHashFuncType hash_func_;
+  char *llc_bitmap_;
+  int64_t llc_size_;
+};
 
 class ObAggRow
 {
@@ -114,16 +245,24 @@ public:
   ~ObAggRow();
   void reset();
   void reuse();
-  int init(const ObTableAccessParam &param);
+  int init(const ObTableAccessParam &param, const int64_t batch_size);
   int64_t get_agg_count() const { return agg_cells_.count(); }
   bool need_exclude_null() const { return need_exclude_null_; };
+  bool need_access_data() const { return need_access_data_; };
   // void set_firstrow_aggregated(bool aggregated) { is_firstrow_aggregated_ = aggregated; }
   // bool is_firstrow_aggregated() const { return is_firstrow_aggregated_; }
   ObAggCell* at(int64_t idx) { return agg_cells_.at(idx); }
-  TO_STRING_KV(K_(agg_cells));
+  const ObAggCell* at(int64_t idx) const { return agg_cells_.at(idx); }
+  TO_STRING_KV(K_(agg_cells), K_(need_exclude_null), K_(need_access_data));
 private:
+  int init_agg_cell(
+      const ObTableAccessParam &param,
+      const int32_t col_idx,
+      sql::ObExpr *expr,
+      ObAggCell *&cell);
   common::ObFixedArray<ObAggCell *, common::ObIAllocator> agg_cells_;
   bool need_exclude_null_;
+  bool need_access_data_;
   common::ObIAllocator &allocator_;
 };
 
@@ -150,19 +289,16 @@ public:
   int collect_aggregated_row(blocksstable::ObDatumRow *&row);
   OB_INLINE void reuse_aggregated_row() { agg_row_.reuse(); }
   OB_INLINE bool can_batched_aggregate() const { return is_firstrow_aggregated_; }
-  OB_INLINE bool can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
-  { 
-    return filter_is_null() && !agg_row_.need_exclude_null() && can_batched_aggregate() &&
-           index_info.can_blockscan() &&
-           !index_info.is_left_border() &&
-           !index_info.is_right_border();
-  }
+  bool can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const;
   OB_INLINE void set_end() { iter_end_flag_ = IterEndState::ITER_END; }
   TO_STRING_KV(K_(agg_row));
 
 private:
+  bool can_batch_access_data(blocksstable::ObIMicroBlockReader *reader) const;
+  int fill_rows_by_row(blocksstable::ObIMicroBlockReader *reader, const int64_t row_count);
   bool is_firstrow_aggregated_;
   ObAggRow agg_row_;
+  blocksstable::ObDatumRow row_buf_;
 };
 
 } /* namespace storage */
@@ -153,20 +153,9 @@ int ObIndexTreePrefetcher::lookup_in_cache(ObSSTableReadHandle &read_handle)
   if (OB_SUCC(ret) && !found && access_ctx_->enable_get_row_cache()) {
     ObRowCacheKey key(MTL_ID(), iter_param_->tablet_id_, *read_handle.rowkey_,
                       index_read_info_->get_datum_utils(), data_version_, sstable_->get_key().table_type_);
-    if (OB_FAIL(ObStorageCacheSuite::get_instance().get_row_cache().get_row(key, read_handle.row_handle_))) {
-      if (OB_UNLIKELY(OB_ENTRY_NOT_EXIST != ret)) {
-        LOG_WARN("Fail to get row from row cache", K(ret), K(key));
-      } else {
-        ++access_ctx_->table_store_stat_.row_cache_miss_cnt_;
-        ret = OB_SUCCESS;
-      }
-    } else if (OB_UNLIKELY(read_handle.row_handle_.row_value_->get_start_log_ts() != sstable_->get_key().get_start_log_ts())) {
-      ++access_ctx_->table_store_stat_.row_cache_miss_cnt_;
-      ret = OB_SUCCESS;
-    } else {
-      found = true;
-      read_handle.row_state_ = ObSSTableRowState::IN_ROW_CACHE;
-      ++access_ctx_->table_store_stat_.row_cache_hit_cnt_;
+    ret = ObStorageCacheSuite::get_instance().get_row_cache().get_row(key, read_handle.row_handle_);
+    if (OB_FAIL(check_row_cache_result(ret, read_handle, found))) {
+      LOG_WARN("Fail to get row from row cache", K(ret), K(key));
     }
   }
 
@@ -177,6 +166,29 @@ int ObIndexTreePrefetcher::lookup_in_cache(ObSSTableReadHandle &read_handle)
   return ret;
 }
 
+int ObIndexTreePrefetcher::check_row_cache_result(
+    const int get_ret,
+    ObSSTableReadHandle &read_handle,
+    bool &found)
+{
+  int ret = OB_SUCCESS;
+  found = false;
+  if (OB_SUCCESS != get_ret) {
+    if (OB_UNLIKELY(OB_ENTRY_NOT_EXIST != get_ret)) {
+      ret = get_ret;
+    } else {
+      ++access_ctx_->table_store_stat_.row_cache_miss_cnt_;
+    }
+  } else if (OB_UNLIKELY(read_handle.row_handle_.row_value_->get_start_log_ts() != sstable_->get_key().get_start_log_ts())) {
+    ++access_ctx_->table_store_stat_.row_cache_miss_cnt_;
+  } else {
+    found = true;
+    read_handle.row_state_ = ObSSTableRowState::IN_ROW_CACHE;
+    ++access_ctx_->table_store_stat_.row_cache_hit_cnt_;
+  }
+  return ret;
+}
+
 int ObIndexTreePrefetcher::lookup_in_index_tree(ObSSTableReadHandle &read_handle)
 {
   int ret = OB_SUCCESS;
@@ -410,6 +422,7 @@ void ObIndexTreeMultiPassPrefetcher::reset()
   border_rowkey_.reset();
   read_handles_.reset();
   tree_handles_.reset();
+  reset_row_cache_batch();
 }
 
 void ObIndexTreeMultiPassPrefetcher::reuse()
@@ -429,6 +442,16 @@ void ObIndexTreeMultiPassPrefetcher::reuse()
   for (int64_t i = 0; i < tree_handles_.count(); i++) {
     tree_handles_.at(i).reuse();
   }
+  reset_row_cache_batch();
+}
+
+void ObIndexTreeMultiPassPrefetcher::reset_row_cache_batch()
+{
+  for (int64_t i = 0; i < MULTI_GET_ROW_CACHE_BATCH_CNT; ++i) {
+    row_cache_handles_[i].reset();
+  }
+  row_cache_batch_begin_ = 0;
+  row_cache_batch_end_ = 0;
 }
 
 int ObIndexTreeMultiPassPrefetcher::init(
@@ -534,6 +557,7 @@ int ObIndexTreeMultiPassPrefetcher::init_basic_info(
   cur_level_ = 0;
   iter_type_ = iter_type;
   index_tree_height_ = sstable_->get_meta().get_index_tree_height();
+  reset_row_cache_batch();
   switch (iter_type) {
     case ObStoreRowIterator::IteratorMultiGet: {
       rowkeys_ = static_cast<const common::ObIArray<blocksstable::ObDatumRowkey> *> (query_range);
@@ -655,7 +679,7 @@ int ObIndexTreeMultiPassPrefetcher::try_add_query_range(ObIndexTreeLevelHandle &
       LOG_WARN("Fail to prepare read handle", K(ret));
     } else if (read_handle.is_get_) {
       // get
-      if (OB_FAIL(lookup_in_cache(read_handle))) {
+      if (OB_FAIL(lookup_in_cache_batch(read_handle))) {
         LOG_WARN("Failed to lookup_in_cache", K(ret));
       } else if (ObSSTableRowState::IN_BLOCK == read_handle.row_state_) {
         if (OB_FAIL(sstable_->get_index_tree_root(*index_read_info_, index_block_))) {
@@ -871,6 +895,65 @@ int ObIndexTreeMultiPassPrefetcher::prepare_read_handle(
   return ret;
 }
 
+int ObIndexTreeMultiPassPrefetcher::lookup_in_cache_batch(ObSSTableReadHandle &read_handle)
+{
+  int ret = OB_SUCCESS;
+  const int64_t range_idx = read_handle.range_idx_;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(!read_handle.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(read_handle));
+  } else if (ObStoreRowIterator::IteratorMultiGet != iter_type_ ||
+             !access_ctx_->enable_get_row_cache() ||
+             rowkeys_->count() <= 1 ||
+             sstable_->get_meta().is_empty()) {
+    // empty sstable is answered as NOT_EXIST there, without any cache or index tree access
+    ret = lookup_in_cache(read_handle);
+  } else {
+    if (range_idx < row_cache_batch_begin_ || range_idx >= row_cache_batch_end_) {
+      // hash and probe the following rowkeys together, the handles are kept until fetched
+      const int64_t batch_cnt = MIN(static_cast<int64_t>(MULTI_GET_ROW_CACHE_BATCH_CNT),
+                                    rowkeys_->count() - range_idx);
+      char key_buf[MULTI_GET_ROW_CACHE_BATCH_CNT * sizeof(ObRowCacheKey)] __attribute__((aligned(8)));
+      const ObRowCacheKey *keys[MULTI_GET_ROW_CACHE_BATCH_CNT];
+      reset_row_cache_batch();
+      for (int64_t i = 0; i < batch_cnt; ++i) {
+        keys[i] = new (key_buf + i * sizeof(ObRowCacheKey)) ObRowCacheKey(
+            MTL_ID(), iter_param_->tablet_id_, rowkeys_->at(range_idx + i),
+            index_read_info_->get_datum_utils(), data_version_, sstable_->get_key().table_type_);
+      }
+      if (OB_FAIL(ObStorageCacheSuite::get_instance().get_row_cache().get_rows(
+                  batch_cnt, keys, row_cache_handles_, row_cache_rets_))) {
+        LOG_WARN("Fail to get rows from row cache", K(ret), K(range_idx), K(batch_cnt));
+      } else {
+        row_cache_batch_begin_ = range_idx;
+        row_cache_batch_end_ = range_idx + batch_cnt;
+      }
+      for (int64_t i = 0; i < batch_cnt; ++i) {
+        keys[i]->~ObRowCacheKey();
+      }
+    }
+    if (OB_SUCC(ret)) {
+      bool found = false;
+      const int64_t idx = range_idx - row_cache_batch_begin_;
+      if (OB_SUCCESS == row_cache_rets_[idx]) {
+        read_handle.row_handle_.row_value_ = row_cache_handles_[idx].row_value_;
+        read_handle.row_handle_.handle_.move_from(row_cache_handles_[idx].handle_);
+        row_cache_handles_[idx].row_value_ = nullptr;
+      }
+      if (OB_FAIL(check_row_cache_result(row_cache_rets_[idx], read_handle, found))) {
+        LOG_WARN("Fail to get row from row cache", K(ret), K(read_handle));
+      }
+      if (OB_SUCC(ret) && !found) {
+        read_handle.row_state_ = ObSSTableRowState::IN_BLOCK;
+      }
+    }
+  }
+  return ret;
+}
+
 class ObMicroInfoComparator
 {
 public:
@@ -163,6 +163,7 @@ protected:
       ObMicroBlockDataHandle &micro_handle,
       const bool is_data = true);
   int lookup_in_cache(ObSSTableReadHandle &read_handle);
+  int check_row_cache_result(const int get_ret, ObSSTableReadHandle &read_handle, bool &found);
 private:
   int lookup_in_index_tree(ObSSTableReadHandle &read_handle);
   ObMicroBlockDataHandle &get_read_handle(const int64_t level)
@@ -214,7 +215,9 @@ public:
       query_range_(nullptr),
       border_rowkey_(),
       read_handles_(),
-      tree_handles_()
+      tree_handles_(),
+      row_cache_batch_begin_(0),
+      row_cache_batch_end_(0)
   {}
   virtual ~ObIndexTreeMultiPassPrefetcher()
   {}
@@ -279,6 +282,9 @@ private:
   int prepare_read_handle(
       ObIndexTreeLevelHandle &tree_handle,
       ObSSTableReadHandle &read_handle);
+  // multi get looks up the row cache for a batch of the following rowkeys at once
+  int lookup_in_cache_batch(ObSSTableReadHandle &read_handle);
+  void reset_row_cache_batch();
   int check_data_infos_border(
       const int64_t start_pos,
       const int64_t end_pos,
@@ -296,6 +302,7 @@ private:
   static const int32_t DEFAULT_SCAN_RANGE_PREFETCH_CNT = 4;
   static const int32_t DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT = 32;
   static const int32_t INDEX_TREE_PREFETCH_DEPTH = 3;
+  static const int32_t MULTI_GET_ROW_CACHE_BATCH_CNT = 32;
   struct ObIndexBlockReadHandle {
     ObIndexBlockReadHandle() :
         end_prefetched_row_idx_(-1),
@@ -467,6 +474,11 @@ private:
   IndexTreeLevelHandleArray tree_handles_;
   ObMicroIndexInfo micro_data_infos_[DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT];
   ObMicroBlockDataHandle micro_data_handles_[DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT];
+  // row cache lookup results of rowkeys in [row_cache_batch_begin_, row_cache_batch_end_)
+  int64_t row_cache_batch_begin_;
+  int64_t row_cache_batch_end_;
+  int row_cache_rets_[MULTI_GET_ROW_CACHE_BATCH_CNT];
+  ObRowValueHandle row_cache_handles_[MULTI_GET_ROW_CACHE_BATCH_CNT];
 };
 
 }
@@ -179,7 +179,8 @@ int ObSSTableRowScanner::open_cur_data_block(ObSSTableReadHandle &read_handle)
         LOG_WARN("Fail to check_blockscan", K(ret));
       } else if (can_blockscan && nullptr != block_row_store_ && !block_row_store_->is_disabled()) {
         // Apply pushdown filter and block scan
-        if (OB_FAIL(micro_scanner_->apply_blockscan(block_row_store_, access_ctx_->table_store_stat_))) {
+        if (OB_FAIL(micro_scanner_->apply_blockscan(
+                    block_row_store_, access_ctx_->table_store_stat_, &micro_info))) {
           if (OB_UNLIKELY(OB_ITER_END != ret)) {
             LOG_WARN("Fail to apply_block_scan", K(ret), KPC(block_row_store_));
           }
@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX STORAGE
 #include "ob_table_access_context.h"
 #include "ob_dml_param.h"
+#include "share/rc/ob_tenant_base.h"
 
 namespace oceanbase
 {
@@ -152,6 +153,7 @@ int ObTableAccessContext::init(ObTableScanParam &scan_param,
     table_scan_stat_ = &scan_param.main_table_scan_stat_;
     limit_param_ = scan_param.limit_param_.is_valid() ? &scan_param.limit_param_ : NULL;
     table_scan_stat_->reset();
+    table_store_stat_.tenant_id_ = MTL_ID();
     table_store_stat_.ls_id_ = scan_param.ls_id_;
     table_store_stat_.tablet_id_ = scan_param.tablet_id_;
     table_store_stat_.table_id_ = scan_param.index_id_;
@@ -192,6 +194,7 @@ int ObTableAccessContext::init(const common::ObQueryFlag &query_flag,
     trans_version_range_ = trans_version_range;
     ls_id_ = ctx.ls_id_;
     tablet_id_ = ctx.tablet_id_;
+    table_store_stat_.tenant_id_ = MTL_ID();
     table_store_stat_.ls_id_ = ctx.ls_id_;
     table_store_stat_.tablet_id_ = ctx.tablet_id_;
     table_store_stat_.table_id_ = ctx.tablet_id_.id(); // TODO  (yuanzhe) remove table_id in virtual table
@@ -219,6 +222,7 @@ int ObTableAccessContext::init(const common::ObQueryFlag &query_flag,
     trans_version_range_ = trans_version_range;
     ls_id_ = ctx.ls_id_;
     tablet_id_ = ctx.tablet_id_;
+    table_store_stat_.tenant_id_ = MTL_ID();
     table_store_stat_.ls_id_ = ctx.ls_id_;
     table_store_stat_.tablet_id_ = ctx.tablet_id_;
     table_store_stat_.table_id_ = ctx.tablet_id_.id(); // TODO  (yuanzhe) remove table_id in virtual table
@@ -326,6 +326,12 @@ int ObConstDecoder::pushdown_operator(
         }
         break;
       }
+      case sql::WHITE_OP_LI: {
+        if (OB_FAIL(like_operator(col_ctx, filter, result_bitmap))) {
+          LOG_WARN("Failed on running LIKE pushed down operator", K(ret), K(col_ctx), K(filter));
+        }
+        break;
+      }
       default: {
         ret = OB_NOT_SUPPORTED;
         LOG_WARN("Pushed down filter operator type not supported", K(ret), K(filter));
@@ -431,6 +437,21 @@ int ObConstDecoder::const_only_operator(
             }
             break;
           }
+          case sql::WHITE_OP_LI: {
+            if (OB_UNLIKELY(objs.count() != 2 || filter.null_param_contained())) {
+              ret = OB_INVALID_ARGUMENT;
+              LOG_WARN("Invalid argument", K(ret), K(filter));
+            } else if (ref == 1) {
+            } else if (OB_UNLIKELY(!const_obj.is_string_type())) {
+              ret = OB_NOT_SUPPORTED;
+              LOG_DEBUG("Like operator on non-string column not supported", K(ret), K(const_obj));
+            } else if (filter.like_match(const_obj.get_string())) {
+              if (OB_FAIL(result_bitmap.bit_not())) {
+                LOG_WARN("Failed to do bitwise not on result bitmap", K(ret));
+              }
+            }
+            break;
+          }
           default: {
             ret = OB_NOT_SUPPORTED;
             LOG_WARN("Pushed down filter operator type not supported", K(ret));
@@ -734,6 +755,91 @@ int ObConstDecoder::in_operator(
   return ret;
 }
 
+int ObConstDecoder::like_operator(
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(result_bitmap.size() != col_ctx.micro_block_header_->row_count_
+                  || filter.get_objs().count() != 2
+                  || filter.get_op_type() != sql::WHITE_OP_LI
+                  || filter.null_param_contained())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for LIKE operator",
+             K(ret), K(result_bitmap.size()), K(filter));
+  } else if (OB_UNLIKELY(!ob_is_string_tc(col_ctx.obj_meta_.get_type()))) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_DEBUG("Like operator on non-string column not supported", K(ret), K(col_ctx.obj_meta_));
+  } else {
+    int64_t dict_count = dict_decoder_.get_dict_header()->count_;
+    const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
+    const int64_t dict_meta_length = col_ctx.col_header_->length_ - meta_header_->offset_;
+    bool const_matched = false;
+
+    if (meta_header_->const_ref_ == dict_count) {
+    } else {
+      ObDictDecoderIterator dict_iter = dict_decoder_.begin(&col_ctx, dict_meta_length);
+      ObObj& const_obj = *(dict_iter + meta_header_->const_ref_);
+      if (const_obj.is_fixed_len_char_type() && nullptr != col_ctx.col_param_) {
+        if (OB_FAIL(storage::pad_column(col_ctx.col_param_->get_accuracy(),
+                                        *col_ctx.allocator_, const_obj))) {
+          LOG_WARN("Failed to pad column", K(ret));
+        }
+      }
+      if (OB_FAIL(ret)) {
+      } else if (FALSE_IT(const_matched = filter.like_match(const_obj.get_string()))) {
+      } else if (const_matched) {
+        if (OB_FAIL(result_bitmap.bit_not())) {
+          LOG_WARN("Failed to flip all bits for result bitmap", K(ret));
+        }
+      }
+    }
+
+    if (OB_SUCC(ret)) {
+      bool found = false;
+      ObDictDecoderIterator trav_it = dict_decoder_.begin(&col_ctx, dict_meta_length);
+      ObDictDecoderIterator end_it = dict_decoder_.end(&col_ctx, dict_meta_length);
+      const int64_t ref_bitset_size = dict_count + 1;
+      char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+      sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+      ref_bitset->init(ref_bitset_size);
+      int64_t dict_ref = 0;
+      ObObj cur_obj;
+      while (OB_SUCC(ret) && trav_it != end_it) {
+        cur_obj = *trav_it;
+        if (OB_UNLIKELY(cur_obj.is_null())) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("There should not be null object in dictionary", K(ret));
+        } else if (cur_obj.is_fixed_len_char_type() && nullptr != col_ctx.col_param_ &&
+                   OB_FAIL(storage::pad_column(col_ctx.col_param_->get_accuracy(),
+                                               *col_ctx.allocator_, cur_obj))) {
+          LOG_WARN("Failed to pad column", K(ret), K(cur_obj));
+        } else if (!const_matched == filter.like_match(cur_obj.get_string())) {
+          found = true;
+          ref_bitset->set(dict_ref);
+        }
+        ++dict_ref;
+        ++trav_it;
+      }
+
+      if (OB_FAIL(ret)) {
+      } else if (found && OB_FAIL(set_res_with_bitset(
+                  row_ids,
+                  ref_bitset,
+                  !const_matched,
+                  result_bitmap))) {
+        LOG_WARN("Failed to set result bitmap", K(ret));
+      } else if (const_matched) {
+        if (OB_FAIL(traverse_refs_and_set_res(row_ids, dict_count, false, result_bitmap))) {
+          LOG_WARN("Failed to clean bitmap for null rows", K(ret));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 int ObConstDecoder::traverse_refs_and_set_res(
     const ObIntArrayFuncTable &row_ids,
     const int64_t dict_ref,
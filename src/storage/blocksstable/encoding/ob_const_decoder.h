@@ -104,6 +104,11 @@ private:
       const sql::ObWhiteFilterExecutor &filter,
       ObBitmap &result_bitmap) const;
 
+  int like_operator(
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
   int traverse_refs_and_set_res(
       const ObIntArrayFuncTable &row_ids,
       const int64_t dict_ref,
@@ -680,6 +680,12 @@ int ObDictDecoder::pushdown_operator(
       }
       break;
     }
+    case sql::WHITE_OP_LI: {
+      if (OB_FAIL(like_operator(parent, col_ctx, col_data, filter, result_bitmap))) {
+        LOG_WARN("Failed to run LIKE operator", K(ret), K(col_ctx));
+      }
+      break;
+    }
     default: {
       ret = OB_NOT_SUPPORTED;
       LOG_WARN("Unexpected filter pushdown operation type", K(ret), K(op_type));
@@ -1025,6 +1031,59 @@ int ObDictDecoder::in_operator(
   return ret;
 }
 
+// Match pattern once for each dictionary entry, then set result by refs
+int ObDictDecoder::like_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char* col_data,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(result_bitmap.size() != col_ctx.micro_block_header_->row_count_
+                  || filter.get_objs().count() != 2
+                  || filter.get_op_type() != sql::WHITE_OP_LI
+                  || filter.null_param_contained())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for LIKE operator", K(ret),
+             K(col_data), K(result_bitmap.size()), K(filter));
+  } else if (OB_UNLIKELY(!ob_is_string_tc(col_ctx.obj_meta_.get_type()))) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_DEBUG("Like operator on non-string column not supported", K(ret), K(col_ctx.obj_meta_));
+  } else {
+    const int64_t count = meta_header_->count_;
+    if (count > 0) {
+      bool found = false;
+      ObDictDecoderIterator traverse_it = begin(&col_ctx, col_ctx.col_header_->length_);
+      ObDictDecoderIterator end_it = end(&col_ctx, col_ctx.col_header_->length_);
+      const int64_t ref_bitset_size = meta_header_->count_ + 1;
+      char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+      sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+      ref_bitset->init(ref_bitset_size);
+      int64_t dict_ref = 0;
+      ObObj cur_obj;
+      while (OB_SUCC(ret) && traverse_it != end_it) {
+        cur_obj = *traverse_it;
+        if (cur_obj.is_fixed_len_char_type() && nullptr != col_ctx.col_param_ &&
+            OB_FAIL(storage::pad_column(col_ctx.col_param_->get_accuracy(),
+                                        *col_ctx.allocator_, cur_obj))) {
+          LOG_WARN("Failed to pad column", K(ret), K(cur_obj));
+        } else if (filter.like_match(cur_obj.get_string())) {
+          found = true;
+          ref_bitset->set(dict_ref);
+        }
+        ++traverse_it;
+        ++dict_ref;
+      }
+      if (OB_FAIL(ret)) {
+      } else if (found && OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, result_bitmap))) {
+        LOG_WARN("Failed to set result bitmap", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObDictDecoder::load_data_to_obj_cell(
     const ObObjMeta cell_meta,
     const char *cell_data,
@@ -585,6 +585,13 @@ int ObRawDecoder::pushdown_operator(
       }
       break;
     }
+    case sql::WHITE_OP_LI: {
+      if (OB_FAIL(like_operator(parent, col_ctx, col_data, row_index,
+                  filter, result_bitmap))) {
+        LOG_WARN("Failed on Like Operator", K(ret), K(col_ctx));
+      }
+      break;
+    }
     default: {
       ret = OB_NOT_SUPPORTED;
       LOG_WARN("Not supported operation type", K(ret), K(op_type));
@@ -854,6 +861,38 @@ int ObRawDecoder::in_operator(
   return ret;
 }
 
+int ObRawDecoder::like_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char* col_data,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(filter.get_objs().count() != 2
+             || filter.null_param_contained()
+             || result_bitmap.size() != col_ctx.micro_block_header_->row_count_
+             || NULL == row_index)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Pushdown like operator: Invalid arguments", K(ret), K(filter.get_objs()));
+  } else if (OB_UNLIKELY(!ob_is_string_tc(col_ctx.obj_meta_.get_type()))) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_DEBUG("Like operator on non-string column not supported", K(ret), K(col_ctx.obj_meta_));
+  } else if (OB_FAIL(traverse_all_data(parent, col_ctx, row_index, col_data,
+                    filter, result_bitmap,
+                    [](const ObObj &cur_obj,
+                      const sql::ObWhiteFilterExecutor &filter,
+                      bool &result) -> int {
+                      // memcmp / memmem for literal patterns under binary collation
+                      result = filter.like_match(cur_obj.get_string());
+                      return OB_SUCCESS;
+                    }))) {
+    LOG_WARN("Failed to traverse all data in micro block", K(ret));
+  }
+  return ret;
+}
+
 /**
  *  Function to traverse all row data with raw encoding, regardless of column is fixed length
  *  or var lengthand run lambda function for every row element.
@@ -191,6 +191,17 @@ int ObIMicroBlockReader::filter_white_filter(
         }
         break;
       }
+      case sql::WHITE_OP_LI: {
+        if (OB_UNLIKELY(ref_objs.count() != 2)) {
+          ret = OB_INVALID_ARGUMENT;
+          LOG_WARN("Invalid argument for like operator", K(ret), K(ref_objs));
+        } else if (obj.is_null() || filter.null_param_contained()) {
+          // Result of like with null is null
+        } else if (filter.like_match(obj.get_string())) {
+          filtered = false;
+        }
+        break;
+      }
       default: {
         ret = OB_NOT_SUPPORTED;
         LOG_WARN("Unexpected filter pushdown operation type", K(ret), K(op_type));
@@ -46,6 +46,7 @@ void ObMicroBlockDesc::reset()
   contain_uncommitted_row_ = false;
   can_mark_deletion_ = false;
   has_out_row_column_ = false;
+  aggregator_ = NULL;
   original_size_ = 0;
 }
 
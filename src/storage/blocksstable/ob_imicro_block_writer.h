@@ -26,6 +26,7 @@ namespace oceanbase
 {
 namespace blocksstable
 {
+class ObIndexBlockAggregator;
 struct ObMicroBlockDesc
 {
   ObDatumRowkey last_rowkey_;
@@ -45,6 +46,7 @@ struct ObMicroBlockDesc
   bool contain_uncommitted_row_;
   bool can_mark_deletion_;
   bool has_out_row_column_;
+  const ObIndexBlockAggregator *aggregator_; // pre-aggregated data of rows in this micro block
 
   ObMicroBlockDesc() { reset(); }
   bool is_valid() const;
@@ -66,6 +68,7 @@ struct ObMicroBlockDesc
       K_(contain_uncommitted_row),
       K_(can_mark_deletion),
       K_(has_out_row_column),
+      KP_(aggregator),
       K_(original_size));
 };
 enum MICRO_BLOCK_MERGE_VERIFY_LEVEL
@@ -0,0 +1,504 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_index_block_aggregator.h"
+#include "ob_macro_block.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace blocksstable
+{
+
+void ObAggColumnInfo::reset()
+{
+  has_min_max_ = false;
+  min_.set_nop();
+  max_.set_nop();
+  null_count_ = 0;
+  sum_type_ = AGG_SUM_NONE;
+  int_sum_ = 0;
+}
+
+ObAggRowReader::ObAggRowReader()
+  : header_(nullptr), buf_(nullptr), buf_size_(0)
+{
+}
+
+void ObAggRowReader::reset()
+{
+  header_ = nullptr;
+  buf_ = nullptr;
+  buf_size_ = 0;
+}
+
+int ObAggRowReader::init(const char *buf, const int64_t buf_size)
+{
+  int ret = OB_SUCCESS;
+  const ObAggRowHeader *header = reinterpret_cast<const ObAggRowHeader *>(buf);
+  reset();
+  if (OB_UNLIKELY(nullptr == buf || buf_size < static_cast<int64_t>(sizeof(ObAggRowHeader)))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument to init agg row reader", K(ret), KP(buf), K(buf_size));
+  } else if (OB_UNLIKELY(!header->is_valid() || header->length_ > buf_size)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Invalid agg row header", K(ret), KPC(header), K(buf_size));
+  } else {
+    header_ = header;
+    buf_ = buf;
+    buf_size_ = header->length_;
+  }
+  return ret;
+}
+
+int ObAggRowReader::read(const int64_t col_idx, ObAggColumnInfo &col_info) const
+{
+  int ret = OB_SUCCESS;
+  col_info.reset();
+  if (OB_ISNULL(header_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Agg row reader not inited", K(ret));
+  } else if (OB_UNLIKELY(col_idx < 0 || col_idx >= header_->col_cnt_)) {
+    ret = OB_INDEX_OUT_OF_RANGE;
+    LOG_WARN("Column not aggregated", K(ret), K(col_idx), KPC_(header));
+  } else {
+    const ObAggColumnMeta *col_meta = reinterpret_cast<const ObAggColumnMeta *>(
+        buf_ + sizeof(ObAggRowHeader)) + col_idx;
+    col_info.null_count_ = col_meta->null_count_;
+    col_info.sum_type_ = static_cast<ObAggSumType>(col_meta->sum_type_);
+    col_info.int_sum_ = col_meta->int_sum_;
+    if (col_meta->has_min_max_) {
+      if (OB_UNLIKELY(col_meta->min_offset_ + col_meta->min_len_ > buf_size_
+          || col_meta->max_offset_ + col_meta->max_len_ > buf_size_)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Agg value out of agg row", K(ret), K(col_idx), KPC_(header), K_(buf_size));
+      } else {
+        col_info.has_min_max_ = true;
+        col_info.min_.reuse();
+        col_info.min_.set_string(buf_ + col_meta->min_offset_, col_meta->min_len_);
+        col_info.max_.reuse();
+        col_info.max_.set_string(buf_ + col_meta->max_offset_, col_meta->max_len_);
+      }
+    }
+  }
+  return ret;
+}
+
+int ObAggRowReader::get_agg_row_length(const char *buf, int64_t &length)
+{
+  int ret = OB_SUCCESS;
+  const ObAggRowHeader *header = reinterpret_cast<const ObAggRowHeader *>(buf);
+  length = 0;
+  if (OB_ISNULL(buf)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid null agg row buffer", K(ret));
+  } else if (OB_UNLIKELY(!header->is_valid())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Invalid agg row header", K(ret), KPC(header));
+  } else {
+    length = header->length_;
+  }
+  return ret;
+}
+
+ObIndexBlockAggregator::ObColumnAggregator::ObColumnAggregator()
+  : cmp_func_(nullptr), min_(), max_(), null_count_(0),
+    sum_type_(AGG_SUM_NONE), cur_sum_type_(AGG_SUM_NONE), int_sum_(0),
+    min_max_enabled_(false), min_max_abandoned_(false), has_value_(false)
+{
+}
+
+void ObIndexBlockAggregator::ObColumnAggregator::reuse()
+{
+  min_.set_nop();
+  max_.set_nop();
+  null_count_ = 0;
+  cur_sum_type_ = sum_type_;
+  int_sum_ = 0;
+  min_max_abandoned_ = false;
+  has_value_ = false;
+}
+
+int ObIndexBlockAggregator::ObColumnAggregator::update_min(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (!has_value_ || cmp_func_(datum, min_) < 0) {
+    MEMCPY(min_buf_, datum.ptr_, datum.len_);
+    min_.reuse();
+    min_.set_string(min_buf_, datum.len_);
+  }
+  return ret;
+}
+
+int ObIndexBlockAggregator::ObColumnAggregator::update_max(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (!has_value_ || cmp_func_(datum, max_) > 0) {
+    MEMCPY(max_buf_, datum.ptr_, datum.len_);
+    max_.reuse();
+    max_.set_string(max_buf_, datum.len_);
+  }
+  return ret;
+}
+
+int ObIndexBlockAggregator::ObColumnAggregator::eval(const ObStorageDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (datum.is_null()) {
+    ++null_count_;
+  } else if (OB_UNLIKELY(datum.is_ext())) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_DEBUG("Extend datum can not be aggregated", K(ret), K(datum));
+  } else {
+    if (!min_max_enabled_ || min_max_abandoned_) {
+    } else if (ObDatumDesc::FlagType::NONE != datum.flag_ || datum.len_ > MAX_AGG_DATUM_LENGTH) {
+      min_max_abandoned_ = true;
+    } else if (OB_FAIL(update_min(datum))) {
+      LOG_WARN("Fail to update min value", K(ret), K(datum));
+    } else if (OB_FAIL(update_max(datum))) {
+      LOG_WARN("Fail to update max value", K(ret), K(datum));
+    }
+    if (OB_SUCC(ret)) {
+      has_value_ = true;
+      switch (cur_sum_type_) {
+        case AGG_SUM_INT: {
+          int64_t res = 0;
+          if (__builtin_add_overflow(int_sum_, datum.get_int(), &res)) {
+            cur_sum_type_ = AGG_SUM_NONE;
+          } else {
+            int_sum_ = res;
+          }
+          break;
+        }
+        case AGG_SUM_UINT: {
+          uint64_t res = 0;
+          if (__builtin_add_overflow(uint_sum_, datum.get_uint(), &res)) {
+            cur_sum_type_ = AGG_SUM_NONE;
+          } else {
+            uint_sum_ = res;
+          }
+          break;
+        }
+        case AGG_SUM_DOUBLE: {
+          double_sum_ += sizeof(float) == datum.len_ ? datum.get_float() : datum.get_double();
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+  return ret;
+}
+
+void ObIndexBlockAggregator::ObColumnAggregator::add_sum(const ObAggColumnInfo &col_info)
+{
+  if (AGG_SUM_NONE == cur_sum_type_) {
+  } else if (col_info.sum_type_ != cur_sum_type_) {
+    // child sum overflowed
+    cur_sum_type_ = AGG_SUM_NONE;
+  } else if (AGG_SUM_INT == cur_sum_type_) {
+    int64_t res = 0;
+    if (__builtin_add_overflow(int_sum_, col_info.int_sum_, &res)) {
+      cur_sum_type_ = AGG_SUM_NONE;
+    } else {
+      int_sum_ = res;
+    }
+  } else if (AGG_SUM_UINT == cur_sum_type_) {
+    uint64_t res = 0;
+    if (__builtin_add_overflow(uint_sum_, col_info.uint_sum_, &res)) {
+      cur_sum_type_ = AGG_SUM_NONE;
+    } else {
+      uint_sum_ = res;
+    }
+  } else {
+    double_sum_ += col_info.double_sum_;
+  }
+}
+
+int ObIndexBlockAggregator::ObColumnAggregator::eval(
+    const ObAggColumnInfo &col_info,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  const bool child_has_value = col_info.null_count_ < row_count;
+  null_count_ += col_info.null_count_;
+  if (child_has_value) {
+    if (!min_max_enabled_ || min_max_abandoned_) {
+    } else if (!col_info.has_min_max()) {
+      min_max_abandoned_ = true;
+    } else if (OB_FAIL(update_min(col_info.min_))) {
+      LOG_WARN("Fail to update min value", K(ret), K(col_info));
+    } else if (OB_FAIL(update_max(col_info.max_))) {
+      LOG_WARN("Fail to update max value", K(ret), K(col_info));
+    }
+    if (OB_SUCC(ret)) {
+      has_value_ = true;
+      add_sum(col_info);
+    }
+  }
+  return ret;
+}
+
+ObIndexBlockAggregator::ObIndexBlockAggregator()
+  : allocator_(nullptr), col_aggs_(nullptr), col_cnt_(0), row_count_(0),
+    is_abandoned_(false), is_inited_(false)
+{
+}
+
+ObIndexBlockAggregator::~ObIndexBlockAggregator()
+{
+  reset();
+}
+
+void ObIndexBlockAggregator::reset()
+{
+  if (OB_NOT_NULL(col_aggs_)) {
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      col_aggs_[i].~ObColumnAggregator();
+    }
+    if (OB_NOT_NULL(allocator_)) {
+      allocator_->free(col_aggs_);
+    }
+    col_aggs_ = nullptr;
+  }
+  allocator_ = nullptr;
+  col_cnt_ = 0;
+  row_count_ = 0;
+  is_abandoned_ = false;
+  is_inited_ = false;
+}
+
+void ObIndexBlockAggregator::reuse()
+{
+  for (int64_t i = 0; i < col_cnt_; ++i) {
+    col_aggs_[i].reuse();
+  }
+  row_count_ = 0;
+  is_abandoned_ = false;
+}
+
+bool ObIndexBlockAggregator::can_agg_min_max(const ObObjMeta &col_type)
+{
+  bool bret = false;
+  switch (col_type.get_type_class()) {
+    case ObIntTC:
+    case ObUIntTC:
+    case ObFloatTC:
+    case ObDoubleTC:
+    case ObNumberTC:
+    case ObDateTimeTC:
+    case ObDateTC:
+    case ObTimeTC:
+    case ObYearTC:
+    case ObBitTC:
+    case ObOTimestampTC:
+    case ObStringTC: {
+      bret = true;
+      break;
+    }
+    default:
+      break;
+  }
+  return bret;
+}
+
+ObAggSumType ObIndexBlockAggregator::get_sum_type(const ObObjMeta &col_type)
+{
+  ObAggSumType sum_type = AGG_SUM_NONE;
+  switch (col_type.get_type_class()) {
+    case ObIntTC: {
+      sum_type = AGG_SUM_INT;
+      break;
+    }
+    case ObUIntTC: {
+      sum_type = AGG_SUM_UINT;
+      break;
+    }
+    case ObFloatTC:
+    case ObDoubleTC: {
+      sum_type = AGG_SUM_DOUBLE;
+      break;
+    }
+    default:
+      break;
+  }
+  return sum_type;
+}
+
+int ObIndexBlockAggregator::init(const ObDataStoreDesc &store_desc, ObIAllocator &allocator)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  const int64_t col_cnt = MIN(store_desc.col_desc_array_.count(), MAX_AGG_COLUMN_COUNT);
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("Init twice", K(ret));
+  } else if (OB_UNLIKELY(!store_desc.is_valid() || !store_desc.need_pre_aggregation() || col_cnt <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid data store desc to pre-aggregate", K(ret), K(store_desc));
+  } else if (OB_ISNULL(buf = allocator.alloc(sizeof(ObColumnAggregator) * col_cnt))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Fail to alloc column aggregators", K(ret), K(col_cnt));
+  } else {
+    allocator_ = &allocator;
+    col_aggs_ = new (buf) ObColumnAggregator[col_cnt];
+    col_cnt_ = col_cnt;
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt_; ++i) {
+      const ObObjMeta &col_type = store_desc.col_desc_array_.at(i).col_type_;
+      ObColumnAggregator &col_agg = col_aggs_[i];
+      col_agg.sum_type_ = get_sum_type(col_type);
+      col_agg.cur_sum_type_ = col_agg.sum_type_;
+      if (can_agg_min_max(col_type)) {
+        col_agg.cmp_func_ = ObDatumFuncs::get_nullsafe_cmp_func(col_type.get_type(),
+                                                                col_type.get_type(),
+                                                                NULL_FIRST,
+                                                                col_type.get_collation_type(),
+                                                                lib::Worker::CompatMode::ORACLE == store_desc.compat_mode_);
+        col_agg.min_max_enabled_ = nullptr != col_agg.cmp_func_;
+      }
+    }
+    is_inited_ = true;
+  }
+  if (OB_FAIL(ret)) {
+    reset();
+  }
+  return ret;
+}
+
+int ObIndexBlockAggregator::eval(const ObDatumRow &row)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else if (is_abandoned_) {
+  } else if (OB_UNLIKELY(row.get_column_count() < col_cnt_)) {
+    // rows of previous schema may be narrower, give up pre-aggregation of this index row
+    abandon();
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt_; ++i) {
+      if (OB_FAIL(col_aggs_[i].eval(row.storage_datums_[i]))) {
+        if (OB_LIKELY(OB_NOT_SUPPORTED == ret)) {
+          abandon();
+          ret = OB_SUCCESS;
+          break;
+        } else {
+          LOG_WARN("Fail to aggregate column", K(ret), K(i), K(row));
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ++row_count_;
+    }
+  }
+  return ret;
+}
+
+int ObIndexBlockAggregator::eval(
+    const char *agg_buf,
+    const int64_t agg_buf_size,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  ObAggRowReader agg_reader;
+  ObAggColumnInfo col_info;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else if (is_abandoned_) {
+  } else if (OB_UNLIKELY(row_count <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid row count of pre-aggregated data", K(ret), K(row_count));
+  } else if (OB_FAIL(agg_reader.init(agg_buf, agg_buf_size))) {
+    LOG_WARN("Fail to init agg row reader", K(ret), KP(agg_buf), K(agg_buf_size));
+  } else if (agg_reader.get_column_count() < col_cnt_) {
+    abandon();
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt_; ++i) {
+      if (OB_FAIL(agg_reader.read(i, col_info))) {
+        LOG_WARN("Fail to read pre-aggregated column", K(ret), K(i));
+      } else if (OB_FAIL(col_aggs_[i].eval(col_info, row_count))) {
+        LOG_WARN("Fail to aggregate column", K(ret), K(i), K(col_info));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      row_count_ += row_count;
+    }
+  }
+  return ret;
+}
+
+int64_t ObIndexBlockAggregator::get_agg_row_size() const
+{
+  int64_t size = 0;
+  if (is_aggregated()) {
+    size = sizeof(ObAggRowHeader) + col_cnt_ * sizeof(ObAggColumnMeta);
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      const ObColumnAggregator &col_agg = col_aggs_[i];
+      if (col_agg.record_min_max()) {
+        size += col_agg.min_.len_ + col_agg.max_.len_;
+      }
+    }
+  }
+  return size;
+}
+
+int ObIndexBlockAggregator::write_agg_row(char *buf, const int64_t buf_len, int64_t &pos) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t agg_row_size = get_agg_row_size();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else if (OB_UNLIKELY(!is_aggregated())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Nothing aggregated", K(ret), KPC(this));
+  } else if (OB_UNLIKELY(nullptr == buf || pos < 0 || pos + agg_row_size > buf_len)) {
+    ret = OB_BUF_NOT_ENOUGH;
+    LOG_WARN("Buffer not enough for agg row", K(ret), KP(buf), K(buf_len), K(pos), K(agg_row_size));
+  } else {
+    char *agg_row = buf + pos;
+    ObAggRowHeader *header = reinterpret_cast<ObAggRowHeader *>(agg_row);
+    ObAggColumnMeta *col_metas = reinterpret_cast<ObAggColumnMeta *>(agg_row + sizeof(ObAggRowHeader));
+    int64_t value_pos = sizeof(ObAggRowHeader) + col_cnt_ * sizeof(ObAggColumnMeta);
+    header->version_ = ObAggRowHeader::AGG_ROW_HEADER_V1;
+    header->col_cnt_ = static_cast<uint16_t>(col_cnt_);
+    header->length_ = static_cast<uint32_t>(agg_row_size);
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      const ObColumnAggregator &col_agg = col_aggs_[i];
+      ObAggColumnMeta &col_meta = col_metas[i];
+      MEMSET(&col_meta, 0, sizeof(ObAggColumnMeta));
+      col_meta.null_count_ = col_agg.null_count_;
+      col_meta.sum_type_ = col_agg.has_value_ ? col_agg.cur_sum_type_ : AGG_SUM_NONE;
+      col_meta.int_sum_ = col_agg.int_sum_;
+      if (col_agg.record_min_max()) {
+        col_meta.has_min_max_ = 1;
+        col_meta.min_offset_ = static_cast<uint32_t>(value_pos);
+        col_meta.min_len_ = col_agg.min_.len_;
+        MEMCPY(agg_row + value_pos, col_agg.min_.ptr_, col_agg.min_.len_);
+        value_pos += col_agg.min_.len_;
+        col_meta.max_offset_ = static_cast<uint32_t>(value_pos);
+        col_meta.max_len_ = col_agg.max_.len_;
+        MEMCPY(agg_row + value_pos, col_agg.max_.ptr_, col_agg.max_.len_);
+        value_pos += col_agg.max_.len_;
+      }
+    }
+    pos += agg_row_size;
+  }
+  return ret;
+}
+
+} // namespace blocksstable
+} // namespace oceanbase
@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
+#define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
+
+#include "share/datum/ob_datum_funcs.h"
+#include "ob_datum_row.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+struct ObDataStoreDesc;
+
+enum ObAggSumType : uint8_t
+{
+  AGG_SUM_NONE = 0,
+  AGG_SUM_INT = 1,
+  AGG_SUM_UINT = 2,
+  AGG_SUM_DOUBLE = 3,
+};
+
+// Pre-aggregated data appended to index rows of major sstable:
+//  |- ObAggRowHeader
+//  |- ObAggColumnMeta * col_cnt_
+//  |- min/max values of all columns
+struct ObAggRowHeader
+{
+  static const uint16_t AGG_ROW_HEADER_V1 = 1;
+  ObAggRowHeader() : version_(AGG_ROW_HEADER_V1), col_cnt_(0), length_(0) {}
+  OB_INLINE bool is_valid() const
+  {
+    return AGG_ROW_HEADER_V1 == version_ && col_cnt_ > 0
+        && length_ >= sizeof(ObAggRowHeader) + col_cnt_ * sizeof(ObAggColumnMeta);
+  }
+  struct ObAggColumnMeta
+  {
+    union
+    {
+      uint32_t pack_;
+      struct
+      {
+        uint32_t has_min_max_:1;    // Whether min/max value of non-null cells is recorded
+        uint32_t sum_type_:2;       // ObAggSumType of sum value
+        uint32_t reserved_:29;
+      };
+    };
+    uint32_t min_offset_;           // Offset of min value from the beginning of agg row
+    uint32_t min_len_;
+    uint32_t max_offset_;           // Offset of max value from the beginning of agg row
+    uint32_t max_len_;
+    uint32_t reserved2_;
+    int64_t null_count_;            // Null cell count of this column
+    union
+    {
+      int64_t int_sum_;
+      uint64_t uint_sum_;
+      double double_sum_;
+    };
+  };
+  uint16_t version_;
+  uint16_t col_cnt_;                // Count of aggregated columns, prefix of stored columns
+  uint32_t length_;                 // Total length of agg row, header included
+  TO_STRING_KV(K_(version), K_(col_cnt), K_(length));
+};
+typedef ObAggRowHeader::ObAggColumnMeta ObAggColumnMeta;
+
+// Pre-aggregated statistics of one column, min/max point into agg row buffer
+struct ObAggColumnInfo
+{
+  ObAggColumnInfo() { reset(); }
+  void reset();
+  OB_INLINE bool has_min_max() const { return has_min_max_; }
+  OB_INLINE bool has_sum() const { return AGG_SUM_NONE != sum_type_; }
+  TO_STRING_KV(K_(has_min_max), K_(min), K_(max), K_(null_count), K_(sum_type), K_(int_sum));
+  bool has_min_max_;
+  ObStorageDatum min_;
+  ObStorageDatum max_;
+  int64_t null_count_;
+  ObAggSumType sum_type_;
+  union
+  {
+    int64_t int_sum_;
+    uint64_t uint_sum_;
+    double double_sum_;
+  };
+};
+
+class ObAggRowReader
+{
+public:
+  ObAggRowReader();
+  ~ObAggRowReader() = default;
+  void reset();
+  int init(const char *buf, const int64_t buf_size);
+  OB_INLINE bool is_inited() const { return nullptr != header_; }
+  OB_INLINE int64_t get_column_count() const
+  {
+    return nullptr == header_ ? 0 : header_->col_cnt_;
+  }
+  int read(const int64_t col_idx, ObAggColumnInfo &col_info) const;
+  // Length of agg row located at @buf, used to skip it when parsing index row
+  static int get_agg_row_length(const char *buf, int64_t &length);
+  TO_STRING_KV(KPC_(header), KP_(buf), K_(buf_size));
+private:
+  const ObAggRowHeader *header_;
+  const char *buf_;
+  int64_t buf_size_;
+};
+
+// Accumulate per-column min, max, sum and null count of data rows (or of child index rows)
+// for one index row of major sstable.
+class ObIndexBlockAggregator
+{
+public:
+  // Every index row of micro block carries a 40B column meta per aggregated column, only the
+  // leading columns are aggregated to keep the index tree small
+  static const int64_t MAX_AGG_COLUMN_COUNT = 8;
+  // Variable-length values longer than this are not recorded since truncated max is not safe
+  static const int64_t MAX_AGG_DATUM_LENGTH = 48;
+  ObIndexBlockAggregator();
+  ~ObIndexBlockAggregator();
+  int init(const ObDataStoreDesc &store_desc, common::ObIAllocator &allocator);
+  void reset();
+  void reuse();
+  // Aggregate one data row
+  int eval(const ObDatumRow &row);
+  // Aggregate pre-aggregated data of a child index row
+  int eval(const char *agg_buf, const int64_t agg_buf_size, const int64_t row_count);
+  // Data below is not aggregated, the whole index row can not be pre-aggregated
+  OB_INLINE void abandon() { is_abandoned_ = true; }
+  OB_INLINE bool is_inited() const { return is_inited_; }
+  OB_INLINE bool is_aggregated() const { return is_inited_ && !is_abandoned_ && row_count_ > 0; }
+  OB_INLINE int64_t get_row_count() const { return row_count_; }
+  int64_t get_agg_row_size() const;
+  int write_agg_row(char *buf, const int64_t buf_len, int64_t &pos) const;
+  TO_STRING_KV(K_(col_cnt), K_(row_count), K_(is_abandoned), K_(is_inited));
+private:
+  struct ObColumnAggregator
+  {
+    ObColumnAggregator();
+    void reuse();
+    int eval(const ObStorageDatum &datum);
+    int eval(const ObAggColumnInfo &col_info, const int64_t row_count);
+    int update_min(const ObDatum &datum);
+    int update_max(const ObDatum &datum);
+    void add_sum(const ObAggColumnInfo &col_info);
+    OB_INLINE bool record_min_max() const { return min_max_enabled_ && !min_max_abandoned_ && has_value_; }
+    TO_STRING_KV(K_(min), K_(max), K_(null_count), K_(sum_type), K_(int_sum),
+        K_(min_max_enabled), K_(min_max_abandoned), K_(has_value));
+    common::ObDatumCmpFuncType cmp_func_;
+    ObStorageDatum min_;
+    ObStorageDatum max_;
+    int64_t null_count_;
+    ObAggSumType sum_type_;   // Sum type decided by column type
+    ObAggSumType cur_sum_type_;   // AGG_SUM_NONE after overflow
+    union
+    {
+      int64_t int_sum_;
+      uint64_t uint_sum_;
+      double double_sum_;
+    };
+    bool min_max_enabled_;
+    bool min_max_abandoned_;
+    bool has_value_;
+    char min_buf_[MAX_AGG_DATUM_LENGTH];
+    char max_buf_[MAX_AGG_DATUM_LENGTH];
+  };
+  static bool can_agg_min_max(const common::ObObjMeta &col_type);
+  static ObAggSumType get_sum_type(const common::ObObjMeta &col_type);
+private:
+  common::ObIAllocator *allocator_;
+  ObColumnAggregator *col_aggs_;
+  int64_t col_cnt_;
+  int64_t row_count_;
+  bool is_abandoned_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(ObIndexBlockAggregator);
+};
+
+} // namespace blocksstable
+} // namespace oceanbase
+
+#endif // OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
@@ -1199,6 +1199,7 @@ void ObBaseIndexBlockBuilder::block_to_row_desc(
   row_desc.is_deleted_ = micro_block_desc.can_mark_deletion_;
   row_desc.max_merged_trans_version_ = micro_block_desc.max_merged_trans_version_;
   row_desc.contain_uncommitted_row_ = micro_block_desc.contain_uncommitted_row_;
+  row_desc.aggregator_ = micro_block_desc.aggregator_;
 }
 
 int ObBaseIndexBlockBuilder::meta_to_row_desc(
@@ -369,6 +369,10 @@ int ObIndexBlockRowScanner::get_next(ObMicroIndexInfo &idx_block_row)
     if (OB_FAIL(idx_row_parser_.get_minor_meta(idx_minor_info))) {
       LOG_WARN("Fail to get minor meta info", K(ret));
     }
+  } else if (idx_row_header->is_pre_aggregated()) {
+    if (OB_FAIL(idx_row_parser_.get_agg_row(idx_block_row.agg_row_buf_, idx_block_row.agg_buf_size_))) {
+      LOG_WARN("Fail to get pre-aggregated data", K(ret));
+    }
   }
 
   if (OB_SUCC(ret)) {
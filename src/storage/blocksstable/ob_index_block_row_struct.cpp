@@ -24,14 +24,14 @@ namespace blocksstable
 {
 
 ObIndexBlockRowDesc::ObIndexBlockRowDesc()
-  : data_store_desc_(nullptr), row_key_(), macro_id_(), block_offset_(0),
+  : aggregator_(nullptr), data_store_desc_(nullptr), row_key_(), macro_id_(), block_offset_(0),
     row_count_(0), row_count_delta_(0), max_merged_trans_version_(0), block_size_(0),
     macro_block_count_(0), micro_block_count_(0),
     is_deleted_(false), contain_uncommitted_row_(false), is_data_block_(false),
     is_secondary_meta_(false), is_macro_node_(false), has_out_row_column_(false) {}
 
 ObIndexBlockRowDesc::ObIndexBlockRowDesc(ObDataStoreDesc &data_store_desc)
-  : data_store_desc_(&data_store_desc), row_key_(), macro_id_(), block_offset_(0),
+  : aggregator_(nullptr), data_store_desc_(&data_store_desc), row_key_(), macro_id_(), block_offset_(0),
     row_count_(0), row_count_delta_(0), max_merged_trans_version_(0), block_size_(0),
     macro_block_count_(0), micro_block_count_(0),
     is_deleted_(false), contain_uncommitted_row_(false), is_data_block_(false),
@@ -245,10 +245,10 @@ int ObIndexBlockRowBuilder::calc_data_size(const ObIndexBlockRowDesc &desc, int6
     size = sizeof(ObIndexBlockRowHeader);
   } else if (MAJOR_MERGE == desc.data_store_desc_->merge_type_) {
     size = sizeof(ObIndexBlockRowHeader);
-    // if (desc.is_pre_aggregated_) {
-      // TODO: @saitong.zst Calculate aggregate size here
-      // size += aggregate_size;
-    // }
+    if (desc.data_store_desc_->need_pre_aggregation()
+        && nullptr != desc.aggregator_ && desc.aggregator_->is_aggregated()) {
+      size += desc.aggregator_->get_agg_row_size();
+    }
   } else {
     size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
   }
@@ -268,6 +268,15 @@ int ObIndexBlockRowBuilder::calc_data_size(
     size = sizeof(ObIndexBlockRowHeader);
   } else if (idx_row_header.is_major_node()) {
     size = sizeof(ObIndexBlockRowHeader);
+    if (idx_row_header.is_pre_aggregated()) {
+      int64_t agg_row_len = 0;
+      const char *agg_row_buf = reinterpret_cast<const char *>(&idx_row_header) + size;
+      if (OB_FAIL(ObAggRowReader::get_agg_row_length(agg_row_buf, agg_row_len))) {
+        LOG_WARN("Fail to get length of pre-aggregated data", K(ret), K(idx_row_header));
+      } else {
+        size += agg_row_len;
+      }
+    }
   } else {
     size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
   }
@@ -291,7 +300,9 @@ int ObIndexBlockRowBuilder::append_header_and_meta(const ObIndexBlockRowDesc &de
     header_->is_leaf_block_ = desc.is_macro_node_;
     header_->is_macro_node_ = desc.is_macro_node_;
     header_->is_major_node_ = desc.data_store_desc_->merge_type_ == MAJOR_MERGE;
-    // header_->is_pre_aggregated_ =
+    header_->is_pre_aggregated_ = header_->is_major_node_ && is_data_mid_micro_block
+        && desc.data_store_desc_->need_pre_aggregation()
+        && nullptr != desc.aggregator_ && desc.aggregator_->is_aggregated();
     header_->is_deleted_ = desc.is_deleted_;
     header_->macro_id_ =(desc.is_data_block_ && is_data_mid_micro_block)
         ? ObIndexBlockRowHeader::DEFAULT_IDX_ROW_MACRO_ID : desc.macro_id_;
@@ -325,20 +336,24 @@ int ObIndexBlockRowBuilder::append_header_and_meta(const ObIndexBlockRowDesc &de
 int ObIndexBlockRowBuilder::append_aggregate_data(const ObIndexBlockRowDesc &desc)
 {
   int ret = OB_SUCCESS;
-  UNUSED(desc);
   if (OB_ISNULL(header_)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("Fail to append aggregation data to buffer", K(ret), KP_(header));
   } else if (!header_->is_pre_aggregated()) {
-  } else {
-    // TODO: @saitong.zst Write aggregate data here
+  } else if (OB_ISNULL(desc.aggregator_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null aggregator for pre-aggregated index row", K(ret), KPC_(header));
+  } else if (OB_FAIL(desc.aggregator_->write_agg_row(data_buf_,
+      write_pos_ + desc.aggregator_->get_agg_row_size(), write_pos_))) {
+    LOG_WARN("Fail to write pre-aggregated data", K(ret), K_(write_pos), KPC(desc.aggregator_));
   }
   return ret;
 }
 
 
 ObIndexBlockRowParser::ObIndexBlockRowParser()
-  : header_(nullptr), minor_meta_info_(nullptr), is_inited_(false) {}
+  : header_(nullptr), minor_meta_info_(nullptr), agg_row_buf_(nullptr), agg_buf_size_(0),
+    is_inited_(false) {}
 
 int ObIndexBlockRowParser::init(const int64_t rowkey_column_count, const ObDatumRow &row)
 {
@@ -364,6 +379,9 @@ int ObIndexBlockRowParser::init(const int64_t rowkey_column_count, const ObDatum
 int ObIndexBlockRowParser::init(const char *data_buf)
 {
   int ret = OB_SUCCESS;
+  minor_meta_info_ = nullptr;
+  agg_row_buf_ = nullptr;
+  agg_buf_size_ = 0;
   if (OB_ISNULL(data_buf)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Unexpected null data buffer for index block row data", K(ret));
@@ -378,10 +396,15 @@ int ObIndexBlockRowParser::init(const char *data_buf)
     const int64_t minor_meta_offset = sizeof(ObIndexBlockRowHeader);
     minor_meta_info_ = reinterpret_cast<const ObIndexBlockRowMinorMetaInfo *>(
       data_buf + minor_meta_offset);
+  } else if (header_->is_pre_aggregated()) {
+    agg_row_buf_ = data_buf + sizeof(ObIndexBlockRowHeader);
+    if (OB_FAIL(ObAggRowReader::get_agg_row_length(agg_row_buf_, agg_buf_size_))) {
+      LOG_WARN("Fail to locate pre-aggregated data", K(ret), KPC(header_));
+      agg_row_buf_ = nullptr;
+      agg_buf_size_ = 0;
+    }
   }
 
-  // TODO: @saitong.zst locate aggregated data logic here
-
   if (OB_SUCC(ret)) {
     is_inited_ = true;
   }
@@ -415,6 +438,19 @@ int ObIndexBlockRowParser::get_minor_meta(const ObIndexBlockRowMinorMetaInfo *&m
   return ret;
 }
 
+int ObIndexBlockRowParser::get_agg_row(const char *&agg_row_buf, int64_t &agg_buf_size) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else {
+    agg_row_buf = agg_row_buf_;
+    agg_buf_size = agg_buf_size_;
+  }
+  return ret;
+}
+
 int ObIndexBlockRowParser::is_macro_node(bool &is_macro_node) const
 {
   int ret = OB_SUCCESS;
@@ -18,6 +18,7 @@
 #include "ob_data_buffer.h"
 #include "ob_macro_block.h"
 #include "ob_datum_row.h"
+#include "ob_index_block_aggregator.h"
 
 namespace oceanbase
 {
@@ -49,7 +50,7 @@ struct ObIndexBlockRowDesc
     return ret;
   }
 
-  // const ObSSTablePreAggreator *aggregator_;
+  const ObIndexBlockAggregator *aggregator_;
   const ObDataStoreDesc *data_store_desc_;
   ObDatumRowkey row_key_;
   MacroBlockId macro_id_;
@@ -67,7 +68,7 @@ struct ObIndexBlockRowDesc
   bool is_macro_node_;
   bool has_out_row_column_;
 
-  TO_STRING_KV(KP_(data_store_desc), K_(row_key), K_(macro_id),
+  TO_STRING_KV(KP_(aggregator), KP_(data_store_desc), K_(row_key), K_(macro_id),
       K_(block_offset), K_(row_count), K_(row_count_delta),
       K_(max_merged_trans_version), K_(block_size),
       K_(macro_block_count), K_(micro_block_count),
@@ -196,6 +197,8 @@ public:
     : row_header_(nullptr),
       minor_meta_info_(nullptr),
       endkey_(nullptr),
+      agg_row_buf_(nullptr),
+      agg_buf_size_(0),
       query_range_(nullptr),
       flag_(0),
       range_idx_(-1),
@@ -207,6 +210,8 @@ public:
     row_header_ = nullptr;
     minor_meta_info_ = nullptr;
     endkey_ = nullptr;
+    agg_row_buf_ = nullptr;
+    agg_buf_size_ = 0;
     query_range_ = nullptr;
     flag_ = 0;
     range_idx_ = -1;
@@ -293,6 +298,13 @@ public:
     OB_ASSERT(nullptr != row_header_);
     return row_header_->has_out_row_column();
   }
+  OB_INLINE bool is_pre_aggregated() const
+  {
+    OB_ASSERT(nullptr != row_header_);
+    return row_header_->is_pre_aggregated() && nullptr != agg_row_buf_;
+  }
+  OB_INLINE const char *get_agg_row_buf() const { return agg_row_buf_; }
+  OB_INLINE int64_t get_agg_buf_size() const { return agg_buf_size_; }
   OB_INLINE bool is_left_border() const
   {
     return is_left_border_;
@@ -346,13 +358,14 @@ public:
   }
 
   TO_STRING_KV(KP_(query_range), KPC_(row_header), KPC_(minor_meta_info), KPC_(endkey),
-      K_(flag), K_(range_idx), K_(parent_macro_id));
+      KP_(agg_row_buf), K_(agg_buf_size), K_(flag), K_(range_idx), K_(parent_macro_id));
 
 public:
   const ObIndexBlockRowHeader *row_header_;
   const ObIndexBlockRowMinorMetaInfo *minor_meta_info_;
   const ObDatumRowkey *endkey_;
-  // ObPreAggDataStore *pre_agg_data_;
+  const char *agg_row_buf_;
+  int64_t agg_buf_size_;
   union {
     const ObDatumRowkey *rowkey_;
     const ObDatumRange *range_;
@@ -420,6 +433,7 @@ public:
   int init(const char *data_buf);
   int get_header(const ObIndexBlockRowHeader *&header) const;
   int get_minor_meta(const ObIndexBlockRowMinorMetaInfo *&meta) const;
+  int get_agg_row(const char *&agg_row_buf, int64_t &agg_buf_size) const;
   int is_macro_node(bool &is_macro_node) const;
   int64_t get_snapshot_version() const;
   int64_t get_max_merged_trans_version() const;
@@ -429,7 +443,8 @@ public:
 private:
   const ObIndexBlockRowHeader *header_;
   const ObIndexBlockRowMinorMetaInfo *minor_meta_info_;
-  // Aggregate data read struct
+  const char *agg_row_buf_;
+  int64_t agg_buf_size_;
   bool is_inited_;
 };
 
@@ -16,6 +16,7 @@
 #include "ob_block_manager.h"
 #include "ob_macro_block.h"
 #include "observer/ob_server_struct.h"
+#include "share/ob_cluster_version.h"
 #include "share/ob_encryption_util.h"
 #include "share/ob_force_print_log.h"
 #include "share/ob_task_define.h"
@@ -257,6 +258,15 @@ int ObDataStoreDesc::init(
           STORAGE_LOG(WARN, "Failed to set major working cluster version", K(ret), K(*this));
         }
       }
+      bool is_oracle_mode = false;
+      int tmp_ret = OB_SUCCESS;
+      if (OB_FAIL(ret)) {
+      } else if (OB_TMP_FAIL(merge_schema.check_if_oracle_compat_mode(is_oracle_mode))) {
+        // without the compat mode of the table, micro blocks are not pre-aggregated
+        STORAGE_LOG(WARN, "failed to get compat mode from merge schema", K(tmp_ret), K_(tablet_id));
+      } else {
+        compat_mode_ = is_oracle_mode ? lib::Worker::CompatMode::ORACLE : lib::Worker::CompatMode::MYSQL;
+      }
     }
 
     if (OB_FAIL(ret)) {
@@ -286,6 +296,14 @@ bool ObDataStoreDesc::is_valid() const
          && snapshot_version_ > 0;
 }
 
+bool ObDataStoreDesc::need_pre_aggregation() const
+{
+  // the aggregated index row is a new format, only written once all the servers can read it
+  return is_major_merge()
+         && major_working_cluster_version_ >= CLUSTER_VERSION_4_1_0_0
+         && lib::Worker::CompatMode::INVALID != compat_mode_;
+}
+
 void ObDataStoreDesc::reset()
 {
   ls_id_.reset();
@@ -312,6 +330,7 @@ void ObDataStoreDesc::reset()
   MEMSET(encrypt_key_, 0, sizeof(encrypt_key_));
   progressive_merge_round_ = 0;
   major_working_cluster_version_ = 0;
+  compat_mode_ = lib::Worker::CompatMode::INVALID;
   sstable_index_builder_ = nullptr;
   is_ddl_ = false;
   col_desc_array_.reset();
@@ -345,6 +364,7 @@ int ObDataStoreDesc::assign(const ObDataStoreDesc &desc)
   master_key_id_ = desc.master_key_id_;
   MEMCPY(encrypt_key_, desc.encrypt_key_, sizeof(encrypt_key_));
   major_working_cluster_version_ = desc.major_working_cluster_version_;
+  compat_mode_ = desc.compat_mode_;
   is_ddl_ = desc.is_ddl_;
   col_desc_array_.reset();
   datum_utils_.reset();
@@ -73,6 +73,8 @@ struct ObDataStoreDesc
   // major_working_cluster_version_ == 0 means upgrade from old cluster
   // which still use freezeinfo without cluster version
   int64_t major_working_cluster_version_;
+  // compat mode of the table for major merge, taken from the merge schema instead of the worker
+  lib::Worker::CompatMode compat_mode_;
   bool is_ddl_;
   common::ObArenaAllocator allocator_;
   common::ObFixedArray<share::schema::ObColDesc, common::ObIAllocator> col_desc_array_;
@@ -91,6 +93,7 @@ struct ObDataStoreDesc
   int assign(const ObDataStoreDesc &desc);
   bool encoding_enabled() const { return ObStoreFormat::is_row_store_type_with_encoding(row_store_type_); }
   OB_INLINE bool is_major_merge() const { return storage::is_major_merge(merge_type_); }
+  bool need_pre_aggregation() const;
   int64_t get_logical_version() const
   {
     return is_major_merge() ? snapshot_version_ : end_log_ts_;
@@ -116,6 +119,7 @@ struct ObDataStoreDesc
       K_(master_key_id),
       KPHEX_(encrypt_key, sizeof(encrypt_key_)),
       K_(major_working_cluster_version),
+      K_(compat_mode),
       KP_(sstable_index_builder),
       K_(is_ddl),
       K_(col_desc_array));
@@ -270,7 +270,8 @@ ObMacroBlockWriter::ObMacroBlockWriter()
    datum_row_(),
    check_datum_row_(),
    callback_(nullptr),
-   builder_(NULL)
+   builder_(NULL),
+   micro_aggregator_()
 {
   //macro_blocks_, macro_handles_
 }
@@ -306,6 +307,7 @@ void ObMacroBlockWriter::reset()
   micro_rowkey_hashs_.reset();
   datum_row_.reset();
   check_datum_row_.reset();
+  micro_aggregator_.reset();
   if (OB_NOT_NULL(builder_)) {
     builder_->~ObDataIndexBlockBuilder();
     builder_ = nullptr;
@@ -378,6 +380,11 @@ int ObMacroBlockWriter::open(
               sizeof(int64_t) * data_store_desc_->row_column_count_);
         }
       }
+      if (OB_SUCC(ret) && data_store_desc_->need_pre_aggregation() && nullptr != builder_) {
+        if (OB_FAIL(micro_aggregator_.init(data_store_desc, allocator_))) {
+          STORAGE_LOG(WARN, "Fail to init micro block aggregator", K(ret));
+        }
+      }
     }
   }
   return ret;
@@ -421,6 +428,8 @@ int ObMacroBlockWriter::append_row(const ObDatumRow &row, const int64_t split_si
           STORAGE_LOG(WARN, "Fail to build micro block, ", K(ret));
         } else if (OB_FAIL(micro_writer_->append_row(*row_to_append))) {
           STORAGE_LOG(ERROR, "Fail to append row to micro block, ", K(ret), K(row));
+        } else if (micro_aggregator_.is_inited() && OB_FAIL(micro_aggregator_.eval(*row_to_append))) {
+          STORAGE_LOG(WARN, "Fail to aggregate row, ", K(ret), K(row));
         } else if (OB_FAIL(save_last_key(*row_to_append))) {
           STORAGE_LOG(WARN, "Fail to save last key, ", K(ret), K(row));
         }
@@ -455,6 +464,8 @@ int ObMacroBlockWriter::append_row(const ObDatumRow &row, const int64_t split_si
         }
       }
       if (OB_FAIL(ret)) {
+      } else if (micro_aggregator_.is_inited() && OB_FAIL(micro_aggregator_.eval(*row_to_append))) {
+        STORAGE_LOG(WARN, "Fail to aggregate row, ", K(ret), K(row));
       } else if (OB_FAIL(save_last_key(*row_to_append))) {
         STORAGE_LOG(WARN, "Fail to save last key, ", K(ret), K(row));
       } else if (micro_writer_->get_block_size() >= split_size) {
@@ -542,8 +553,11 @@ int ObMacroBlockWriter::append_micro_block(const ObMicroBlock &micro_block)
         STORAGE_LOG(WARN, "build_micro_block_desc failed", K(ret), K(micro_block));
       } else if (OB_FAIL(write_micro_block(micro_block_desc))) {
         STORAGE_LOG(WARN, "Failed to write micro block, ", K(ret), K(micro_block_desc));
-      } else if (NULL != data_store_desc_->merge_info_) {
-        data_store_desc_->merge_info_->multiplexed_micro_count_in_new_macro_++;
+      } else {
+        micro_aggregator_.reuse();
+        if (NULL != data_store_desc_->merge_info_) {
+          data_store_desc_->merge_info_->multiplexed_micro_count_in_new_macro_++;
+        }
       }
     }
   } else {
@@ -758,6 +772,8 @@ int ObMacroBlockWriter::build_micro_block()
     STORAGE_LOG(WARN, "failed to build micro block desc", K(ret));
   } else if (FALSE_IT(micro_block_desc.last_rowkey_ = last_key_)) {
   } else if (FALSE_IT(block_size = micro_block_desc.buf_size_)) {
+  } else if (FALSE_IT(micro_block_desc.aggregator_ =
+      micro_aggregator_.is_aggregated() ? &micro_aggregator_ : nullptr)) {
   } else if (OB_FAIL(micro_helper_.compress_encrypt_micro_block(micro_block_desc))) {
     micro_writer_->dump_diagnose_info(); // ignore dump error
     STORAGE_LOG(WARN, "failed to compress and encrypt micro block", K(ret), K(micro_block_desc));
@@ -772,6 +788,7 @@ int ObMacroBlockWriter::build_micro_block()
   }
   if (OB_SUCC(ret)) {
     micro_writer_->reuse();
+    micro_aggregator_.reuse();
     if (data_store_desc_->need_prebuild_bloomfilter_ && micro_rowkey_hashs_.count() > 0) {
       micro_rowkey_hashs_.reuse();
     }
@@ -831,6 +848,16 @@ int ObMacroBlockWriter::build_micro_block_desc_with_reuse(
     micro_block_desc.buf_size_ = header.data_zlength_;
     micro_block_desc.has_out_row_column_ = micro_block.micro_index_info_->has_out_row_column();
     micro_block_desc.original_size_ = header.original_length_;
+    // Schema version is not changed, carry over pre-aggregated data of the reused micro block
+    if (micro_aggregator_.is_inited() && micro_block.micro_index_info_->is_pre_aggregated()) {
+      if (OB_FAIL(micro_aggregator_.eval(micro_block.micro_index_info_->get_agg_row_buf(),
+                                         micro_block.micro_index_info_->get_agg_buf_size(),
+                                         header.row_count_))) {
+        LOG_WARN("Fail to aggregate reused micro block", K(ret), KPC(micro_block.micro_index_info_));
+      } else if (micro_aggregator_.is_aggregated()) {
+        micro_block_desc.aggregator_ = &micro_aggregator_;
+      }
+    }
   }
   STORAGE_LOG(DEBUG, "build micro block desc reuse", K(data_store_desc_->tablet_id_), K(micro_block_desc), "lbt", lbt(), K(ret));
   return ret;
@@ -18,6 +18,7 @@
 #include "lib/compress/ob_compressor.h"
 #include "lib/container/ob_array_wrap.h"
 #include "ob_block_manager.h"
+#include "ob_index_block_aggregator.h"
 #include "ob_index_block_row_struct.h"
 #include "ob_macro_block_checker.h"
 #include "ob_macro_block_reader.h"
@@ -178,6 +179,7 @@ private:
   blocksstable::ObDatumRow check_datum_row_;
   ObIMacroBlockFlushCallback *callback_;
   ObDataIndexBlockBuilder *builder_;
+  ObIndexBlockAggregator micro_aggregator_; // pre-aggregate rows of current micro block for major sstable
 };
 
 }//end namespace blocksstable
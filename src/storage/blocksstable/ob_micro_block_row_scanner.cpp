@@ -47,7 +47,8 @@ ObIMicroBlockRowScanner::ObIMicroBlockRowScanner(common::ObIAllocator &allocator
     context_(nullptr),
     allocator_(allocator),
     can_ignore_multi_version_(false),
-    block_row_store_(nullptr)
+    block_row_store_(nullptr),
+    index_info_(nullptr)
 {}
 
 ObIMicroBlockRowScanner::~ObIMicroBlockRowScanner()
@@ -72,6 +73,7 @@ void ObIMicroBlockRowScanner::reuse()
   start_ = ObIMicroBlockReaderInfo::INVALID_ROW_INDEX;
   last_ = ObIMicroBlockReaderInfo::INVALID_ROW_INDEX;
   can_ignore_multi_version_ = false;
+  index_info_ = nullptr;
 }
 
 int ObIMicroBlockRowScanner::init(
@@ -295,13 +297,15 @@ int ObIMicroBlockRowScanner::inner_get_next_row_blockscan(const ObDatumRow *&row
 
 int ObIMicroBlockRowScanner::apply_blockscan(
     storage::ObBlockRowStore *block_row_store,
-    storage::ObTableStoreStat &table_store_stat)
+    storage::ObTableStoreStat &table_store_stat,
+    const ObMicroIndexInfo *index_info)
 {
   int ret = OB_SUCCESS;
   if (OB_UNLIKELY(nullptr == block_row_store || !block_row_store->is_valid() || nullptr == reader_)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("Unexpected block row store", K(ret), KPC(block_row_store_), KP_(reader));
   } else if (FALSE_IT(block_row_store_ = block_row_store)) {
+  } else if (FALSE_IT(index_info_ = index_info)) {
   } else if (OB_FAIL(end_of_block())) {
     if (OB_UNLIKELY(OB_ITER_END != ret)) {
       LOG_WARN("Failed to judge end of block or not", K(ret), K_(macro_id), K_(start), K_(last), K_(current));
@@ -316,6 +320,7 @@ int ObIMicroBlockRowScanner::apply_blockscan(
   } else if (OB_FAIL(THIS_WORKER.check_status())) {
     LOG_WARN("query interrupt", K(ret));
   }
+  index_info_ = nullptr;
   return ret;
 }
 
@@ -504,9 +509,14 @@ int ObIMicroBlockRowScanner::filter_pushdown_filter(
         LOG_WARN("Failed to execute black pushdown filter", K(ret));
       }
     } else {
-      if (OB_FAIL(decoder->filter_pushdown_filter(
+      bool filtered = false;
+      sql::ObWhiteFilterExecutor *white_filter = static_cast<sql::ObWhiteFilterExecutor *>(filter);
+      if (OB_FAIL(filter_by_pre_agg_data(*white_filter, bitmap, filtered))) {
+        LOG_WARN("Failed to filter by pre-aggregated data", K(ret));
+      } else if (filtered) {
+      } else if (OB_FAIL(decoder->filter_pushdown_filter(
                   parent,
-                  *static_cast<sql::ObWhiteFilterExecutor *>(filter),
+                  *white_filter,
                   pd_filter_info,
                   bitmap))) {
         LOG_WARN("Failed to execute black pushdown filter", K(ret));
@@ -514,7 +524,12 @@ int ObIMicroBlockRowScanner::filter_pushdown_filter(
     }
   } else {
     blocksstable::ObMicroBlockReader *flat_reader = static_cast<blocksstable::ObMicroBlockReader *>(reader_);
-    if (OB_FAIL(flat_reader->filter_pushdown_filter(
+    bool filtered = false;
+    if (filter->is_filter_white_node() && OB_FAIL(filter_by_pre_agg_data(
+                *static_cast<sql::ObWhiteFilterExecutor *>(filter), bitmap, filtered))) {
+      LOG_WARN("Failed to filter by pre-aggregated data", K(ret));
+    } else if (filtered) {
+    } else if (OB_FAIL(flat_reader->filter_pushdown_filter(
                 parent,
                 *filter,
                 pd_filter_info,
@@ -526,6 +541,111 @@ int ObIMicroBlockRowScanner::filter_pushdown_filter(
   return ret;
 }
 
+// Decide result of the white filter for the whole micro block by min/max and null count
+// recorded in its index row, @filtered is false if it can not be decided.
+int ObIMicroBlockRowScanner::filter_by_pre_agg_data(
+    const sql::ObWhiteFilterExecutor &filter,
+    common::ObBitmap &bitmap,
+    bool &filtered)
+{
+  int ret = OB_SUCCESS;
+  filtered = false;
+  const common::ObIArray<int32_t> &col_offsets = filter.get_col_offsets();
+  const sql::ColumnParamFixedArray &col_params = filter.get_col_params();
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  if (nullptr == index_info_ || !index_info_->is_pre_aggregated()) {
+  } else if (1 != col_offsets.count() || nullptr != col_params.at(0) || filter.null_param_contained()) {
+    // padding of fixed length char is needed, or result of null param is decided by decoders
+  } else if (sql::WHITE_OP_NE == op_type || sql::WHITE_OP_IN == op_type) {
+  } else {
+    const int64_t col_idx = read_info_->get_columns_index().at(col_offsets.at(0));
+    const int64_t row_count = reader_->row_count();
+    const common::ObObjMeta &col_type = read_info_->get_columns_desc().at(col_offsets.at(0)).col_type_;
+    const common::ObIArray<common::ObObj> &ref_objs = filter.get_objs();
+    ObAggRowReader agg_reader;
+    ObAggColumnInfo col_info;
+    bool all_true = false;
+    bool all_false = false;
+    if (col_idx < 0 || bitmap.size() != row_count) {
+    } else if (OB_FAIL(agg_reader.init(index_info_->get_agg_row_buf(), index_info_->get_agg_buf_size()))) {
+      LOG_WARN("Fail to init agg row reader", K(ret), KPC_(index_info));
+    } else if (col_idx >= agg_reader.get_column_count()) {
+    } else if (OB_FAIL(agg_reader.read(col_idx, col_info))) {
+      LOG_WARN("Fail to read pre-aggregated column", K(ret), K(col_idx));
+    } else if (sql::WHITE_OP_NU == op_type || sql::WHITE_OP_NN == op_type) {
+      const bool no_null = 0 == col_info.null_count_;
+      const bool all_null = row_count == col_info.null_count_;
+      all_true = sql::WHITE_OP_NU == op_type ? all_null : no_null;
+      all_false = sql::WHITE_OP_NU == op_type ? no_null : all_null;
+    } else if (row_count == col_info.null_count_) {
+      // comparison with null is never true
+      all_false = true;
+    } else if (!col_info.has_min_max()) {
+    } else if ((sql::WHITE_OP_BT == op_type && 2 != ref_objs.count())
+        || (sql::WHITE_OP_BT != op_type && 1 != ref_objs.count())) {
+    } else {
+      common::ObObj min_obj;
+      common::ObObj max_obj;
+      const common::ObCollationType cs_type = col_type.get_collation_type();
+      if (OB_FAIL(col_info.min_.to_obj_enhance(min_obj, col_type))) {
+        LOG_WARN("Fail to convert min datum to obj", K(ret), K(col_info), K(col_type));
+      } else if (OB_FAIL(col_info.max_.to_obj_enhance(max_obj, col_type))) {
+        LOG_WARN("Fail to convert max datum to obj", K(ret), K(col_info), K(col_type));
+      } else {
+        const common::ObObj &ref = ref_objs.at(0);
+        const int min_cmp = common::ObObjCmpFuncs::compare_nullsafe(min_obj, ref, cs_type);
+        const int max_cmp = common::ObObjCmpFuncs::compare_nullsafe(max_obj, ref, cs_type);
+        switch (op_type) {
+          case sql::WHITE_OP_EQ: {
+            all_false = min_cmp > 0 || max_cmp < 0;
+            all_true = 0 == min_cmp && 0 == max_cmp;
+            break;
+          }
+          case sql::WHITE_OP_LT: {
+            all_false = min_cmp >= 0;
+            all_true = max_cmp < 0;
+            break;
+          }
+          case sql::WHITE_OP_LE: {
+            all_false = min_cmp > 0;
+            all_true = max_cmp <= 0;
+            break;
+          }
+          case sql::WHITE_OP_GT: {
+            all_false = max_cmp <= 0;
+            all_true = min_cmp > 0;
+            break;
+          }
+          case sql::WHITE_OP_GE: {
+            all_false = max_cmp < 0;
+            all_true = min_cmp >= 0;
+            break;
+          }
+          case sql::WHITE_OP_BT: {
+            const int max_cmp_right = common::ObObjCmpFuncs::compare_nullsafe(max_obj, ref_objs.at(1), cs_type);
+            const int min_cmp_right = common::ObObjCmpFuncs::compare_nullsafe(min_obj, ref_objs.at(1), cs_type);
+            all_false = max_cmp < 0 || min_cmp_right > 0;
+            all_true = min_cmp >= 0 && max_cmp_right <= 0;
+            break;
+          }
+          default: {
+            break;
+          }
+        }
+        // null cells never satisfy comparison
+        all_true = all_true && 0 == col_info.null_count_;
+      }
+    }
+    if (OB_SUCC(ret) && (all_true || all_false)) {
+      bitmap.reuse(all_true);
+      filtered = true;
+      LOG_DEBUG("[PUSHDOWN] micro block filtered by pre-aggregated data", K(op_type), K(all_true),
+                K(col_idx), K(col_info), K(ref_objs));
+    }
+  }
+  return ret;
+}
+
 ////////////////////////////////// ObMicroBlockRowScannerV2 ////////////////////////////////////////////
 int ObMicroBlockRowScanner::init(
     const storage::ObTableIterParam &param,
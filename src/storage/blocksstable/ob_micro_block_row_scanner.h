@@ -56,9 +56,12 @@ public:
       const bool is_right_border);
   virtual int get_next_row(const ObDatumRow *&row);
   virtual int get_next_rows();
+  // @index_info: index row of current micro block, its pre-aggregated data is used to
+  // decide the result of white filters without decoding when available
   virtual int apply_blockscan(
       storage::ObBlockRowStore *block_row_store,
-      storage::ObTableStoreStat &table_store_stat);
+      storage::ObTableStoreStat &table_store_stat,
+      const ObMicroIndexInfo *index_info = nullptr);
   int filter_pushdown_filter(
       sql::ObPushdownFilterExecutor *parent,
       sql::ObPushdownFilterExecutor *filter,
@@ -86,6 +89,10 @@ protected:
   { return row.row_flag_.is_not_exist(); }
 private:
   int inner_get_next_row_blockscan(const ObDatumRow *&row);
+  int filter_by_pre_agg_data(
+      const sql::ObWhiteFilterExecutor &filter,
+      common::ObBitmap &bitmap,
+      bool &filtered);
 
 protected:
   bool is_inited_;
@@ -110,6 +117,7 @@ protected:
   ObIAllocator &allocator_;
   bool can_ignore_multi_version_;
   storage::ObBlockRowStore *block_row_store_;
+  const ObMicroIndexInfo *index_info_;
 };
 
 // major sstable micro block scanner for query and merge
@@ -290,9 +298,10 @@ public:
   void reuse() override;
   virtual int apply_blockscan(
       storage::ObBlockRowStore *block_row_store,
-      storage::ObTableStoreStat &table_store_stat) override final
+      storage::ObTableStoreStat &table_store_stat,
+      const ObMicroIndexInfo *index_info = nullptr) override final
   {
-    UNUSEDx(block_row_store, table_store_stat);
+    UNUSEDx(block_row_store, table_store_stat, index_info);
     return OB_NOT_SUPPORTED;
   }
   virtual int get_next_rows() override
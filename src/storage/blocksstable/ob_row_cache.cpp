@@ -246,6 +246,51 @@ int ObRowCache::get_row(const ObRowCacheKey &key, ObRowValueHandle &handle)
   return ret;
 }
 
+int ObRowCache::get_rows(
+    const int64_t count,
+    const ObRowCacheKey *const *keys,
+    ObRowValueHandle *handles,
+    int *rets)
+{
+  int ret = OB_SUCCESS;
+  const ObRowCacheValue *values[ObKVCacheMap::MAX_MULTI_GET_CNT];
+  ObKVCacheHandle kv_handles[ObKVCacheMap::MAX_MULTI_GET_CNT];
+
+  if (OB_UNLIKELY(count < 0 || count > ObKVCacheMap::MAX_MULTI_GET_CNT)
+      || OB_ISNULL(keys) || OB_ISNULL(handles) || OB_ISNULL(rets)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(count), KP(keys), KP(handles), KP(rets), K(ret));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < count; ++i) {
+      handles[i].reset();
+      if (OB_ISNULL(keys[i]) || OB_UNLIKELY(!keys[i]->is_valid())) {
+        ret = OB_INVALID_ARGUMENT;
+        STORAGE_LOG(WARN, "invalid row cache key.", K(i), KPC(keys[i]), K(ret));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(multi_get(count, keys, values, kv_handles, rets))) {
+      STORAGE_LOG(WARN, "Fail to multi get keys from row cache, ", K(count), K(ret));
+    } else {
+      for (int64_t i = 0; OB_SUCC(ret) && i < count; ++i) {
+        if (OB_SUCCESS != rets[i]) {
+          if (OB_UNLIKELY(OB_ENTRY_NOT_EXIST != rets[i])) {
+            STORAGE_LOG(WARN, "Fail to get key from row cache, ", K(i), "ret", rets[i]);
+          }
+          EVENT_INC(ObStatEventIds::ROW_CACHE_MISS);
+        } else if (OB_ISNULL(values[i])) {
+          ret = OB_ERR_UNEXPECTED;
+          STORAGE_LOG(WARN, "Unexpected error, the value is NULL, ", K(i), K(ret));
+        } else {
+          EVENT_INC(ObStatEventIds::ROW_CACHE_HIT);
+          handles[i].row_value_ = const_cast<ObRowCacheValue*>(values[i]);
+          handles[i].handle_.move_from(kv_handles[i]);
+        }
+      }
+    }
+  }
+  return ret;
+}
 
 int ObRowCache::put_row(const ObRowCacheKey &key, const ObRowCacheValue &value)
 {
@@ -103,6 +103,12 @@ public:
   ObRowCache();
   virtual ~ObRowCache();
   int get_row(const ObRowCacheKey &key, ObRowValueHandle &handle);
+  // handles[i] is valid only if rets[i] is OB_SUCCESS
+  int get_rows(
+      const int64_t count,
+      const ObRowCacheKey *const *keys,
+      ObRowValueHandle *handles,
+      int *rets);
   int put_row(const ObRowCacheKey &key, const ObRowCacheValue &value);
   DISALLOW_COPY_AND_ASSIGN(ObRowCache);
 };
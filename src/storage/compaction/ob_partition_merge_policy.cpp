@@ -627,6 +627,14 @@ int ObPartitionMergePolicy::check_need_mini_merge(
 int ObPartitionMergePolicy::check_need_mini_minor_merge(
     const ObTablet &tablet,
     bool &need_merge)
+{
+  return check_need_read_aware_mini_minor_merge(tablet, TABLET_READ_NORMAL, need_merge);
+}
+
+int ObPartitionMergePolicy::check_need_read_aware_mini_minor_merge(
+    const ObTablet &tablet,
+    const ObTabletReadHeat read_heat,
+    bool &need_merge)
 {
   int ret = OB_SUCCESS;
   int64_t min_snapshot_version = 0;
@@ -644,6 +652,13 @@ int ObPartitionMergePolicy::check_need_mini_minor_merge(
     mini_minor_threshold = tenant_config->minor_compact_trigger;
     delay_merge_schedule_interval = tenant_config->_minor_compaction_interval;
   }
+  if (TABLET_READ_NORMAL != read_heat) {
+    mini_minor_threshold = cal_read_aware_minor_compact_trigger(mini_minor_threshold, read_heat);
+    if (TABLET_READ_HOT == read_heat) {
+      // every extra mini sstable is probed by each read, do not delay the compaction
+      delay_merge_schedule_interval = 0;
+    }
+  }
   if (table_store.get_minor_sstables().count_ <= mini_minor_threshold) {
     // total number of mini sstable is less than threshold + 1
   } else if (tablet.is_ls_tx_data_tablet()) {
@@ -711,7 +726,7 @@ int ObPartitionMergePolicy::check_need_mini_minor_merge(
   }
   if (OB_SUCC(ret) && need_merge) {
     LOG_DEBUG("check mini minor merge", "ls_id", tablet.get_tablet_meta().ls_id_,
-             K(tablet_id), K(need_merge), K(table_store));
+             K(tablet_id), K(need_merge), K(read_heat), K(mini_minor_threshold), K(table_store));
   }
   if (OB_SUCC(ret) && !need_merge && table_store.get_minor_sstables().count() >= DIAGNOSE_TABLE_CNT_IN_STORAGE) {
     ADD_SUSPECT_INFO(MINOR_MERGE,
@@ -1150,5 +1165,19 @@ int64_t ObPartitionMergePolicy::cal_hist_minor_merge_threshold()
   return MIN((1 + compact_trigger) * OB_HIST_MINOR_FACTOR, MAX_TABLE_CNT_IN_STORAGE / 2);
 }
 
+int64_t ObPartitionMergePolicy::cal_read_aware_minor_compact_trigger(
+    const int64_t minor_compact_trigger,
+    const ObTabletReadHeat read_heat)
+{
+  int64_t compact_trigger = minor_compact_trigger;
+  if (TABLET_READ_HOT == read_heat) {
+    compact_trigger = minor_compact_trigger / 2;
+  } else if (TABLET_READ_COLD == read_heat) {
+    // keep the deferred trigger below the hist minor merge threshold
+    compact_trigger = MAX(minor_compact_trigger, MIN(minor_compact_trigger * 2, MAX_READ_COLD_MINOR_COMPACT_TRIGGER));
+  }
+  return compact_trigger;
+}
+
 } /* namespace compaction */
 } /* namespace oceanbase */
@@ -34,6 +34,14 @@ using namespace storage;
 
 namespace compaction
 {
+// read heat of a tablet observed from the table store statistics
+enum ObTabletReadHeat
+{
+  TABLET_READ_NORMAL = 0,
+  TABLET_READ_HOT = 1,
+  TABLET_READ_COLD = 2,
+};
+
 class ObPartitionMergePolicy
 {
 public:
@@ -75,6 +83,13 @@ public:
       const storage::ObTablet &tablet,
       bool &need_merge);
 
+  // read-hot tablets are merged with a lower minor_compact_trigger and without delay,
+  // read-cold tablets are merged with a higher one
+  static int check_need_read_aware_mini_minor_merge(
+      const storage::ObTablet &tablet,
+      const ObTabletReadHeat read_heat,
+      bool &need_merge);
+
   static int check_need_hist_minor_merge(
       const storage::ObTablet &tablet,
       bool &need_merge);
@@ -142,6 +157,9 @@ private:
       storage::ObTenantFreezeInfoMgr::NeighbourFreezeInfo &freeze_info);
 
   static int64_t cal_hist_minor_merge_threshold();
+  static int64_t cal_read_aware_minor_compact_trigger(
+      const int64_t minor_compact_trigger,
+      const ObTabletReadHeat read_heat);
 
   static int deal_hist_minor_merge(
       const ObTablet &tablet,
@@ -160,6 +178,7 @@ public:
   static const int64_t OB_UNSAFE_TABLE_CNT = 32;
   static const int64_t OB_EMERGENCY_TABLE_CNT = 56;
   static const int64_t DEFAULT_MINOR_COMPACT_TRIGGER = 2;
+  static const int64_t MAX_READ_COLD_MINOR_COMPACT_TRIGGER = 16;
 
   typedef int (*GetMergeTables)(const storage::ObGetMergeTablesParam&,
                                 const int64_t,
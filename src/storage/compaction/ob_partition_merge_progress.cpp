@@ -36,6 +36,7 @@ ObPartitionMergeProgress::ObPartitionMergeProgress(common::ObIAllocator &allocat
     merge_dag_(nullptr),
     scanned_row_cnt_arr_(nullptr),
     output_block_cnt_arr_(nullptr),
+    range_estimate_row_cnt_arr_(nullptr),
     concurrent_cnt_(0),
     estimate_row_cnt_(0),
     estimate_occupy_size_(0),
@@ -63,6 +64,7 @@ void ObPartitionMergeProgress::reset()
     scanned_row_cnt_arr_ = nullptr;
   }
   output_block_cnt_arr_ = nullptr;
+  range_estimate_row_cnt_arr_ = nullptr;
   estimate_row_cnt_ = 0;
   estimate_occupy_size_ = 0;
   avg_row_length_ = 0;
@@ -104,14 +106,16 @@ int ObPartitionMergeProgress::init(ObTabletMergeCtx *ctx, const ObTableReadInfo
       || 0 == (concurrent_cnt = ctx->get_concurrent_cnt()))) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("get invalid arguments", K(ret), K(ctx), K(merge_dag), K(concurrent_cnt));
-  } else if (OB_ISNULL(buf = static_cast<int64_t *>(allocator_.alloc(sizeof(int64_t) * concurrent_cnt * 2)))) {
+  } else if (OB_ISNULL(buf = static_cast<int64_t *>(allocator_.alloc(sizeof(int64_t) * concurrent_cnt * 3)))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     LOG_WARN("Failed to alloc memory for unit_cnt_arr_", K(ret), K(concurrent_cnt));
   } else {
-    // for parallel merge, [0, concurrent_cnt) stores row count, [concurrent_cnt, concurrent_cnt * 2) stores block count
-    MEMSET(buf, 0, sizeof(int64_t) * concurrent_cnt * 2);
+    // for parallel merge, [0, concurrent_cnt) stores row count, [concurrent_cnt, concurrent_cnt * 2) stores block count,
+    // [concurrent_cnt * 2, concurrent_cnt * 3) stores the estimated row count of each range
+    MEMSET(buf, 0, sizeof(int64_t) * concurrent_cnt * 3);
     scanned_row_cnt_arr_ = buf;
     output_block_cnt_arr_ = buf + concurrent_cnt;
+    range_estimate_row_cnt_arr_ = buf + concurrent_cnt * 2;
 
     concurrent_cnt_ = concurrent_cnt;
     merge_dag_ = merge_dag;
@@ -120,6 +124,7 @@ int ObPartitionMergeProgress::init(ObTabletMergeCtx *ctx, const ObTableReadInfo
     if (OB_FAIL(estimate(ctx))) {
       LOG_WARN("failed to estimate unit count", K(ret), K(ctx));
     } else {
+      estimate_range_row_cnt(ctx->parallel_merge_ctx_.get_range_row_cnts());
       is_inited_ = true;
     }
   }
@@ -217,6 +222,45 @@ int ObPartitionMergeProgress::estimate(ObTabletMergeCtx *ctx)
   return ret;
 }
 
+void ObPartitionMergeProgress::estimate_range_row_cnt(const ObIArray<int64_t> &range_row_cnts)
+{
+  int64_t total_range_row_cnt = 0;
+  if (range_row_cnts.count() == concurrent_cnt_) {
+    for (int64_t i = 0; i < concurrent_cnt_; ++i) {
+      total_range_row_cnt += range_row_cnts.at(i);
+    }
+  }
+  if (total_range_row_cnt > 0) {
+    // the ranges are split by the base major sstable, the incremental rows are
+    // assumed to be spread over the ranges in the same proportion
+    for (int64_t i = 0; i < concurrent_cnt_; ++i) {
+      range_estimate_row_cnt_arr_[i] = static_cast<int64_t>(
+          estimate_row_cnt_ * (range_row_cnts.at(i) * 1.0 / total_range_row_cnt));
+    }
+  } else {
+    MEMSET(range_estimate_row_cnt_arr_, 0, sizeof(int64_t) * concurrent_cnt_);
+  }
+}
+
+void ObPartitionMergeProgress::update_estimate_row_cnt_(const int64_t scanned_row_cnt)
+{
+  int64_t range_estimate_row_cnt = 0;
+  int64_t estimate_row_cnt = 0;
+  for (int64_t i = 0; i < concurrent_cnt_; ++i) {
+    range_estimate_row_cnt += range_estimate_row_cnt_arr_[i];
+    estimate_row_cnt += MAX(range_estimate_row_cnt_arr_[i], scanned_row_cnt_arr_[i]);
+  }
+  if (range_estimate_row_cnt > 0 && estimate_row_cnt > estimate_row_cnt_) {
+    // one range scanning more rows than estimated raises the total estimate at once,
+    // rather than after the whole merge has scanned more rows than estimated
+    estimate_row_cnt_ = estimate_row_cnt;
+    avg_row_length_ = estimate_occupy_size_ * 1.0 / estimate_row_cnt_;
+  } else if (scanned_row_cnt >= estimate_row_cnt_) {
+    estimate_row_cnt_ += scanned_row_cnt - pre_scanned_row_cnt_;
+    avg_row_length_ = estimate_occupy_size_ * 1.0 / estimate_row_cnt_;
+  }
+}
+
 int ObPartitionMergeProgress::update_row_count(const int64_t idx, const int64_t incre_row_cnt)
 {
   int ret = OB_SUCCESS;
@@ -263,10 +307,7 @@ int ObPartitionMergeProgress::update_merge_progress(
           output_block_cnt += output_block_cnt_arr_[i];
         }
 
-        if (scanned_row_cnt >= estimate_row_cnt_) {
-          estimate_row_cnt_ += scanned_row_cnt - pre_scanned_row_cnt_;
-          avg_row_length_ = estimate_occupy_size_ * 1.0 / estimate_row_cnt_;
-        }
+        update_estimate_row_cnt_(scanned_row_cnt);
 
         // record old value
         pre_scanned_row_cnt_ = scanned_row_cnt;
@@ -377,10 +418,7 @@ int ObPartitionMajorMergeProgress::update_merge_progress(
           output_block_cnt += output_block_cnt_arr_[i];
         }
 
-        if (scanned_row_cnt >= estimate_row_cnt_) {
-          estimate_row_cnt_ += scanned_row_cnt - pre_scanned_row_cnt_;
-          avg_row_length_ = estimate_occupy_size_ * 1.0 / estimate_row_cnt_;
-        }
+        update_estimate_row_cnt_(scanned_row_cnt);
 
         // calculate delta value
         scan_data_size_delta = (scanned_row_cnt - pre_scanned_row_cnt_) * avg_row_length_;
@@ -52,6 +52,8 @@ public:
   static const int32_t NORMAL_UPDATE_PARAM = 120;
 protected:
   int estimate(ObTabletMergeCtx *ctx);
+  void estimate_range_row_cnt(const common::ObIArray<int64_t> &range_row_cnts);
+  void update_estimate_row_cnt_(const int64_t scanned_row_cnt);
   void update_estimated_finish_time_();
 
 protected:
@@ -60,6 +62,7 @@ protected:
   ObTabletMergeDag *merge_dag_;
   int64_t *scanned_row_cnt_arr_;
   int64_t *output_block_cnt_arr_;
+  int64_t *range_estimate_row_cnt_arr_;
   int64_t concurrent_cnt_;
   int64_t estimate_row_cnt_;
   int64_t estimate_occupy_size_;
@@ -31,6 +31,7 @@ namespace storage
 ObParallelMergeCtx::ObParallelMergeCtx()
   : parallel_type_(INVALID_PARALLEL_TYPE),
     range_array_(),
+    range_row_cnt_array_(),
     concurrent_cnt_(0),
     allocator_("paralMergeCtx", OB_MALLOC_NORMAL_BLOCK_SIZE),
     is_inited_(false)
@@ -46,6 +47,7 @@ void ObParallelMergeCtx::reset()
 {
   parallel_type_ = INVALID_PARALLEL_TYPE;
   range_array_.reset();
+  range_row_cnt_array_.reset();
   concurrent_cnt_ = 0;
   allocator_.reset();
   is_inited_ = false;
@@ -142,6 +144,7 @@ int ObParallelMergeCtx::init_serial_merge()
   ObDatumRange merge_range;
   merge_range.set_whole_range();
   range_array_.reset();
+  range_row_cnt_array_.reset();
   if (OB_FAIL(range_array_.push_back(merge_range))) {
     STORAGE_LOG(WARN, "Failed to push back merge range to array", K(ret), K(merge_range));
   } else {
@@ -165,21 +168,38 @@ int ObParallelMergeCtx::init_parallel_major_merge(compaction::ObTabletMergeCtx &
     STORAGE_LOG(WARN, "Unexpected first table", K(ret), K(merge_ctx.tables_handle_));
   } else {
     const int64_t tablet_size = merge_ctx.schema_ctx_.merge_schema_->get_tablet_size();
-    const ObSSTable *first_sstable = static_cast<const ObSSTable *>(first_table);
-    const int64_t macro_block_cnt = first_sstable->get_meta().get_macro_info().get_data_block_ids().count();
-    if (OB_FAIL(get_concurrent_cnt(tablet_size, macro_block_cnt, concurrent_cnt_))) {
-      STORAGE_LOG(WARN, "failed to get concurrent cnt", K(ret), K(tablet_size), K(concurrent_cnt_),
-        KPC(first_sstable));
-    } else if (1 == concurrent_cnt_) {
+    ObSSTable *first_sstable = static_cast<ObSSTable *>(const_cast<ObITable *>(first_table));
+    ObSEArray<ObStoreRange, 16> store_ranges;
+    ObPartitionMajorSSTableRangeSpliter major_sstable_range_spliter;
+    if (OB_FAIL(major_sstable_range_spliter.init(
+                merge_ctx.tablet_handle_.get_obj()->get_index_read_info(),
+                first_sstable,
+                tablet_size,
+                allocator_))) {
+      STORAGE_LOG(WARN, "Failed to init major sstable range spliter", K(ret), KPC(first_sstable));
+    } else if (OB_FAIL(major_sstable_range_spliter.split_ranges(store_ranges, range_row_cnt_array_))) {
+      STORAGE_LOG(WARN, "Failed to split major sstable ranges", K(ret), K(tablet_size), KPC(first_sstable));
+    } else if (store_ranges.count() <= 1) {
       if (OB_FAIL(init_serial_merge())) {
         STORAGE_LOG(WARN, "failed to init serial merge", K(ret), KPC(first_sstable));
       }
-    } else if (OB_FAIL(get_major_parallel_ranges(
-        first_sstable, tablet_size, merge_ctx.tablet_handle_.get_obj()->get_index_read_info()))) {
-      STORAGE_LOG(WARN, "Failed to get concurrent cnt from first sstable",
-          K(ret), K(tablet_size), K_(concurrent_cnt));
     } else {
-      parallel_type_ = PARALLEL_MAJOR;
+      // the merge tasks of one dag are picked up by whichever merge thread is idle,
+      // so ranges of balanced weight keep all the threads busy until the end
+      for (int64_t i = 0; OB_SUCC(ret) && i < store_ranges.count(); i++) {
+        ObDatumRange datum_range;
+        if (OB_FAIL(datum_range.from_range(store_ranges.at(i), allocator_))) {
+          STORAGE_LOG(WARN, "Failed to transfer store range to datum range", K(ret), K(i), K(store_ranges.at(i)));
+        } else if (OB_FAIL(range_array_.push_back(datum_range))) {
+          STORAGE_LOG(WARN, "Failed to push back merge range to array", K(ret), K(datum_range));
+        }
+      }
+      if (OB_SUCC(ret)) {
+        concurrent_cnt_ = range_array_.count();
+        parallel_type_ = PARALLEL_MAJOR;
+        STORAGE_LOG(INFO, "Succ to get parallel major merge ranges", K_(concurrent_cnt),
+                    K_(range_row_cnt_array), K_(range_array));
+      }
     }
   }
   /*
@@ -376,106 +396,5 @@ int ObParallelMergeCtx::calc_mini_minor_parallel_degree(const int64_t tablet_siz
   return ret;
 }
 
-
-int ObParallelMergeCtx::get_concurrent_cnt(
-    const int64_t tablet_size,
-    const int64_t macro_block_cnt,
-    int64_t &concurrent_cnt)
-{
-  int ret = OB_SUCCESS;
-  const int64_t max_merge_thread = MAX_MERGE_THREAD;
-  if (OB_UNLIKELY(tablet_size < 0)) {
-    ret = OB_INVALID_ARGUMENT;
-    STORAGE_LOG(WARN, "tablet size is invalid", K(tablet_size), K(ret));
-  } else if (0 == tablet_size) {
-    concurrent_cnt = 1;
-  } else {
-    const int64_t macro_block_size = OB_SERVER_BLOCK_MGR.get_macro_block_size();
-    if (((macro_block_cnt * macro_block_size + tablet_size - 1) / tablet_size) <= max_merge_thread) {
-      concurrent_cnt = (macro_block_cnt * macro_block_size + tablet_size - 1) /
-                       tablet_size;
-      if (0 == concurrent_cnt) {
-        concurrent_cnt = 1;
-      }
-    } else {
-      int64_t macro_cnts = (macro_block_cnt + max_merge_thread - 1) / max_merge_thread;
-      concurrent_cnt = (macro_block_cnt + macro_cnts - 1) / macro_cnts;
-    }
-  }
-  return ret;
-}
-
-int ObParallelMergeCtx::get_major_parallel_ranges(
-    const blocksstable::ObSSTable *first_major_sstable,
-    const int64_t tablet_size,
-    const ObTableReadInfo &index_read_info)
-{
-  int ret = OB_SUCCESS;
-  int64_t macro_block_cnt = 0;
-  if (OB_ISNULL(first_major_sstable)) {
-    ret = OB_INVALID_ARGUMENT;
-    STORAGE_LOG(WARN, "major sstable is unexpected null", K(ret), KPC(first_major_sstable));
-  } else if (OB_UNLIKELY(concurrent_cnt_ <= 1 || concurrent_cnt_ > MAX_MERGE_THREAD)) {
-    ret = OB_ERR_UNEXPECTED;
-    STORAGE_LOG(WARN, "concurrent cnt is invalid", K(ret), K_(concurrent_cnt));
-  } else {
-    const int64_t macro_block_cnt = first_major_sstable->get_meta().get_macro_info().get_data_block_ids().count();
-    const int64_t macro_block_cnt_per_range = (macro_block_cnt + concurrent_cnt_ - 1) / concurrent_cnt_;
-
-    ObDatumRowkey macro_endkey;
-    ObDatumRange range;
-    range.end_key_.set_min_rowkey();
-    range.set_left_open();
-    range.set_right_closed();
-
-    blocksstable::ObDataMacroBlockMeta blk_meta;
-    blocksstable::ObSSTableSecMetaIterator *meta_iter = nullptr;
-    ObDatumRange query_range;
-    query_range.set_whole_range();
-    if (OB_FAIL(first_major_sstable->scan_secondary_meta(allocator_, query_range,
-        index_read_info, DATA_BLOCK_META, meta_iter))) {
-      STORAGE_LOG(WARN, "Failed to scan secondary meta", KR(ret), KPC(this));
-    }
-    // generate ranges
-    for (int64_t i = 0; OB_SUCC(ret) && i < macro_block_cnt;) {
-      int64_t last = i + macro_block_cnt_per_range - 1;
-      last = (last < macro_block_cnt ? last : macro_block_cnt - 1);
-      // locate to the last macro-block meta in current range
-      while (OB_SUCC(meta_iter->get_next(blk_meta)) && i++ < last);
-      if (OB_FAIL(ret)) {
-        STORAGE_LOG(WARN, "Failed to get macro block meta", KR(ret), K(i - 1));
-      } else if (OB_UNLIKELY(!blk_meta.is_valid())) {
-        ret = OB_ERR_UNEXPECTED;
-        STORAGE_LOG(WARN, "Unexpected invalid macro block meta", KR(ret), K(i - 1));
-      } else if (OB_FAIL(blk_meta.get_rowkey(macro_endkey))) {
-        STORAGE_LOG(WARN, "Failed to get rowkey", KR(ret), K(blk_meta));
-      } else if (OB_FAIL(range.end_key_.deep_copy(range.start_key_, allocator_))) {
-        STORAGE_LOG(WARN, "Failed to deep copy rowkey", KR(ret), K(range.get_end_key()), K(range.get_start_key()));
-      } else if (OB_FAIL(macro_endkey.deep_copy(range.end_key_, allocator_))) {
-        STORAGE_LOG(WARN, "Failed to deep copy rowkey", KR(ret), K(macro_endkey), K(range.get_end_key()), K(range.get_start_key()));
-      } else if (OB_FAIL(range_array_.push_back(range))) {
-        STORAGE_LOG(WARN, "Failed to push range", KR(ret), K(range_array_), K(range));
-      }
-    }
-
-    if (OB_NOT_NULL(meta_iter)) {
-      meta_iter->~ObSSTableSecMetaIterator();
-      allocator_.free(meta_iter);
-    }
-
-    if (OB_FAIL(ret)) {
-    } else if (OB_UNLIKELY(concurrent_cnt_ != range_array_.count())) {
-      ret = OB_ERR_UNEXPECTED;
-      STORAGE_LOG(WARN, "range array size is not equal to concurrent_cnt", K(ret), KPC(this));
-    } else {
-      ObDatumRange &last_range = range_array_.at(range_array_.count() - 1);
-      last_range.end_key_.set_max_rowkey();
-      last_range.set_right_open();
-    }
-  }
-
-  return ret;
-}
-
 }
 }
@@ -52,6 +52,8 @@ public:
   int init(compaction::ObTabletMergeCtx &merge_ctx);
   OB_INLINE int64_t get_concurrent_cnt() const { return concurrent_cnt_; }
   int get_merge_range(const int64_t parallel_idx, blocksstable::ObDatumRange &merge_range);
+  // the row count of the base major sstable in each range, empty if unknown
+  const common::ObIArray<int64_t> &get_range_row_cnts() const { return range_row_cnt_array_; }
   TO_STRING_KV(K_(parallel_type), K_(range_array), K_(concurrent_cnt), K_(is_inited));
 private:
   static const int64_t MIN_PARALLEL_MINI_MINOR_MERGE_THREASHOLD = 2;
@@ -66,18 +68,10 @@ private:
                                       const int64_t total_size,
                                       const int64_t sstable_count,
                                       int64_t &parallel_degree);
-
-  int get_concurrent_cnt(
-      const int64_t tablet_size,
-      const int64_t macro_block_cnt,
-      int64_t &concurrent_cnt);
-  int get_major_parallel_ranges(
-      const blocksstable::ObSSTable *first_major_sstable,
-      const int64_t tablet_size,
-      const ObTableReadInfo &index_read_info);
 private:
   ParallelMergeType parallel_type_;
   common::ObSEArray<blocksstable::ObDatumRange, 16> range_array_;
+  common::ObSEArray<int64_t, 16> range_row_cnt_array_;
   int64_t concurrent_cnt_;
   common::ObArenaAllocator allocator_;
   bool is_inited_;
@@ -28,6 +28,7 @@
 #include "storage/tx_storage/ob_ls_service.h"
 #include "storage/tx_storage/ob_tenant_freezer.h"
 #include "storage/memtable/ob_memtable.h"
+#include "storage/ob_table_store_stat_mgr.h"
 #include "ob_tenant_freeze_info_mgr.h"
 #include "ob_tenant_compaction_progress.h"
 #include "ob_server_compaction_event_history.h"
@@ -108,6 +109,261 @@ int ObFastFreezeChecker::check_hotspot_need_fast_freeze(
   return ret;
 }
 
+OB_INLINE static int64_t cal_read_stat_delta(const int64_t cur, const int64_t last)
+{
+  // the stat node may be evicted and reused in ObTableStoreStatMgr
+  return cur >= last ? cur - last : cur;
+}
+
+void ObReadAmplificationChecker::ObTabletReadStat::add(const ObTableStoreStat &stat)
+{
+  read_cnt_ += stat.single_get_stat_.call_cnt_ + stat.multi_get_stat_.call_cnt_
+      + stat.single_scan_stat_.call_cnt_ + stat.multi_scan_stat_.call_cnt_;
+  output_row_cnt_ += stat.output_row_cnt_;
+  physical_read_cnt_ += stat.physical_read_cnt_;
+  empty_read_cnt_ += stat.get_empty_read_cnt();
+  bf_empty_read_cnt_ += stat.bf_empty_read_cnt_ + stat.sstable_bf_empty_read_cnt_;
+}
+
+void ObReadAmplificationChecker::ObTabletReadStat::delta(
+    const ObTabletReadStat &last,
+    ObTabletReadStat &delta) const
+{
+  delta.read_cnt_ = cal_read_stat_delta(read_cnt_, last.read_cnt_);
+  delta.output_row_cnt_ = cal_read_stat_delta(output_row_cnt_, last.output_row_cnt_);
+  delta.physical_read_cnt_ = cal_read_stat_delta(physical_read_cnt_, last.physical_read_cnt_);
+  delta.empty_read_cnt_ = cal_read_stat_delta(empty_read_cnt_, last.empty_read_cnt_);
+  delta.bf_empty_read_cnt_ = cal_read_stat_delta(bf_empty_read_cnt_, last.bf_empty_read_cnt_);
+}
+
+ObReadAmplificationChecker::ObReadAmplificationChecker()
+  : is_inited_(false),
+    enable_read_aware_(false),
+    has_read_stat_(false),
+    last_refresh_ts_(0),
+    last_stat_map_(),
+    lock_(),
+    read_heat_map_()
+{
+}
+
+ObReadAmplificationChecker::~ObReadAmplificationChecker()
+{
+  destroy();
+}
+
+int ObReadAmplificationChecker::init()
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("ObReadAmplificationChecker has inited", K(ret));
+  } else if (OB_FAIL(last_stat_map_.create(DEFAULT_BUCKET_CNT, "TabletReadStat", "TabletReadStat", MTL_ID()))) {
+    LOG_WARN("failed to create tablet read stat map", K(ret));
+  } else if (OB_FAIL(read_heat_map_.create(DEFAULT_BUCKET_CNT, "TabletReadHeat", "TabletReadHeat", MTL_ID()))) {
+    LOG_WARN("failed to create tablet read heat map", K(ret));
+  } else {
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObReadAmplificationChecker::destroy()
+{
+  SpinWLockGuard guard(lock_);
+  if (last_stat_map_.created()) {
+    last_stat_map_.destroy();
+  }
+  if (read_heat_map_.created()) {
+    read_heat_map_.destroy();
+  }
+  enable_read_aware_ = false;
+  has_read_stat_ = false;
+  last_refresh_ts_ = 0;
+  is_inited_ = false;
+}
+
+void ObReadAmplificationChecker::reload_config(const bool enable_read_aware)
+{
+  enable_read_aware_ = enable_read_aware;
+}
+
+int ObReadAmplificationChecker::refresh_read_stat()
+{
+  int ret = OB_SUCCESS;
+  const int64_t current_time = ObTimeUtility::fast_current_time();
+  const int64_t window_us = current_time - last_refresh_ts_;
+  TabletReadStatMap cur_stat_map;
+  ObSEArray<std::pair<ObTabletID, ObTabletReadHeat>, 64> tablet_heats;
+
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObReadAmplificationChecker has not been inited", K(ret));
+  } else if (!enable_read_aware_) {
+    if (last_refresh_ts_ > 0) {
+      // drop the stale stat, the heat is rebuilt from scratch once the config is turned on again
+      SpinWLockGuard guard(lock_);
+      has_read_stat_ = false;
+      last_refresh_ts_ = 0;
+      last_stat_map_.reuse();
+      read_heat_map_.reuse();
+    }
+  } else if (last_refresh_ts_ > 0 && window_us < MIN_REFRESH_INTERVAL_US) {
+    // keep the read heat of last refresh
+  } else if (OB_FAIL(cur_stat_map.create(DEFAULT_BUCKET_CNT, "TabletReadStat", "TabletReadStat", MTL_ID()))) {
+    LOG_WARN("failed to create tablet read stat map", K(ret));
+  } else if (OB_FAIL(collect_read_stat(cur_stat_map))) {
+    LOG_WARN("failed to collect tablet read stat", K(ret));
+  } else {
+    const bool first_refresh = (0 == last_refresh_ts_);
+    int64_t hot_tablet_cnt = 0;
+    ObTabletReadStat last_stat;
+    ObTabletReadStat delta_stat;
+    if (!first_refresh) {
+      TabletReadStatMap::const_iterator iter = cur_stat_map.begin();
+      for ( ; OB_SUCC(ret) && iter != cur_stat_map.end(); ++iter) {
+        if (OB_FAIL(last_stat_map_.get_refactored(iter->first, last_stat))) {
+          if (OB_HASH_NOT_EXIST == ret) {
+            ret = OB_SUCCESS;
+            last_stat.reset();
+          } else {
+            LOG_WARN("failed to get last tablet read stat", K(ret), "tablet_id", iter->first);
+          }
+        }
+        if (OB_SUCC(ret)) {
+          iter->second.delta(last_stat, delta_stat);
+          const ObTabletReadHeat read_heat = cal_read_heat(delta_stat, window_us);
+          if (OB_FAIL(tablet_heats.push_back(std::make_pair(iter->first, read_heat)))) {
+            LOG_WARN("failed to push back tablet read heat", K(ret));
+          } else if (TABLET_READ_HOT == read_heat) {
+            ++hot_tablet_cnt;
+            LOG_DEBUG("tablet is read hot", "tablet_id", iter->first, K(delta_stat), K(window_us));
+          }
+        }
+      }
+    }
+
+    if (OB_SUCC(ret)) {
+      SpinWLockGuard guard(lock_);
+      read_heat_map_.reuse();
+      for (int64_t i = 0; OB_SUCC(ret) && i < tablet_heats.count(); ++i) {
+        if (OB_FAIL(read_heat_map_.set_refactored(tablet_heats.at(i).first, tablet_heats.at(i).second))) {
+          LOG_WARN("failed to set tablet read heat", K(ret), "tablet_id", tablet_heats.at(i).first);
+        }
+      }
+      // without any stat reported (e.g. diagnose info is disabled), every tablet keeps the default policy
+      has_read_stat_ = OB_SUCC(ret) && !first_refresh && cur_stat_map.size() > 0;
+    }
+
+    if (OB_SUCC(ret)) {
+      last_stat_map_.reuse();
+      TabletReadStatMap::const_iterator iter = cur_stat_map.begin();
+      for ( ; OB_SUCC(ret) && iter != cur_stat_map.end(); ++iter) {
+        if (OB_FAIL(last_stat_map_.set_refactored(iter->first, iter->second))) {
+          LOG_WARN("failed to set last tablet read stat", K(ret), "tablet_id", iter->first);
+        }
+      }
+    }
+
+    if (OB_SUCC(ret)) {
+      last_refresh_ts_ = current_time;
+      LOG_INFO("refresh tablet read heat", "tablet_cnt", cur_stat_map.size(), K(hot_tablet_cnt),
+               K(window_us), K_(has_read_stat));
+    } else {
+      // rebuild from scratch in the next round
+      SpinWLockGuard guard(lock_);
+      has_read_stat_ = false;
+      last_refresh_ts_ = 0;
+      last_stat_map_.reuse();
+      read_heat_map_.reuse();
+    }
+  }
+  return ret;
+}
+
+int ObReadAmplificationChecker::collect_read_stat(TabletReadStatMap &cur_stat_map)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t tenant_id = MTL_ID();
+  ObTableStoreStatIterator stat_iter;
+  ObTableStoreStat stat;
+  ObTabletReadStat tablet_stat;
+  if (OB_FAIL(stat_iter.open())) {
+    LOG_WARN("failed to open table store stat iterator", K(ret));
+  }
+  while (OB_SUCC(ret)) {
+    if (OB_FAIL(stat_iter.get_next_stat(stat))) {
+      if (OB_ITER_END == ret) {
+        ret = OB_SUCCESS;
+        break;
+      } else {
+        LOG_WARN("failed to get next table store stat", K(ret));
+      }
+    } else if (tenant_id != stat.tenant_id_ || !stat.tablet_id_.is_valid()) {
+      // skip other tenants
+    } else {
+      // one tablet may be accessed by several table ids
+      if (OB_FAIL(cur_stat_map.get_refactored(stat.tablet_id_, tablet_stat))) {
+        if (OB_HASH_NOT_EXIST == ret) {
+          ret = OB_SUCCESS;
+          tablet_stat.reset();
+        } else {
+          LOG_WARN("failed to get tablet read stat", K(ret), K(stat));
+        }
+      }
+      if (OB_SUCC(ret)) {
+        tablet_stat.add(stat);
+        if (OB_FAIL(cur_stat_map.set_refactored(stat.tablet_id_, tablet_stat, 1/*overwrite*/))) {
+          LOG_WARN("failed to set tablet read stat", K(ret), K(stat));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+ObTabletReadHeat ObReadAmplificationChecker::cal_read_heat(
+    const ObTabletReadStat &delta,
+    const int64_t window_us) const
+{
+  ObTabletReadHeat read_heat = TABLET_READ_NORMAL;
+  const int64_t window_s = MAX(1, window_us / 1000000L);
+  if (0 == delta.read_cnt_) {
+    read_heat = TABLET_READ_COLD;
+  } else if (delta.read_cnt_ >= READ_HOT_CNT_PER_SECOND * window_s) {
+    const bool read_amplified =
+        delta.physical_read_cnt_ + delta.empty_read_cnt_ >= READ_HOT_AMPLIFICATION * MAX(1, delta.output_row_cnt_)
+        || delta.bf_empty_read_cnt_ >= delta.read_cnt_;
+    if (read_amplified) {
+      read_heat = TABLET_READ_HOT;
+    }
+  }
+  return read_heat;
+}
+
+int ObReadAmplificationChecker::check_tablet_read_heat(
+    const ObTabletID &tablet_id,
+    ObTabletReadHeat &read_heat)
+{
+  int ret = OB_SUCCESS;
+  read_heat = TABLET_READ_NORMAL;
+  if (!need_check()) {
+  } else {
+    SpinRLockGuard guard(lock_);
+    if (!has_read_stat_) {
+    } else if (OB_FAIL(read_heat_map_.get_refactored(tablet_id, read_heat))) {
+      if (OB_HASH_NOT_EXIST == ret) {
+        // not read since last refresh
+        ret = OB_SUCCESS;
+        read_heat = TABLET_READ_COLD;
+      } else {
+        LOG_WARN("failed to get tablet read heat", K(ret), K(tablet_id));
+      }
+    }
+  }
+  return ret;
+}
+
 
 void ObTenantTabletScheduler::MergeLoopTask::runTimerTask()
 {
@@ -147,7 +403,8 @@ ObTenantTabletScheduler::ObTenantTabletScheduler()
    schedule_stats_(),
    merge_loop_task_(),
    sstable_gc_task_(),
-   fast_freeze_checker_()
+   fast_freeze_checker_(),
+   read_amplification_checker_()
 {
   STATIC_ASSERT(static_cast<int64_t>(NO_MAJOR_MERGE_TYPE_CNT) == ARRAYSIZEOF(MERGE_TYPES), "merge type array len is mismatch");
 }
@@ -164,6 +421,7 @@ void ObTenantTabletScheduler::destroy()
   TG_DESTROY(merge_loop_tg_id_);
   TG_DESTROY(sstable_gc_tg_id_);
   bf_queue_.destroy();
+  read_amplification_checker_.destroy();
   frozen_version_ = 0;
   merged_version_ = 0;
   schedule_stats_.reset();
@@ -182,6 +440,7 @@ int ObTenantTabletScheduler::init()
   if (tenant_config.is_valid()) {
     schedule_interval = tenant_config->ob_compaction_schedule_interval;
     fast_freeze_checker_.reload_config(tenant_config->_ob_enable_fast_freeze);
+    read_amplification_checker_.reload_config(tenant_config->_enable_read_aware_minor_compaction);
   }
   if (IS_INIT) {
     ret = OB_INIT_TWICE;
@@ -189,6 +448,8 @@ int ObTenantTabletScheduler::init()
   } else if (FALSE_IT(bf_queue_.set_run_wrapper(MTL_CTX()))) {
   } else if (OB_FAIL(bf_queue_.init(BLOOM_FILTER_LOAD_BUILD_THREAD_CNT, "BFBuildTask"))) {
     LOG_WARN("Fail to init bloom filter queue", K(ret));
+  } else if (OB_FAIL(read_amplification_checker_.init())) {
+    LOG_WARN("Fail to init read amplification checker", K(ret));
   } else {
     schedule_interval_ = schedule_interval;
     bf_queue_.set_label("bf_queue");
@@ -229,6 +490,7 @@ int ObTenantTabletScheduler::reload_tenant_config()
   if (tenant_config.is_valid()) {
     merge_schedule_interval = tenant_config->ob_compaction_schedule_interval;
     fast_freeze_checker_.reload_config(tenant_config->_ob_enable_fast_freeze);
+    read_amplification_checker_.reload_config(tenant_config->_enable_read_aware_minor_compaction);
   }
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
@@ -397,11 +659,17 @@ int ObTenantTabletScheduler::schedule_load_bloomfilter(const blocksstable::Macro
 int ObTenantTabletScheduler::merge_all()
 {
   int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
     LOG_WARN("ObTenantTabletScheduler has not been inited", K(ret));
-  } else if (OB_FAIL(schedule_all_tablets())) {
-    LOG_WARN("failed to schedule all tablet major merge", K(ret));
+  } else {
+    if (OB_TMP_FAIL(read_amplification_checker_.refresh_read_stat())) {
+      LOG_WARN("failed to refresh tablet read stat", K(tmp_ret));
+    }
+    if (OB_FAIL(schedule_all_tablets())) {
+      LOG_WARN("failed to schedule all tablet major merge", K(ret));
+    }
   }
   return ret;
 }
@@ -586,9 +854,20 @@ int ObTenantTabletScheduler::schedule_tablet_minor_merge(const ObLSID ls_id, ObT
   int ret = OB_SUCCESS;
   int tmp_ret = OB_SUCCESS;
   const ObTabletID &tablet_id = tablet.get_tablet_meta().tablet_id_;
+  ObTabletReadHeat read_heat = TABLET_READ_NORMAL;
+  ObReadAmplificationChecker &read_checker = MTL(ObTenantTabletScheduler *)->get_read_amplification_checker();
+  if (read_checker.need_check() && OB_TMP_FAIL(read_checker.check_tablet_read_heat(tablet_id, read_heat))) {
+    LOG_WARN("failed to check tablet read heat", K(tmp_ret), K(ls_id), K(tablet_id));
+    read_heat = TABLET_READ_NORMAL;
+  }
   for (int i = 0; OB_SUCC(ret) && i < NO_MAJOR_MERGE_TYPE_CNT; ++i) {
     bool need_merge = false;
-    if (OB_FAIL(ObPartitionMergePolicy::check_need_minor_merge[MERGE_TYPES[i]](tablet, need_merge))) {
+    if (MINI_MINOR_MERGE == MERGE_TYPES[i] && TABLET_READ_NORMAL != read_heat) {
+      ret = ObPartitionMergePolicy::check_need_read_aware_mini_minor_merge(tablet, read_heat, need_merge);
+    } else {
+      ret = ObPartitionMergePolicy::check_need_minor_merge[MERGE_TYPES[i]](tablet, need_merge);
+    }
+    if (OB_FAIL(ret)) {
       if (OB_NO_NEED_MERGE == ret) {
         ret = OB_SUCCESS;
         LOG_DEBUG("tablet no need merge", K(ret), "merge_type", MERGE_TYPES[i], K(tablet_id), K(tablet));
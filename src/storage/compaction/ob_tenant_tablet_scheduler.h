@@ -15,8 +15,11 @@
 
 #include "lib/task/ob_timer.h"
 #include "lib/queue/ob_dedup_queue.h"
+#include "lib/hash/ob_hashmap.h"
+#include "lib/lock/ob_spin_rwlock.h"
 #include "share/ob_ls_id.h"
 #include "storage/ob_i_store.h"
+#include "storage/compaction/ob_partition_merge_policy.h"
 
 namespace oceanbase
 {
@@ -33,6 +36,7 @@ namespace storage
 class ObLS;
 class ObTablet;
 class ObITable;
+struct ObTableStoreStat;
 
 class ObFastFreezeChecker
 {
@@ -51,6 +55,60 @@ private:
   bool enable_fast_freeze_;
 };
 
+// Classifies the data tablets of the tenant into read-hot and read-cold ones by the table store
+// statistics reported between two refreshes, so that minor merge is scheduled eagerly for
+// read-hot tablets with many deltas and deferred for the tablets which are not read at all.
+class ObReadAmplificationChecker
+{
+public:
+  ObReadAmplificationChecker();
+  virtual ~ObReadAmplificationChecker();
+  int init();
+  void destroy();
+  OB_INLINE bool need_check() const { return is_inited_ && enable_read_aware_; }
+  void reload_config(const bool enable_read_aware);
+  int refresh_read_stat();
+  int check_tablet_read_heat(
+      const common::ObTabletID &tablet_id,
+      compaction::ObTabletReadHeat &read_heat);
+  TO_STRING_KV(K_(is_inited), K_(enable_read_aware), K_(has_read_stat), K_(last_refresh_ts));
+private:
+  struct ObTabletReadStat
+  {
+  public:
+    ObTabletReadStat() { reset(); }
+    ~ObTabletReadStat() = default;
+    OB_INLINE void reset() { MEMSET(this, 0, sizeof(ObTabletReadStat)); }
+    void add(const ObTableStoreStat &stat);
+    void delta(const ObTabletReadStat &last, ObTabletReadStat &delta) const;
+    TO_STRING_KV(K_(read_cnt), K_(output_row_cnt), K_(physical_read_cnt),
+                 K_(empty_read_cnt), K_(bf_empty_read_cnt));
+
+    int64_t read_cnt_; // get and scan calls
+    int64_t output_row_cnt_;
+    int64_t physical_read_cnt_; // rows read from sstables, including multi version rows
+    int64_t empty_read_cnt_; // sstables probed without the target row
+    int64_t bf_empty_read_cnt_; // bloom filter passed but the row does not exist
+  };
+  typedef common::hash::ObHashMap<common::ObTabletID, ObTabletReadStat> TabletReadStatMap;
+  typedef common::hash::ObHashMap<common::ObTabletID, compaction::ObTabletReadHeat> TabletReadHeatMap;
+
+  int collect_read_stat(TabletReadStatMap &cur_stat_map);
+  compaction::ObTabletReadHeat cal_read_heat(const ObTabletReadStat &delta, const int64_t window_us) const;
+private:
+  static const int64_t DEFAULT_BUCKET_CNT = 1024;
+  static const int64_t MIN_REFRESH_INTERVAL_US = 10 * 1000 * 1000L; // 10s
+  static const int64_t READ_HOT_CNT_PER_SECOND = 100;
+  static const int64_t READ_HOT_AMPLIFICATION = 3; // sstable rows probed for each output row
+  bool is_inited_;
+  bool enable_read_aware_;
+  bool has_read_stat_; // no heat is reported until two refreshes succeeded
+  int64_t last_refresh_ts_;
+  TabletReadStatMap last_stat_map_; // accumulated stat of last refresh, only used by refresh thread
+  common::SpinRWLock lock_; // protect read_heat_map_
+  TabletReadHeatMap read_heat_map_; // tablets absent from the map are not read since last refresh
+};
+
 class ObTenantTabletScheduler
 {
 public:
@@ -138,6 +196,7 @@ public:
       ObLS &ls);
 
   int get_min_dependent_schema_version(int64_t &min_schema_version);
+  OB_INLINE ObReadAmplificationChecker &get_read_amplification_checker() { return read_amplification_checker_; }
 
 private:
   int schedule_all_tablets();
@@ -202,6 +261,7 @@ private:
   MergeLoopTask merge_loop_task_;
   SSTableGCTask sstable_gc_task_;
   ObFastFreezeChecker fast_freeze_checker_;
+  ObReadAmplificationChecker read_amplification_checker_;
 };
 
 } // namespace storage
@@ -13,6 +13,7 @@
 #include "ob_mvcc_row.h"
 #include "common/ob_tablet_id.h"
 #include "lib/ob_errno.h"
+#include "lib/hash_func/murmur_hash.h"
 #include "ob_mvcc_ctx.h"
 #include "storage/ob_i_store.h"
 #include "storage/memtable/ob_memtable_data.h"
@@ -880,14 +881,140 @@ int ObMvccRow::wakeup_waiter(const ObTabletID &tablet_id,
   return ret;
 }
 
+ObMvccWriteCombiner &ObMvccWriteCombiner::get_instance()
+{
+  static ObMvccWriteCombiner instance;
+  return instance;
+}
+
+ObMvccWriteCombiner::Slot &ObMvccWriteCombiner::get_slot_(const ObMvccRow &row)
+{
+  const ObMvccRow *addr = &row;
+  return slots_[murmurhash64A(&addr, sizeof(addr), 0) % SLOT_COUNT];
+}
+
+void ObMvccWriteCombiner::push_(Slot &slot, ObMvccWriteRequest *first, ObMvccWriteRequest *last)
+{
+  ObMvccWriteRequest *head = NULL;
+  do {
+    head = ATOMIC_LOAD(&slot.head_);
+    last->next_ = head;
+  } while (!ATOMIC_BCAS(&slot.head_, head, first));
+}
+
+void ObMvccWriteCombiner::publish(ObMvccWriteRequest &req)
+{
+  push_(get_slot_(req.row_), &req, &req);
+}
+
+int64_t ObMvccWriteCombiner::combine(ObMvccRow &row)
+{
+  int64_t combined_cnt = 0;
+  Slot &slot = get_slot_(row);
+  ObMvccWriteRequest *head = NULL;
+  if (NULL != ATOMIC_LOAD(&slot.head_)
+      && NULL != (head = ATOMIC_SET(&slot.head_, NULL))) {
+    // the published writes are stacked, reverse them to write in arrival order
+    ObMvccWriteRequest *req = NULL;
+    while (NULL != head) {
+      ObMvccWriteRequest *next = head->next_;
+      head->next_ = req;
+      req = head;
+      head = next;
+    }
+    // the writes of the other rows in the same slot are published again for
+    // their own latch holders
+    ObMvccWriteRequest *others_first = NULL;
+    ObMvccWriteRequest *others_last = NULL;
+    ObCurTraceId::TraceId saved_trace_id;
+    if (NULL != ObCurTraceId::get_trace_id()) {
+      saved_trace_id = *ObCurTraceId::get_trace_id();
+    }
+    while (NULL != req) {
+      // the request is released by its writer once done_ is set
+      ObMvccWriteRequest *next = req->next_;
+      if (&req->row_ != &row) {
+        req->next_ = NULL;
+        if (NULL == others_last) {
+          others_first = req;
+        } else {
+          others_last->next_ = req;
+        }
+        others_last = req;
+      } else {
+        // the rows of a memtable belong to one tenant, so only the trace is
+        // switched to the writer's one
+        ObCurTraceId::set(req->trace_id_);
+        req->ret_ = row.mvcc_write_with_latch_(req->ctx_,
+                                               req->node_,
+                                               req->snapshot_version_,
+                                               req->res_);
+        ++combined_cnt;
+        ATOMIC_STORE_REL(&req->done_, true);
+      }
+      req = next;
+    }
+    ObCurTraceId::set(saved_trace_id);
+    if (NULL != others_first) {
+      push_(slot, others_first, others_last);
+    }
+  }
+  return combined_cnt;
+}
+
+/*
+ * mvcc_write_ - write the node into the row under the row latch
+ *
+ * The uncontended writer takes the latch and writes directly. When the latch
+ * is busy the row is hot, so the writer publishes its write to the combiner
+ * and whoever holds the latch in mvcc_write_ executes all the published writes
+ * of the row before releasing it. The writer keeps trying the latch while
+ * spinning, so its write is not left behind when the latch is released by
+ * other operations, and it blocks on the latch after spinning for a while.
+ * Once it gets the latch it executes the published writes itself.
+ */
 int ObMvccRow::mvcc_write_(ObIMemtableCtx &ctx,
                            ObMvccTransNode &writer_node,
                            const int64_t snapshot_version,
                            ObMvccWriteResult &res)
 {
   int ret = OB_SUCCESS;
+  ObMvccWriteCombiner &combiner = ObMvccWriteCombiner::get_instance();
+
+  if (latch_.try_lock()) {
+    ret = mvcc_write_with_latch_(ctx, writer_node, snapshot_version, res);
+    (void)combiner.combine(*this);
+    latch_.unlock();
+  } else {
+    ObMvccWriteRequest req(*this, ctx, writer_node, snapshot_version, res);
+    combiner.publish(req);
+    for (int64_t spin_cnt = 1; !ATOMIC_LOAD_ACQ(&req.done_); ++spin_cnt) {
+      if (!latch_.is_locked() && latch_.try_lock()) {
+        (void)combiner.combine(*this);
+        latch_.unlock();
+      } else if (spin_cnt >= COMBINE_WRITE_SPIN_COUNT) {
+        latch_.lock();
+        (void)combiner.combine(*this);
+        latch_.unlock();
+      } else if (0 == spin_cnt % COMBINE_WRITE_YIELD_COUNT) {
+        sched_yield();
+      } else {
+        PAUSE();
+      }
+    }
+    ret = req.ret_;
+  }
+
+  return ret;
+}
+
+int ObMvccRow::mvcc_write_with_latch_(ObIMemtableCtx &ctx,
+                                      ObMvccTransNode &writer_node,
+                                      const int64_t snapshot_version,
+                                      ObMvccWriteResult &res)
+{
+  int ret = OB_SUCCESS;
 
-  ObRowLatchGuard guard(latch_);
   ObMvccTransNode *iter = ATOMIC_LOAD(&list_head_);
   ObTxTableGuard *tx_table_guard = ctx.get_tx_table_guard();
   ObTxTable *tx_table = tx_table_guard->get_tx_table();
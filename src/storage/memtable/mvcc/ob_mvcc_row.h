@@ -18,6 +18,7 @@
 #include "lib/checksum/ob_crc64.h"
 #include "lib/queue/ob_link.h"
 #include "lib/lock/ob_latch.h"
+#include "lib/profile/ob_trace_id.h"
 #include "storage/ob_i_store.h"
 #include "ob_row_latch.h"
 #include "storage/memtable/ob_memtable_data.h"
@@ -146,6 +147,71 @@ private:
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+struct ObMvccRow;
+
+// ObMvccWriteRequest is the mvcc_write published by a writer who failed to get
+// the row latch on a hot row. The latch holder executes the published requests
+// of its row within its latch hold(flat combining), so the row latch is not
+// handed over between threads for every write.
+struct ObMvccWriteRequest
+{
+  ObMvccWriteRequest(ObMvccRow &row,
+                     ObIMemtableCtx &ctx,
+                     ObMvccTransNode &node,
+                     const int64_t snapshot_version,
+                     ObMvccWriteResult &res)
+    : row_(row),
+    ctx_(ctx),
+    node_(node),
+    snapshot_version_(snapshot_version),
+    res_(res),
+    trace_id_(),
+    next_(NULL),
+    ret_(common::OB_SUCCESS),
+    done_(false)
+  {
+    if (NULL != common::ObCurTraceId::get_trace_id()) {
+      trace_id_ = *common::ObCurTraceId::get_trace_id();
+    }
+  }
+  ObMvccRow &row_;
+  ObIMemtableCtx &ctx_;
+  ObMvccTransNode &node_;
+  const int64_t snapshot_version_;
+  ObMvccWriteResult &res_;
+  // the write is logged with the trace of its writer even if it is combined
+  common::ObCurTraceId::TraceId trace_id_;
+  ObMvccWriteRequest *next_;
+  int ret_;
+  bool done_;
+};
+
+// ObMvccWriteCombiner keeps the published writes of all the rows in stacks
+// striped by the row address, so that ObMvccRow does not grow for them.
+class ObMvccWriteCombiner
+{
+public:
+  static const int64_t SLOT_COUNT = 1024;
+  static ObMvccWriteCombiner &get_instance();
+  void publish(ObMvccWriteRequest &req);
+  // execute the published writes of the row and return the number of them,
+  // the row latch must be held by the caller
+  int64_t combine(ObMvccRow &row);
+private:
+  struct Slot
+  {
+    Slot() : head_(NULL) {}
+    ObMvccWriteRequest *head_;
+  } CACHE_ALIGNED;
+  ObMvccWriteCombiner() {}
+  Slot &get_slot_(const ObMvccRow &row);
+  void push_(Slot &slot, ObMvccWriteRequest *first, ObMvccWriteRequest *last);
+  Slot slots_[SLOT_COUNT];
+  DISALLOW_COPY_AND_ASSIGN(ObMvccWriteCombiner);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 // ObMvccRow is the row contains all multi-version tx node for the specified
 // key, and all tx node is bidirectional linked and ordered with newest to
 // oldest.
@@ -182,6 +248,11 @@ struct ObMvccRow
   //when the number of nodes visited before finding the right insert position exceeds INDEX_TRIGGER_LENGTH,
   //index will be constructed and used
   static const int64_t INDEX_TRIGGER_COUNT = 500;
+  // the writer whose write is published to the combiner yields cpu after
+  // spinning COMBINE_WRITE_YIELD_COUNT times, and blocks on the row latch after
+  // spinning COMBINE_WRITE_SPIN_COUNT times
+  static const int64_t COMBINE_WRITE_YIELD_COUNT = 128;
+  static const int64_t COMBINE_WRITE_SPIN_COUNT = 4096;
 
   // Spin lock that protects row data.
   ObRowLatch latch_;
@@ -336,6 +407,11 @@ struct ObMvccRow
                   ObMvccTransNode &node,
                   const int64_t snapshot_version,
                   ObMvccWriteResult &res);
+  // the row latch must be held by the caller
+  int mvcc_write_with_latch_(ObIMemtableCtx &ctx,
+                             ObMvccTransNode &node,
+                             const int64_t snapshot_version,
+                             ObMvccWriteResult &res);
 
   // ===================== ObMvccRow Protection Code =====================
   // check double insert
@@ -1392,10 +1392,18 @@ int ObPartitionMajorSSTableRangeSpliter::scan_major_sstable_secondary_meta(
 }
 
 int ObPartitionMajorSSTableRangeSpliter::split_ranges(ObIArray<ObStoreRange> &result_ranges)
+{
+  ObSEArray<int64_t, 64> range_row_cnts;
+  return split_ranges(result_ranges, range_row_cnts);
+}
+
+int ObPartitionMajorSSTableRangeSpliter::split_ranges(ObIArray<ObStoreRange> &result_ranges,
+                                                      ObIArray<int64_t> &range_row_cnts)
 {
   int ret = OB_SUCCESS;
   int64_t parallel_degree = 0;
   result_ranges.reset();
+  range_row_cnts.reset();
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
     STORAGE_LOG(WARN, "ObPartitionMajorSSTableRangeSpliter not init", KR(ret));
@@ -1418,9 +1426,11 @@ int ObPartitionMajorSSTableRangeSpliter::split_ranges(ObIArray<ObStoreRange> &re
       whole_range.set_whole_range();
       if (OB_FAIL(result_ranges.push_back(whole_range))) {
         STORAGE_LOG(WARN, "failed to push back merge range to array", KR(ret), K(whole_range));
+      } else if (OB_FAIL(range_row_cnts.push_back(major_sstable_->get_meta().get_basic_meta().row_count_))) {
+        STORAGE_LOG(WARN, "failed to push back range row count", KR(ret));
       }
     } else {
-      if (OB_FAIL(generate_ranges_by_macro_block(parallel_degree, result_ranges))) {
+      if (OB_FAIL(generate_ranges_by_macro_block(parallel_degree, result_ranges, range_row_cnts))) {
         STORAGE_LOG(WARN, "failed to generate ranges by macro block", KR(ret), K(parallel_degree));
       }
     }
@@ -1429,21 +1439,64 @@ int ObPartitionMajorSSTableRangeSpliter::split_ranges(ObIArray<ObStoreRange> &re
   return ret;
 }
 
+int64_t ObPartitionMajorSSTableRangeSpliter::get_macro_block_weight(
+  const ObDataMacroBlockMeta &blk_meta) const
+{
+  return MAX(1, blk_meta.val_.occupy_size_ + blk_meta.val_.row_count_ * ROW_WEIGHT_IN_BYTES);
+}
+
+int ObPartitionMajorSSTableRangeSpliter::get_macro_block_weights(
+  ObIArray<int64_t> &weights, int64_t &total_weight)
+{
+  int ret = OB_SUCCESS;
+  ObDataMacroBlockMeta blk_meta;
+  ObSSTableSecMetaIterator *meta_iter = nullptr;
+  ObDatumRange scan_range;
+  scan_range.set_whole_range();
+  weights.reset();
+  total_weight = 0;
+  if (OB_FAIL(scan_major_sstable_secondary_meta(scan_range, meta_iter))) {
+    STORAGE_LOG(WARN, "Failed to scan secondary meta", KR(ret), K(*major_sstable_));
+  }
+  while (OB_SUCC(ret) && OB_SUCC(meta_iter->get_next(blk_meta))) {
+    const int64_t weight = get_macro_block_weight(blk_meta);
+    if (OB_FAIL(weights.push_back(weight))) {
+      STORAGE_LOG(WARN, "Failed to push macro block weight", KR(ret), K(weight));
+    } else {
+      total_weight += weight;
+    }
+  }
+  if (OB_ITER_END == ret) {
+    ret = OB_SUCCESS;
+  } else if (OB_FAIL(ret)) {
+    STORAGE_LOG(WARN, "Failed to get macro block meta", KR(ret), "macro_block_count", weights.count());
+  }
+  if (OB_NOT_NULL(meta_iter)) {
+    meta_iter->~ObSSTableSecMetaIterator();
+    meta_iter = nullptr;
+  }
+  return ret;
+}
+
 int ObPartitionMajorSSTableRangeSpliter::generate_ranges_by_macro_block(
-  int64_t parallel_degree, ObIArray<ObStoreRange> &result_ranges)
+  int64_t parallel_degree, ObIArray<ObStoreRange> &result_ranges, ObIArray<int64_t> &range_row_cnts)
 {
   int ret = OB_SUCCESS;
   const ObIArray<share::schema::ObColDesc> &col_descs = index_read_info_->get_columns_desc();
-  const int64_t macro_block_count =
-    major_sstable_->get_meta().get_basic_meta().data_macro_block_count_;
-  const int64_t macro_block_cnt_per_range =
-    (macro_block_count + parallel_degree - 1) / parallel_degree;
+  ObSEArray<int64_t, 64> weights;
+  int64_t macro_block_count = 0;
+  int64_t remain_weight = 0;
 
   ObDataMacroBlockMeta blk_meta;
   ObSSTableSecMetaIterator *meta_iter = nullptr;
   ObDatumRange scan_range;
   scan_range.set_whole_range();
-  if (OB_FAIL(scan_major_sstable_secondary_meta(scan_range, meta_iter))) {
+  // the macro blocks differ a lot in size and row count, so the range boundaries are
+  // chosen by the accumulated weight of the macro blocks instead of the macro block count
+  if (OB_FAIL(get_macro_block_weights(weights, remain_weight))) {
+    STORAGE_LOG(WARN, "Failed to get macro block weights", KR(ret), K(*major_sstable_));
+  } else if (FALSE_IT(macro_block_count = weights.count())) {
+  } else if (OB_FAIL(scan_major_sstable_secondary_meta(scan_range, meta_iter))) {
     STORAGE_LOG(WARN, "Failed to scan secondary meta", KR(ret), K(*major_sstable_));
   }
 
@@ -1453,29 +1506,60 @@ int ObPartitionMajorSSTableRangeSpliter::generate_ranges_by_macro_block(
   range.get_end_key().set_min();
   range.set_left_open();
   range.set_right_closed();
-  for (int64_t i = 0; OB_SUCC(ret) && i < macro_block_count;) {
-    const int64_t last = i + macro_block_cnt_per_range - 1; // last macro block idx in current range
-    range.get_start_key() = range.get_end_key();
-    if (last < macro_block_count - 1) {
-      // locate to the last macro-block meta in current range
-      while (OB_SUCC(meta_iter->get_next(blk_meta)) && i++ < last);
-      if (OB_FAIL(ret)) {
-        STORAGE_LOG(WARN, "Failed to get macro block meta", KR(ret), K(i - 1));
-      } else if (OB_UNLIKELY(!blk_meta.is_valid())) {
-        ret = OB_ERR_UNEXPECTED;
-        STORAGE_LOG(WARN, "Unexpected invalid macro block meta", KR(ret), K(i - 1));
+  int64_t range_weight = 0;
+  int64_t range_row_cnt = 0;
+  int64_t target_weight = 0;
+  for (int64_t i = 0; OB_SUCC(ret) && i < macro_block_count; ++i) {
+    if (OB_FAIL(meta_iter->get_next(blk_meta))) {
+      STORAGE_LOG(WARN, "Failed to get macro block meta", KR(ret), K(i));
+    } else if (OB_UNLIKELY(!blk_meta.is_valid())) {
+      ret = OB_ERR_UNEXPECTED;
+      STORAGE_LOG(WARN, "Unexpected invalid macro block meta", KR(ret), K(i));
+    } else {
+      if (0 == range_weight) {
+        // the target is evened out over the ranges left, so that a heavy macro block does
+        // not leave the last ranges starved or overloaded
+        const int64_t remain_range_cnt = parallel_degree - result_ranges.count();
+        target_weight = MAX(1, (remain_weight + remain_range_cnt - 1) / remain_range_cnt);
+      }
+      range_weight += weights.at(i);
+      range_row_cnt += blk_meta.val_.row_count_;
+      if (i < macro_block_count - 1 && result_ranges.count() >= parallel_degree - 1) {
+        // the rest macro blocks make up the last range
+        continue;
+      } else if (i == macro_block_count - 1) { // last range
+        range.get_start_key() = range.get_end_key();
+        range.get_end_key().set_max();
+        range.set_right_open();
+      } else if (range_weight < target_weight
+                 && range_weight + weights.at(i + 1) - target_weight <= target_weight - range_weight) {
+        // cut before the next macro block only if that is closer to the target
+        continue;
+      } else if (FALSE_IT(range.get_start_key() = range.get_end_key())) {
       } else if (OB_FAIL(blk_meta.get_rowkey(endkey))) {
         STORAGE_LOG(WARN, "Failed to get rowkey", KR(ret), K(blk_meta));
       } else if (OB_FAIL(endkey.to_store_rowkey(col_descs, *allocator_, range.get_end_key()))) {
         STORAGE_LOG(WARN, "Failed to transfer store rowkey", K(ret), K(endkey));
       }
-    } else { // last range
-      i = last + 1;
-      range.get_end_key().set_max();
-      range.set_right_open();
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(result_ranges.push_back(range))) {
+        STORAGE_LOG(WARN, "Failed to push range", KR(ret), K(result_ranges), K(range));
+      } else if (OB_FAIL(range_row_cnts.push_back(range_row_cnt))) {
+        STORAGE_LOG(WARN, "Failed to push range row count", KR(ret), K(range_row_cnt));
+      } else {
+        remain_weight -= range_weight;
+        range_weight = 0;
+        range_row_cnt = 0;
+      }
     }
-    if (OB_SUCC(ret) && OB_FAIL(result_ranges.push_back(range))) {
-      STORAGE_LOG(WARN, "Failed to push range", KR(ret), K(result_ranges), K(range));
+  }
+  if (OB_SUCC(ret) && OB_UNLIKELY(result_ranges.empty())) {
+    ObStoreRange whole_range;
+    whole_range.set_whole_range();
+    if (OB_FAIL(result_ranges.push_back(whole_range))) {
+      STORAGE_LOG(WARN, "failed to push back merge range to array", KR(ret), K(whole_range));
+    } else if (OB_FAIL(range_row_cnts.push_back(0))) {
+      STORAGE_LOG(WARN, "failed to push back range row count", KR(ret));
     }
   }
 
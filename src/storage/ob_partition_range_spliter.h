@@ -277,11 +277,19 @@ public:
   int init(const ObTableReadInfo &index_read_info, blocksstable::ObSSTable *major_sstable,
            int64_t tablet_size, common::ObIAllocator &allocator);
   int split_ranges(common::ObIArray<ObStoreRange> &ranges);
+  // range_row_cnts returns the row count of the major sstable in each range
+  int split_ranges(common::ObIArray<ObStoreRange> &ranges,
+                   common::ObIArray<int64_t> &range_row_cnts);
 private:
+  // fusing and re-encoding one row costs about as much as merging this many bytes
+  static const int64_t ROW_WEIGHT_IN_BYTES = 64;
   virtual int scan_major_sstable_secondary_meta(const blocksstable::ObDatumRange &scan_range,
                                                 blocksstable::ObSSTableSecMetaIterator *&meta_iter);
+  int64_t get_macro_block_weight(const blocksstable::ObDataMacroBlockMeta &blk_meta) const;
+  int get_macro_block_weights(common::ObIArray<int64_t> &weights, int64_t &total_weight);
   int generate_ranges_by_macro_block(int64_t parallel_degree,
-                                     common::ObIArray<ObStoreRange> &ranges);
+                                     common::ObIArray<ObStoreRange> &ranges,
+                                     common::ObIArray<int64_t> &range_row_cnts);
 private:
   blocksstable::ObSSTable *major_sstable_;
   const storage::ObTableReadInfo *index_read_info_;
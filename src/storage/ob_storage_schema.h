@@ -132,6 +132,11 @@ public:
   //TODO @lixia use compact mode in storage schema to compaction
   inline bool is_oracle_mode() const { return compat_mode_ == static_cast<uint32_t>(lib::Worker::CompatMode::ORACLE); }
   inline lib::Worker::CompatMode get_compat_mode() const { return static_cast<lib::Worker::CompatMode>(compat_mode_);}
+  virtual inline int check_if_oracle_compat_mode(bool &is_oracle) const override
+  {
+    is_oracle = is_oracle_mode();
+    return common::OB_SUCCESS;
+  }
   /* merge related function*/
   virtual inline int64_t get_tablet_size() const override { return tablet_size_; }
   virtual inline int64_t get_rowkey_column_num() const override { return rowkey_array_.count(); }
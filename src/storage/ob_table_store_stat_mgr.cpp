@@ -92,10 +92,12 @@ void ObTableStoreStat::reset()
 
 void ObTableStoreStat::reuse()
 {
+  uint64_t tenant_id = tenant_id_;
   share::ObLSID ls_id = ls_id_;
   common::ObTabletID tablet_id = tablet_id_;
   common::ObTableID table_id = table_id_;
   MEMSET(this, 0, sizeof(ObTableStoreStat));
+  tenant_id_ = tenant_id;
   ls_id_ = ls_id;
   tablet_id_ = tablet_id;
   table_id_ = table_id;
@@ -129,7 +131,7 @@ int ObTableStoreStat::add(const ObTableStoreStat& other)
   } else if (!other.is_valid()) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("other is invalid", K(ret), K(other));
-  } else if (other.ls_id_ != ls_id_ || other.tablet_id_ != tablet_id_ || other.table_id_ != table_id_) {
+  } else if (other.tenant_id_ != tenant_id_ || other.ls_id_ != ls_id_ || other.tablet_id_ != tablet_id_ || other.table_id_ != table_id_) {
     ret = OB_NOT_THE_OBJECT;
     LOG_WARN("not the same table store", K(ret), K(other));
   } else {
@@ -434,7 +436,7 @@ int ObTableStoreStatMgr::add_stat(const ObTableStoreStat &stat)
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid stat", K(ret), K(stat));
   } else {
-    ObTableStoreStatKey key(stat.table_id_, stat.tablet_id_);
+    ObTableStoreStatKey key(stat.tenant_id_, stat.table_id_, stat.tablet_id_);
     ObTableStoreStatNode *node = NULL;
 
     SpinWLockGuard guard(lock_);
@@ -451,6 +453,7 @@ int ObTableStoreStatMgr::add_stat(const ObTableStoreStat &stat)
             LOG_WARN("LRU tail is NULL", K(ret), K(stat), K(cur_cnt_));
           } else {
             ObTableStoreStatKey old_key(
+                lru_tail_->stat_->tenant_id_,
                 lru_tail_->stat_->table_id_,
                 lru_tail_->stat_->tablet_id_);
             if (OB_FAIL(quick_map_.erase_refactored(old_key))) {
@@ -465,6 +468,7 @@ int ObTableStoreStatMgr::add_stat(const ObTableStoreStat &stat)
           if (NULL == node) {
             LOG_WARN("node is NULL", K(ret), K(stat));
           } else {
+            node->stat_->tenant_id_ = stat.tenant_id_;
             node->stat_->ls_id_ = stat.ls_id_;
             node->stat_->tablet_id_ = stat.tablet_id_;
             node->stat_->table_id_ = stat.table_id_;
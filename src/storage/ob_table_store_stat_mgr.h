@@ -100,7 +100,7 @@ public:
   {
     return exist_row_.empty_read_cnt_ + get_row_.empty_read_cnt_ + scan_row_.empty_read_cnt_;
   }
-  TO_STRING_KV(K_(ls_id), K_(tablet_id), K_(table_id),
+  TO_STRING_KV(K_(tenant_id), K_(ls_id), K_(tablet_id), K_(table_id),
                K_(row_cache_hit_cnt), K_(row_cache_miss_cnt), K_(row_cache_put_cnt),
                K_(bf_filter_cnt), K_(bf_empty_read_cnt), K_(bf_access_cnt),
                K_(block_cache_hit_cnt), K_(block_cache_miss_cnt),
@@ -115,6 +115,7 @@ public:
                K_(sstable_bf_access_cnt), K_(rowkey_prefix),
                K_(logical_read_cnt), K_(physical_read_cnt));
 
+  uint64_t tenant_id_;
   share::ObLSID ls_id_;
   common::ObTabletID tablet_id_;
   common::ObTableID table_id_;
@@ -157,25 +158,29 @@ public:
 struct ObTableStoreStatKey
 {
 public:
-  ObTableStoreStatKey() : table_id_(common::OB_INVALID_ID), tablet_id_(common::OB_INVALID_ID) {}
-  ObTableStoreStatKey(const ObTableID table_id, const ObTabletID tablet_id) : table_id_(table_id), tablet_id_(tablet_id) {}
+  ObTableStoreStatKey()
+    : tenant_id_(common::OB_INVALID_TENANT_ID), table_id_(common::OB_INVALID_ID), tablet_id_(common::OB_INVALID_ID) {}
+  ObTableStoreStatKey(const uint64_t tenant_id, const ObTableID table_id, const ObTabletID tablet_id)
+    : tenant_id_(tenant_id), table_id_(table_id), tablet_id_(tablet_id) {}
   ~ObTableStoreStatKey() {}
   OB_INLINE uint64_t hash() const
   {
     uint64_t hash_ret = 0;
-    hash_ret = common::murmurhash(&table_id_, sizeof(ObTableID), 0);
+    hash_ret = common::murmurhash(&tenant_id_, sizeof(tenant_id_), 0);
+    hash_ret = common::murmurhash(&table_id_, sizeof(ObTableID), hash_ret);
     hash_ret = common::murmurhash(&tablet_id_, sizeof(ObTabletID), hash_ret);
     return hash_ret;
   }
   OB_INLINE bool operator ==(const ObTableStoreStatKey &other) const
   {
-    return (table_id_ == other.table_id_) && (tablet_id_ == other.tablet_id_);
+    return (tenant_id_ == other.tenant_id_) && (table_id_ == other.table_id_) && (tablet_id_ == other.tablet_id_);
   }
   OB_INLINE bool operator !=(const ObTableStoreStatKey &other) const
   {
     return (*this == other);
   }
-  TO_STRING_KV(K_(table_id), K_(tablet_id));
+  TO_STRING_KV(K_(tenant_id), K_(table_id), K_(tablet_id));
+  uint64_t tenant_id_;
   common::ObTableID table_id_;
   common::ObTabletID tablet_id_;
 };
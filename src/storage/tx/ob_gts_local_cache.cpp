@@ -164,6 +164,32 @@ int ObGTSLocalCache::update_latest_srr(const MonotonicTs latest_srr)
   return ret;
 }
 
+int ObGTSLocalCache::try_update_latest_srr(const MonotonicTs stc,
+                                           const MonotonicTs latest_srr,
+                                           bool &updated)
+{
+  int ret = OB_SUCCESS;
+  updated = false;
+
+  if (OB_UNLIKELY(!stc.is_valid()) || OB_UNLIKELY(!latest_srr.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument", KR(ret), K(stc), K(latest_srr));
+  } else {
+    int64_t cur_srr = ATOMIC_LOAD(&latest_srr_.mts_);
+    // stop as soon as another thread has sent a request which covers stc
+    while (!updated && cur_srr < stc.mts_ && cur_srr < latest_srr.mts_) {
+      const int64_t old_srr = ATOMIC_VCAS(&latest_srr_.mts_, cur_srr, latest_srr.mts_);
+      if (old_srr == cur_srr) {
+        updated = true;
+      } else {
+        cur_srr = old_srr;
+      }
+    }
+  }
+
+  return ret;
+}
+
 int ObGTSLocalCache::update_base_ts(const int64_t base_ts)
 {
   int ret = OB_SUCCESS;
@@ -46,6 +46,9 @@ public:
   int get_gts(const MonotonicTs stc, int64_t &gts, MonotonicTs &receive_gts_ts, bool &need_send_rpc) const;
   int get_srr_and_gts_safe(MonotonicTs &srr, int64_t &gts, MonotonicTs &receive_gts_ts) const;
   int update_latest_srr(const MonotonicTs latest_srr);
+  // Advance latest_srr to latest_srr only if no request sent at or after stc has been issued,
+  // otherwise the caller can wait for the response of that request instead of sending another.
+  int try_update_latest_srr(const MonotonicTs stc, const MonotonicTs latest_srr, bool &updated);
   int update_base_ts(const int64_t base_ts);
 
   TO_STRING_KV(K_(srr), K_(gts), K_(barrier_ts), K_(latest_srr));
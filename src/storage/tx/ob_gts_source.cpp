@@ -35,6 +35,7 @@ void ObGtsStatistics::reset()
   tenant_id_ = 0;
   last_stat_ts_ = 0;
   gts_rpc_cnt_ = 0;
+  gts_rpc_coalesced_cnt_ = 0;
   get_gts_cache_cnt_ = 0;
   get_gts_with_stc_cnt_ = 0;
   try_get_gts_cache_cnt_ = 0;
@@ -62,6 +63,7 @@ void ObGtsStatistics::statistics()
       TRANS_LOG(INFO, "gts statistics",
                       K_(tenant_id),
                       "gts_rpc_cnt", ATOMIC_LOAD(&gts_rpc_cnt_),
+                      "gts_rpc_coalesced_cnt", ATOMIC_LOAD(&gts_rpc_coalesced_cnt_),
                       "get_gts_cache_cnt", ATOMIC_LOAD(&get_gts_cache_cnt_),
                       "get_gts_with_stc_cnt", ATOMIC_LOAD(&get_gts_with_stc_cnt_),
                       "try_get_gts_cache_cnt", ATOMIC_LOAD(&try_get_gts_cache_cnt_),
@@ -69,6 +71,7 @@ void ObGtsStatistics::statistics()
                       "wait_gts_elapse_cnt", ATOMIC_LOAD(&wait_gts_elapse_cnt_),
                       "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_));
       ATOMIC_STORE(&gts_rpc_cnt_, 0);
+      ATOMIC_STORE(&gts_rpc_coalesced_cnt_, 0);
       ATOMIC_STORE(&get_gts_cache_cnt_, 0);
       ATOMIC_STORE(&get_gts_with_stc_cnt_, 0);
       ATOMIC_STORE(&try_get_gts_cache_cnt_, 0);
@@ -245,7 +248,7 @@ int ObGtsSource::get_gts(const MonotonicTs stc,
     } else {
       // If not in local, refresh gts
       if (need_send_rpc) {
-        if (OB_SUCCESS != (tmp_ret = query_gts_(leader))) {
+        if (OB_SUCCESS != (tmp_ret = query_gts_(leader, stc))) {
           TRANS_LOG(WARN, "query gts fail", K(tmp_ret), K(leader));
         }
       }
@@ -592,13 +595,25 @@ int ObGtsSource::get_gts_leader_(ObAddr &leader)
 }
 
 int ObGtsSource::query_gts_(const ObAddr &leader)
+{
+  return query_gts_(leader, MonotonicTs::current_time());
+}
+
+// Many transactions miss the gts cache at the same time, all of them see that no request covers
+// their stc and try to send one. Only the one which advances latest_srr sends the request, the
+// others wait in the task queue for its response, because its srr is not less than their stc.
+int ObGtsSource::query_gts_(const ObAddr &leader, const MonotonicTs stc)
 {
   int ret = OB_SUCCESS;
   ObGtsRequest msg;
   const int64_t ts_range_size = 1;
   const MonotonicTs srr = MonotonicTs::current_time();
-  if (OB_FAIL(gts_local_cache_.update_latest_srr(srr))) {
-    TRANS_LOG(WARN, "update latest srr error", KR(ret), K_(tenant_id), K(srr));
+  bool need_send = false;
+  if (OB_FAIL(gts_local_cache_.try_update_latest_srr(stc, srr, need_send))) {
+    TRANS_LOG(WARN, "update latest srr error", KR(ret), K_(tenant_id), K(stc), K(srr));
+  } else if (!need_send) {
+    gts_statistics_.inc_gts_rpc_coalesced_cnt();
+    TRANS_LOG(DEBUG, "gts request coalesced", K(stc), K(srr), K_(gts_local_cache));
   } else if (OB_FAIL(msg.init(tenant_id_, srr, ts_range_size, server_))) {
     TRANS_LOG(WARN, "msg init failed", KR(ret), K_(tenant_id));
   } else if (OB_FAIL(gts_request_rpc_->post(tenant_id_, leader, msg))) {
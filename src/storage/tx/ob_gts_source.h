@@ -45,6 +45,7 @@ public:
   int init(const uint64_t tenant_id);
   void reset();
   void inc_gts_rpc_cnt() { ATOMIC_INC(&gts_rpc_cnt_); }
+  void inc_gts_rpc_coalesced_cnt() { ATOMIC_INC(&gts_rpc_coalesced_cnt_); }
   void inc_get_gts_cache_cnt() { ATOMIC_INC(&get_gts_cache_cnt_); }
   void inc_get_gts_with_stc_cnt() { ATOMIC_INC(&get_gts_with_stc_cnt_); }
   void inc_try_get_gts_cache_cnt() { ATOMIC_INC(&try_get_gts_cache_cnt_); }
@@ -56,6 +57,8 @@ private:
   uint64_t tenant_id_;
   int64_t last_stat_ts_;
   int64_t gts_rpc_cnt_;
+  // requests skipped because an in-flight request already covers the caller
+  int64_t gts_rpc_coalesced_cnt_;
 
   int64_t get_gts_cache_cnt_;
   int64_t get_gts_with_stc_cnt_;
@@ -100,6 +103,7 @@ private:
   int refresh_gts_location_();
   int refresh_gts_(const bool need_refresh);
   int query_gts_(const common::ObAddr &leader);
+  int query_gts_(const common::ObAddr &leader, const MonotonicTs stc);
   void statistics_();
   int get_gts_from_local_timestamp_service_(common::ObAddr &leader,
                                             int64_t &gts,
@@ -31,6 +31,80 @@ namespace storage
 {
 using namespace oceanbase::transaction;
 
+int ObTxDataTable::TxStatusCache::init(const ObMemAttr &mem_attr)
+{
+  int ret = OB_SUCCESS;
+  void *ptr = nullptr;
+  if (OB_NOT_NULL(slots_)) {
+    ret = OB_INIT_TWICE;
+    STORAGE_LOG(WARN, "tx status cache init twice", KR(ret));
+  } else if (OB_ISNULL(ptr = ob_malloc_align(CACHE_ALIGN_SIZE, sizeof(Slot) * SLOT_CNT, mem_attr))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    STORAGE_LOG(WARN, "allocate memory for tx status cache failed", KR(ret));
+  } else {
+    slots_ = new (ptr) Slot[SLOT_CNT];
+  }
+  return ret;
+}
+
+void ObTxDataTable::TxStatusCache::destroy()
+{
+  if (OB_NOT_NULL(slots_)) {
+    ob_free_align(slots_);
+    slots_ = nullptr;
+  }
+}
+
+void ObTxDataTable::TxStatusCache::clear()
+{
+  for (int64_t i = 0; OB_NOT_NULL(slots_) && i < SLOT_CNT; i++) {
+    Slot &slot = slots_[i];
+    bool cleared = false;
+    while (!cleared) {
+      const int64_t seq = ATOMIC_LOAD(&slot.seq_);
+      if (0 == (seq & 1) && ATOMIC_BCAS(&slot.seq_, seq, seq + 1)) {
+        slot.commit_data_.reset();
+        ATOMIC_STORE(&slot.seq_, seq + 2);
+        cleared = true;
+      } else {
+        // a writer holds this slot only for a few stores
+        PAUSE();
+      }
+    }
+  }
+}
+
+bool ObTxDataTable::TxStatusCache::get(const ObTransID tx_id, ObTxCommitData &commit_data) const
+{
+  bool hit = false;
+  if (OB_NOT_NULL(slots_)) {
+    const Slot &slot = slot_(tx_id);
+    const int64_t seq = ATOMIC_LOAD(&slot.seq_);
+    if (0 == (seq & 1)) {
+      commit_data = slot.commit_data_;
+      MEM_BARRIER();
+      hit = (seq == ATOMIC_LOAD(&slot.seq_)) && (tx_id == commit_data.tx_id_);
+    }
+  }
+  return hit;
+}
+
+void ObTxDataTable::TxStatusCache::put(const ObTxData &tx_data)
+{
+  // only the final state of a tx can be cached, and the undo actions are not kept here
+  if (OB_NOT_NULL(slots_)
+      && tx_data.tx_id_.is_valid()
+      && (ObTxData::COMMIT == tx_data.state_ || ObTxData::ABORT == tx_data.state_)
+      && OB_ISNULL(tx_data.undo_status_list_.head_)) {
+    Slot &slot = slot_(tx_data.tx_id_);
+    const int64_t seq = ATOMIC_LOAD(&slot.seq_);
+    if (0 == (seq & 1) && ATOMIC_BCAS(&slot.seq_, seq, seq + 1)) {
+      slot.commit_data_ = tx_data;
+      ATOMIC_STORE(&slot.seq_, seq + 2);
+    }
+  }
+}
+
 int ObTxDataTable::init(ObLS *ls, ObTxCtxTable *tx_ctx_table)
 {
   int ret = OB_SUCCESS;
@@ -60,6 +134,8 @@ int ObTxDataTable::init(ObLS *ls, ObTxCtxTable *tx_ctx_table)
   } else if (FALSE_IT(arena_allocator_.set_attr(mem_attr_))) {
   } else if (OB_FAIL(init_tx_data_read_schema_())) {
     STORAGE_LOG(WARN, "init tx data read ctx failed.", KR(ret), K(tablet_id_));
+  } else if (OB_FAIL(tx_status_cache_.init(mem_attr_))) {
+    STORAGE_LOG(WARN, "init tx status cache failed.", KR(ret), K(tablet_id_));
   } else {
     slice_allocator_.set_nway(ObTxDataTable::TX_DATA_MAX_CONCURRENCY);
 
@@ -184,6 +260,7 @@ void ObTxDataTable::reset()
   memtable_mgr_ = nullptr;
   tx_ctx_table_ = nullptr;
   memtables_cache_.reuse();
+  tx_status_cache_.destroy();
   slice_allocator_.purge_extra_cached_block(0);
   is_started_ = false;
   is_inited_ = false;
@@ -208,6 +285,7 @@ int ObTxDataTable::offline()
     min_start_log_ts_in_ctx_ = 0;
     last_update_min_start_log_ts_ = 0;
     calc_upper_trans_version_cache_.reset();
+    tx_status_cache_.clear();
   }
   return ret;  
 }
@@ -495,9 +573,16 @@ int ObTxDataTable::insert_into_memtable_(ObTxDataMemtable *tx_data_memtable, ObT
 int ObTxDataTable::check_with_tx_data(const ObTransID tx_id, ObITxDataCheckFunctor &fn)
 {
   int ret = OB_SUCCESS;
+  ObTxCommitData commit_data;
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
     STORAGE_LOG(WARN, "tx data table is not init.", KR(ret), KP(this), K(tx_id));
+  } else if (tx_status_cache_.get(tx_id, commit_data)) {
+    ObTxData tx_data;
+    tx_data = commit_data;
+    if (OB_FAIL(fn(tx_data))) {
+      STORAGE_LOG(WARN, "do data check function fail.", KR(ret), KP(this), K(tablet_id_), K(tx_data));
+    }
   } else if (OB_SUCC(check_tx_data_in_memtable_(tx_id, fn))) {
     // successfully do check function in memtable, check done
     STORAGE_LOG(DEBUG, "tx data table check with tx memtable data succeed", K(tx_id), K(fn));
@@ -533,6 +618,7 @@ int ObTxDataTable::check_tx_data_in_memtable_(const ObTransID tx_id, ObITxDataCh
         STORAGE_LOG(WARN, "do data check function fail.", KR(ret), KP(this), K(tablet_id_), K(tx_data_guard.tx_data()));
       } else {
         // do data check function success
+        tx_status_cache_.put(tx_data_guard.tx_data());
       }
     } else {
       ret = OB_TRANS_CTX_NOT_EXIST;
@@ -652,6 +738,8 @@ int ObTxDataTable::check_tx_data_in_sstable_(const ObTransID tx_id, ObITxDataChe
     STORAGE_LOG(ERROR, "unexpected nullptr of tx data", KR(ret), K(tx_id));
   } else if (OB_FAIL(fn(*tx_data))) {
     STORAGE_LOG(WARN, "check tx data in sstable failed.", KR(ret), KP(this), K(tablet_id_));
+  } else {
+    tx_status_cache_.put(*tx_data);
   }
 
   // free tx data after using it
@@ -76,6 +76,41 @@ public:
     }
   };
 
+  // A direct-mapped cache of decided (committed or aborted) tx data which has no undo actions.
+  // Reads right after a large batch commit resolve the same tx ids again and again, a hit here
+  // skips the walk of tx data memtables and sstable. Each slot is guarded by a sequence number
+  // so that readers never block and a writer simply skips a slot which is being written.
+  struct TxStatusCache
+  {
+    struct Slot
+    {
+      Slot() : seq_(0), commit_data_() {}
+      int64_t seq_;
+      ObTxCommitData commit_data_;
+    } CACHE_ALIGNED;
+
+    // 2048 * 64B = 128KB for each log stream
+    static const int64_t SLOT_CNT = 2048;
+
+    TxStatusCache() : slots_(nullptr) {}
+    ~TxStatusCache() { destroy(); }
+    int init(const ObMemAttr &mem_attr);
+    void destroy();
+    // drop all cached tx status, concurrent get() and put() are allowed
+    void clear();
+    bool get(const transaction::ObTransID tx_id, ObTxCommitData &commit_data) const;
+    void put(const ObTxData &tx_data);
+
+  private:
+    Slot &slot_(const transaction::ObTransID tx_id) const
+    {
+      return slots_[tx_id.hash() & (SLOT_CNT - 1)];
+    }
+
+  private:
+    Slot *slots_;
+  };
+
   using SliceAllocator = ObSliceAlloc;
 
   static const int64_t TX_DATA_MAX_CONCURRENCY = 32;
@@ -115,7 +150,8 @@ public:  // ObTxDataTable
       memtable_mgr_(nullptr),
       tx_ctx_table_(nullptr),
       read_schema_(),
-      memtables_cache_() {}
+      memtables_cache_(),
+      tx_status_cache_() {}
   ~ObTxDataTable() {}
 
   virtual int init(ObLS *ls, ObTxCtxTable *tx_ctx_table);
@@ -333,6 +369,7 @@ private:
   TxDataReadSchema read_schema_;
   CalcUpperTransVersionCache calc_upper_trans_version_cache_;
   MemtableHandlesCache memtables_cache_;
+  TxStatusCache tx_status_cache_;
 };  // tx_table
 
 
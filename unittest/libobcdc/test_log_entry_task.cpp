@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#define private public
+#include "ob_log_part_trans_task.h"
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+using namespace common;
+
+static const int64_t STMT_BATCH_COUNT = 4;
+static const int64_t STMT_COUNT = 10;
+
+class TestLogEntryTask : public ::testing::Test
+{
+public:
+  TestLogEntryTask() {}
+  virtual void SetUp()
+  {
+    log_entry_task_.stmt_batch_count_ = STMT_BATCH_COUNT;
+  }
+  virtual void TearDown()
+  {
+    for (int64_t idx = 0; idx < stmts_.count(); ++idx) {
+      stmts_.at(idx)->~DmlStmtTask();
+    }
+    stmts_.reset();
+    log_entry_task_.reset();
+  }
+
+  // add a stmt the way the parser does: the row takes the allocator of the stmt batch
+  void add_stmt(const uint64_t row_index)
+  {
+    ObIAllocator *allocator = NULL;
+    ASSERT_EQ(OB_SUCCESS, log_entry_task_.get_next_stmt_allocator(allocator));
+    ASSERT_TRUE(NULL != allocator);
+    void *row_buf = log_entry_task_.alloc(sizeof(MutatorRow));
+    void *stmt_buf = log_entry_task_.alloc(sizeof(DmlStmtTask));
+    ASSERT_TRUE(NULL != row_buf && NULL != stmt_buf);
+    MutatorRow *row = new (row_buf) MutatorRow(*allocator);
+    DmlStmtTask *stmt = new (stmt_buf) DmlStmtTask(part_trans_task_, log_entry_task_, *row);
+    ASSERT_EQ(OB_SUCCESS, log_entry_task_.add_stmt(row_index, stmt));
+    ASSERT_EQ(OB_SUCCESS, stmts_.push_back(stmt));
+  }
+
+  PartTransTask part_trans_task_;
+  ObLogEntryTask log_entry_task_;
+  ObSEArray<DmlStmtTask *, STMT_COUNT> stmts_;
+};
+
+TEST_F(TestLogEntryTask, stmt_batch_allocator)
+{
+  for (int64_t idx = 0; idx < STMT_COUNT; ++idx) {
+    add_stmt(idx);
+    ASSERT_FALSE(HasFatalFailure());
+  }
+  ASSERT_EQ(STMT_COUNT, log_entry_task_.get_stmt_num());
+  // batches [0, 4) [4, 8) [8, 10), the first one uses the arena of the log entry task
+  ASSERT_EQ(2, log_entry_task_.batch_allocators_.count());
+
+  int64_t stmt_idx = 0;
+  for (IStmtTask *stmt = log_entry_task_.get_stmt_list().head_; NULL != stmt; stmt = stmt->get_next(), ++stmt_idx) {
+    DmlStmtTask *dml_stmt = static_cast<DmlStmtTask *>(stmt);
+    const int64_t batch_idx = log_entry_task_.get_stmt_batch_idx(stmt_idx);
+    ObIAllocator *expect = (0 == batch_idx)
+        ? static_cast<ObIAllocator *>(&log_entry_task_.arena_allocator_)
+        : log_entry_task_.batch_allocators_.at(batch_idx - 1);
+    EXPECT_EQ(stmt_idx / STMT_BATCH_COUNT, batch_idx);
+    EXPECT_EQ(expect, &dml_stmt->get_allocator()) << "stmt " << stmt_idx;
+  }
+  EXPECT_EQ(STMT_COUNT, stmt_idx);
+}
+
+TEST_F(TestLogEntryTask, concurrent_batch_alloc)
+{
+  static const int64_t ALLOC_COUNT = 10000;
+  static const int64_t ALLOC_SIZE = 100;
+  for (int64_t idx = 0; idx < STMT_COUNT; ++idx) {
+    add_stmt(idx);
+    ASSERT_FALSE(HasFatalFailure());
+  }
+
+  // one formatter thread per batch, each allocates from the stmts of its own batch only
+  const int64_t batch_count = log_entry_task_.get_stmt_batch_idx(STMT_COUNT - 1) + 1;
+  std::vector<std::vector<char *>> bufs(batch_count);
+  std::vector<std::thread> threads;
+  for (int64_t batch_idx = 0; batch_idx < batch_count; ++batch_idx) {
+    threads.emplace_back([&, batch_idx]() {
+      const int64_t stmt_begin = batch_idx * STMT_BATCH_COUNT;
+      const int64_t stmt_end = std::min(stmt_begin + STMT_BATCH_COUNT, STMT_COUNT);
+      for (int64_t i = 0; i < ALLOC_COUNT; ++i) {
+        DmlStmtTask *stmt = stmts_.at(stmt_begin + i % (stmt_end - stmt_begin));
+        char *buf = static_cast<char *>(stmt->get_allocator().alloc(ALLOC_SIZE));
+        if (NULL != buf) {
+          MEMSET(buf, static_cast<int>('a' + batch_idx), ALLOC_SIZE);
+        }
+        bufs[batch_idx].push_back(buf);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  // no buffer is handed out twice or overwritten by another batch
+  for (int64_t batch_idx = 0; batch_idx < batch_count; ++batch_idx) {
+    ASSERT_EQ(ALLOC_COUNT, static_cast<int64_t>(bufs[batch_idx].size()));
+    for (char *buf : bufs[batch_idx]) {
+      ASSERT_TRUE(NULL != buf);
+      for (int64_t pos = 0; pos < ALLOC_SIZE; ++pos) {
+        ASSERT_EQ(static_cast<char>('a' + batch_idx), buf[pos]) << "batch " << batch_idx;
+      }
+    }
+  }
+}
+
+TEST_F(TestLogEntryTask, reset_batch_allocator)
+{
+  for (int64_t idx = 0; idx < STMT_COUNT; ++idx) {
+    add_stmt(idx);
+    ASSERT_FALSE(HasFatalFailure());
+  }
+  ASSERT_EQ(2, log_entry_task_.batch_allocators_.count());
+  for (int64_t idx = 0; idx < stmts_.count(); ++idx) {
+    stmts_.at(idx)->~DmlStmtTask();
+  }
+  stmts_.reset();
+  log_entry_task_.reset();
+  EXPECT_EQ(0, log_entry_task_.batch_allocators_.count());
+  EXPECT_EQ(0, log_entry_task_.get_stmt_num());
+
+  // the task is reused from the pool, the next stmt starts a new first batch
+  log_entry_task_.stmt_batch_count_ = STMT_BATCH_COUNT;
+  ObIAllocator *allocator = NULL;
+  ASSERT_EQ(OB_SUCCESS, log_entry_task_.get_next_stmt_allocator(allocator));
+  EXPECT_EQ(&log_entry_task_.arena_allocator_, allocator);
+}
+
+} // namespace libobcdc
+} // ns oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_log_entry_task.log*");
+  OB_LOGGER.set_file_name("test_log_entry_task.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "logservice/palf/log_rpc_processor.h"
+#include "lib/compress/ob_compressor_pool.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace palf;
+
+namespace unittest
+{
+
+class TestLogTransportCompress : public ::testing::Test
+{
+public:
+  static const int64_t LOG_BUF_LEN = 64 * 1024;
+  TestLogTransportCompress() {}
+  virtual void SetUp()
+  {
+    // log entries of a group are alike, which is what makes them compressible
+    for (int64_t i = 0; i < LOG_BUF_LEN; ++i) {
+      log_buf_[i] = static_cast<char>('a' + (i % 64) / 8);
+    }
+    ASSERT_EQ(OB_SUCCESS, write_buf_.push_back(log_buf_, LOG_BUF_LEN));
+  }
+  // compress the packet the way ObRpcProxy::rpc_post does, then decode it by the processor
+  void round_trip(const ObCompressorType type,
+                  const LogRpcPacketImpl<LogPushReq> &pkt,
+                  LogPushReqP &processor);
+protected:
+  char log_buf_[LOG_BUF_LEN];
+  LogWriteBuf write_buf_;
+  char serialize_buf_[2 * LOG_BUF_LEN];
+  char compress_buf_[4 * LOG_BUF_LEN];
+  obrpc::ObRpcPacket rpc_pkt_;
+};
+
+void TestLogTransportCompress::round_trip(
+    const ObCompressorType type,
+    const LogRpcPacketImpl<LogPushReq> &pkt,
+    LogPushReqP &processor)
+{
+  ObCompressor *compressor = NULL;
+  int64_t max_overflow_size = 0;
+  int64_t original_len = 0;
+  int64_t compressed_len = 0;
+  ASSERT_TRUE(ObCompressorPool::get_instance().need_common_compress(type));
+  ASSERT_EQ(OB_SUCCESS, ObCompressorPool::get_instance().get_compressor(type, compressor));
+  ASSERT_EQ(OB_SUCCESS, serialization::encode(serialize_buf_, sizeof(serialize_buf_), original_len, pkt));
+  ASSERT_EQ(original_len, pkt.get_serialize_size());
+  ASSERT_EQ(OB_SUCCESS, compressor->get_max_overflow_size(original_len, max_overflow_size));
+  ASSERT_TRUE(original_len + max_overflow_size <= sizeof(compress_buf_));
+  ASSERT_EQ(OB_SUCCESS, compressor->compress(serialize_buf_, original_len, compress_buf_,
+                                             original_len + max_overflow_size, compressed_len));
+  // the rpc framework sends it uncompressed otherwise
+  ASSERT_LT(compressed_len, original_len);
+  rpc_pkt_.set_content(compress_buf_, compressed_len);
+  rpc_pkt_.set_compressor_type(type);
+  rpc_pkt_.set_original_len(static_cast<int32_t>(original_len));
+  processor.rpc_pkt_ = &rpc_pkt_;
+  ASSERT_EQ(OB_SUCCESS, processor.deserialize());
+}
+
+TEST_F(TestLogTransportCompress, compressor_type_of_proxy)
+{
+  obrpc::LogRpcProxyV2 proxy;
+  EXPECT_EQ(INVALID_COMPRESSOR, proxy.get_transport_compressor_type());
+  EXPECT_FALSE(ObCompressorPool::get_instance().need_common_compress(proxy.get_transport_compressor_type()));
+  proxy.set_transport_compressor_type(ZSTD_COMPRESSOR);
+  EXPECT_EQ(ZSTD_COMPRESSOR, proxy.get_transport_compressor_type());
+  proxy.set_transport_compressor_type(INVALID_COMPRESSOR);
+  EXPECT_EQ(INVALID_COMPRESSOR, proxy.get_transport_compressor_type());
+}
+
+TEST_F(TestLogTransportCompress, push_log_req_round_trip)
+{
+  const ObCompressorType types[] = {LZ4_COMPRESSOR, ZSTD_COMPRESSOR, ZSTD_1_3_8_COMPRESSOR};
+  const ObAddr src(ObAddr::IPV4, "127.0.0.1", 2882);
+  const int64_t palf_id = 1001;
+  const LogPushReq req(FETCH_LOG_RESP, 3, 2, LSN(1024), LSN(4096), write_buf_);
+  const LogRpcPacketImpl<LogPushReq> pkt(src, palf_id, req);
+  for (int64_t i = 0; i < ARRAYSIZEOF(types); ++i) {
+    LogPushReqP processor;
+    round_trip(types[i], pkt, processor);
+    const LogRpcPacketImpl<LogPushReq> &decoded_pkt = processor.arg_;
+    const LogPushReq &decoded_req = decoded_pkt.req_;
+    EXPECT_EQ(src, decoded_pkt.src_);
+    EXPECT_EQ(palf_id, decoded_pkt.palf_id_);
+    EXPECT_EQ(req.push_log_type_, decoded_req.push_log_type_);
+    EXPECT_EQ(req.msg_proposal_id_, decoded_req.msg_proposal_id_);
+    EXPECT_EQ(req.prev_log_proposal_id_, decoded_req.prev_log_proposal_id_);
+    EXPECT_EQ(req.prev_lsn_, decoded_req.prev_lsn_);
+    EXPECT_EQ(req.curr_lsn_, decoded_req.curr_lsn_);
+    const char *buf = NULL;
+    int64_t buf_len = 0;
+    ASSERT_EQ(1, decoded_req.write_buf_.get_buf_count());
+    ASSERT_EQ(OB_SUCCESS, decoded_req.write_buf_.get_write_buf(0, buf, buf_len));
+    ASSERT_EQ(LOG_BUF_LEN, buf_len);
+    EXPECT_EQ(0, MEMCMP(log_buf_, buf, LOG_BUF_LEN)) << "compressor: " << types[i];
+    // the log data points into the decompressed buffer of the processor
+    EXPECT_TRUE(NULL != processor.uncompressed_buf_);
+  }
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_log_transport_compress.log*");
+  OB_LOGGER.set_file_name("test_log_transport_compress.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_transport_compress");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
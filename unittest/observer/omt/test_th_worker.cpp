@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <mutex>
+#define private public
+#include "observer/omt/ob_th_worker.h"
+#include "lib/time/ob_time_utility.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::omt;
+
+class TestThWorker
+    : public ::testing::Test
+{
+public:
+  static const int64_t SAMPLE_INTERVAL = 200 * 1000L;
+
+  // sample the worker cpu clock twice while its thread is doing @work
+  template <typename Work>
+  bool check_stalled(Work work)
+  {
+    bool stalled = false;
+    bool stop = false;
+    bool started = false;
+    std::thread th([&]() {
+      worker_.init_cpu_clock();
+      ATOMIC_STORE(&started, true);
+      work(stop);
+    });
+    while (!ATOMIC_LOAD(&started)) {
+      PAUSE();
+    }
+    // the first sample has nothing to compare with
+    EXPECT_FALSE(worker_.is_cpu_stalled(ObTimeUtility::current_time()));
+    usleep(SAMPLE_INTERVAL);
+    stalled = worker_.is_cpu_stalled(ObTimeUtility::current_time());
+    ATOMIC_STORE(&stop, true);
+    lock_.unlock();
+    th.join();
+    return stalled;
+  }
+
+protected:
+  ObThWorker worker_;
+  std::mutex lock_;
+};
+
+TEST_F(TestThWorker, running_worker_is_not_stalled)
+{
+  lock_.lock();
+  EXPECT_FALSE(check_stalled([](bool &stop) {
+    int64_t i = 0;
+    while (!ATOMIC_LOAD(&stop)) {
+      ++i;
+    }
+    UNUSED(i);
+  }));
+}
+
+TEST_F(TestThWorker, worker_blocked_without_sched_wait_is_stalled)
+{
+  // a wait not reported by sched_wait, like a latch
+  lock_.lock();
+  EXPECT_FALSE(worker_.is_blocking());
+  EXPECT_TRUE(check_stalled([this](bool &stop) {
+    UNUSED(stop);
+    lock_.lock();
+    lock_.unlock();
+  }));
+}
+
+TEST_F(TestThWorker, worker_without_cpu_clock)
+{
+  EXPECT_FALSE(worker_.is_cpu_stalled(ObTimeUtility::current_time()));
+  usleep(SAMPLE_INTERVAL);
+  EXPECT_FALSE(worker_.is_cpu_stalled(ObTimeUtility::current_time()));
+}
+
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -401,6 +401,80 @@ TEST_F(TestKVCache, test_func)
   ASSERT_NE(OB_SUCCESS, ret);
 }
 
+TEST_F(TestKVCache, test_multi_get)
+{
+  static const int64_t K_SIZE = 16;
+  static const int64_t V_SIZE = 64;
+  static const int64_t CNT = 8;
+  typedef TestKVCacheKey<K_SIZE> TestKey;
+  typedef TestKVCacheValue<V_SIZE> TestValue;
+
+  int ret = OB_SUCCESS;
+  ObKVCache<TestKey, TestValue> cache;
+  TestKey keys[CNT];
+  TestValue values[CNT];
+  const TestKey *pkeys[CNT];
+  const TestValue *pvalues[CNT];
+  ObKVCacheHandle handles[CNT];
+  int rets[CNT];
+
+  ret = cache.init("test_multi_get");
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  for (int64_t i = 0; i < CNT; ++i) {
+    keys[i].v_ = 5000 + i;
+    keys[i].tenant_id_ = tenant_id_;
+    values[i].v_ = 6000 + i;
+    pkeys[i] = &keys[i];
+    pvalues[i] = NULL;
+  }
+
+  //invalid argument
+  ret = cache.multi_get(-1, pkeys, pvalues, handles, rets);
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ret);
+  ret = cache.multi_get(CNT, NULL, pvalues, handles, rets);
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ret);
+
+  //only even keys are in cache
+  for (int64_t i = 0; i < CNT; i += 2) {
+    ret = cache.put(keys[i], values[i]);
+    ASSERT_EQ(OB_SUCCESS, ret);
+  }
+  ret = cache.multi_get(CNT, pkeys, pvalues, handles, rets);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  for (int64_t i = 0; i < CNT; ++i) {
+    if (0 == i % 2) {
+      ASSERT_EQ(OB_SUCCESS, rets[i]);
+      ASSERT_TRUE(NULL != pvalues[i]);
+      ASSERT_EQ(values[i].v_, pvalues[i]->v_);
+      ASSERT_TRUE(handles[i].is_valid());
+    } else {
+      ASSERT_EQ(OB_ENTRY_NOT_EXIST, rets[i]);
+      ASSERT_FALSE(handles[i].is_valid());
+    }
+  }
+
+  //multi put then every key hits
+  const TestValue *put_values[CNT];
+  for (int64_t i = 0; i < CNT; ++i) {
+    put_values[i] = &values[i];
+    handles[i].reset();
+  }
+  ret = cache.multi_put(CNT, pkeys, put_values);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = cache.multi_get(CNT, pkeys, pvalues, handles, rets);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  for (int64_t i = 0; i < CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, rets[i]);
+    ASSERT_EQ(values[i].v_, pvalues[i]->v_);
+  }
+
+  for (int64_t i = 0; i < CNT; ++i) {
+    handles[i].reset();
+  }
+  cache.destroy();
+}
+
 TEST_F(TestKVCache, test_large_kv)
 {
   static const int64_t K_SIZE = 16;
@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_DAS
+#include <gtest/gtest.h>
+#include <thread>
+#define private public
+#define protected public
+#include "sql/das/ob_data_access_service.h"
+#include "sql/das/ob_das_ref.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/session/ob_sql_session_info.h"
+#include "observer/ob_server_struct.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+namespace test
+{
+class MockDASTaskOp : public ObIDASTaskOp
+{
+public:
+  MockDASTaskOp(ObIAllocator &op_alloc) : ObIDASTaskOp(op_alloc), decode_cnt_(0) {}
+  virtual int open_op() override { return OB_SUCCESS; }
+  virtual int release_op() override { return OB_SUCCESS; }
+  virtual int decode_task_result(ObIDASTaskResult *task_result) override
+  {
+    UNUSED(task_result);
+    ++decode_cnt_;
+    return OB_SUCCESS;
+  }
+  virtual int init_task_info() override { return OB_SUCCESS; }
+  virtual int swizzling_remote_task(ObDASRemoteInfo *remote_info) override
+  {
+    UNUSED(remote_info);
+    return OB_SUCCESS;
+  }
+  int64_t decode_cnt_;
+};
+
+class MockDASTaskResult : public ObIDASTaskResult
+{
+public:
+  virtual int init(const ObIDASTaskOp &task_op) override
+  {
+    UNUSED(task_op);
+    return OB_SUCCESS;
+  }
+};
+
+class TestDASAsyncAccess : public ::testing::Test
+{
+public:
+  static const int64_t TASK_CNT = 16;
+  static const int64_t RESPONDER_CNT = 4;
+  static const int64_t REQ_SIZE = 100;
+
+  TestDASAsyncAccess()
+    : allocator_(ObModIds::TEST),
+      exec_ctx_(allocator_),
+      eval_ctx_(exec_ctx_),
+      das_ref_(eval_ctx_, exec_ctx_)
+  {}
+  virtual void SetUp() override
+  {
+    exec_ctx_.set_my_session(&session_);
+    for (int64_t i = 0; i < TASK_CNT; ++i) {
+      ops_[i] = OB_NEWx(MockDASTaskOp, &allocator_, allocator_);
+      ASSERT_TRUE(NULL != ops_[i]);
+    }
+  }
+  virtual void TearDown() override
+  {
+    async_ctx_.destroy();
+    exec_ctx_.set_my_session(NULL);
+  }
+
+  // register the callbacks the way launch_async_das_task does once the requests are posted
+  void launch_all()
+  {
+    for (int64_t i = 0; i < TASK_CNT; ++i) {
+      void *buf = async_ctx_.allocator_.alloc(sizeof(ObDASAsyncAccessCB));
+      ASSERT_TRUE(NULL != buf);
+      ObDASAsyncAccessCB *cb = new(buf) ObDASAsyncAccessCB(async_ctx_.cond_, ops_[i], REQ_SIZE,
+                                                           *ObCurTraceId::get_trace_id());
+      ASSERT_EQ(OB_SUCCESS, cb->get_task_resp().add_op_result(&results_[i]));
+      ASSERT_EQ(OB_SUCCESS, async_ctx_.callbacks_.push_back(cb));
+      async_ctx_.inflight_size_ += cb->get_req_size();
+    }
+  }
+
+  // answer the callbacks from several threads like the rpc io threads do
+  void respond_all(const int64_t fail_idx, const int fail_ret)
+  {
+    std::thread responders[RESPONDER_CNT];
+    for (int64_t t = 0; t < RESPONDER_CNT; ++t) {
+      responders[t] = std::thread([&, t]() {
+        for (int64_t i = t; i < TASK_CNT; i += RESPONDER_CNT) {
+          ObDASAsyncAccessCB *cb = async_ctx_.callbacks_.at(i);
+          usleep(100 * ((i * 7) % TASK_CNT));
+          if (i != fail_idx) {
+            cb->process();
+          } else if (OB_TIMEOUT == fail_ret) {
+            cb->on_timeout();
+          } else {
+            cb->rcode_.rcode_ = fail_ret;
+            cb->process();
+          }
+        }
+      });
+    }
+    // wait for all the tasks like execute_all_task_async does
+    ret_ = OB_SUCCESS;
+    while (!async_ctx_.all_finished()) {
+      int wait_ret = ObDataAccessService::get_instance().wait_async_das_task(das_ref_, async_ctx_);
+      ret_ = COVER_SUCC(wait_ret);
+    }
+    for (int64_t t = 0; t < RESPONDER_CNT; ++t) {
+      responders[t].join();
+    }
+  }
+
+  void check_result(const int64_t fail_idx, const int fail_ret)
+  {
+    EXPECT_EQ(fail_ret, ret_);
+    EXPECT_EQ(TASK_CNT, async_ctx_.finished_cnt_);
+    EXPECT_EQ(0, async_ctx_.inflight_size_);
+    for (int64_t i = 0; i < TASK_CNT; ++i) {
+      EXPECT_TRUE(async_ctx_.callbacks_.at(i)->is_visited());
+      if (i == fail_idx) {
+        EXPECT_EQ(fail_ret, ops_[i]->errcode_);
+        EXPECT_EQ(0, ops_[i]->decode_cnt_);
+      } else {
+        EXPECT_EQ(OB_SUCCESS, ops_[i]->errcode_);
+        EXPECT_EQ(1, ops_[i]->decode_cnt_);
+      }
+    }
+  }
+
+  ObArenaAllocator allocator_;
+  ObSQLSessionInfo session_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObDASRef das_ref_;
+  ObDASAsyncAccessCtx async_ctx_;
+  MockDASTaskOp *ops_[TASK_CNT];
+  MockDASTaskResult results_[TASK_CNT];
+  int ret_;
+};
+
+TEST_F(TestDASAsyncAccess, one_task_fails_remotely)
+{
+  launch_all();
+  respond_all(5, OB_ERR_UNEXPECTED);
+  check_result(5, OB_ERR_UNEXPECTED);
+}
+
+TEST_F(TestDASAsyncAccess, one_task_timeout)
+{
+  launch_all();
+  respond_all(TASK_CNT - 1, OB_TIMEOUT);
+  check_result(TASK_CNT - 1, OB_TIMEOUT);
+}
+
+TEST_F(TestDASAsyncAccess, failed_task_goes_through_retry)
+{
+  // the failed async task is handed to the same retry logic as the sync one, which gives up
+  // at once for the errors that are not about the location
+  GCONF._enable_partition_level_retry = true;
+  ops_[3]->set_can_part_retry(true);
+  launch_all();
+  respond_all(3, OB_ERR_UNEXPECTED);
+  check_result(3, OB_ERR_UNEXPECTED);
+  EXPECT_FALSE(ops_[3]->in_part_retry_);
+
+  ops_[3]->errcode_ = OB_TIMEOUT;
+  EXPECT_EQ(OB_TIMEOUT, ObDataAccessService::get_instance().try_retry_das_task(das_ref_, *ops_[3]));
+  ops_[3]->errcode_ = OB_SUCCESS;
+  EXPECT_EQ(OB_SUCCESS, ObDataAccessService::get_instance().try_retry_das_task(das_ref_, *ops_[3]));
+}
+
+} // namespace test
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_das_async_access.log*");
+  OB_LOGGER.set_file_name("test_das_async_access.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
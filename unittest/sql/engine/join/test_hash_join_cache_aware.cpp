@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/engine/join/ob_hash_join_op.h"
+#include "sql/optimizer/ob_log_join.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+class TestHashJoinCacheAware : public ::testing::Test
+{
+public:
+  TestHashJoinCacheAware() {}
+};
+
+// the plan only rules out cache aware hash join when the probe side is estimated far smaller
+TEST_F(TestHashJoinCacheAware, plan_disable)
+{
+  // probe side far smaller than build side, the partitioning pass is never amortized
+  EXPECT_TRUE(ObLogJoin::is_probe_too_small_for_cache_aware(1000000, 1000));
+  EXPECT_TRUE(ObLogJoin::is_probe_too_small_for_cache_aware(1000000, 100000));
+  // close to the bound, the estimate is not trusted and the operator decides
+  EXPECT_FALSE(ObLogJoin::is_probe_too_small_for_cache_aware(1000000, 125000));
+  EXPECT_FALSE(ObLogJoin::is_probe_too_small_for_cache_aware(1000000, 200000));
+  EXPECT_FALSE(ObLogJoin::is_probe_too_small_for_cache_aware(1000000, 500000));
+  EXPECT_FALSE(ObLogJoin::is_probe_too_small_for_cache_aware(1000000, 1000000));
+  // no estimate for the build side
+  EXPECT_FALSE(ObLogJoin::is_probe_too_small_for_cache_aware(0, 0));
+  EXPECT_FALSE(ObLogJoin::is_probe_too_small_for_cache_aware(0, 1000));
+}
+
+// when the plan does not rule it out, the operator decides by the actual build size
+TEST_F(TestHashJoinCacheAware, runtime_decide)
+{
+  const int64_t part_cnt = ObHashJoinOp::CACHE_AWARE_PART_CNT;
+  // build side fills enough partitions in memory
+  EXPECT_TRUE(ObHashJoinOp::need_cache_aware_join(true, part_cnt, false));
+  EXPECT_TRUE(ObHashJoinOp::need_cache_aware_join(true, part_cnt * 4, false));
+  // build side smaller than the estimate
+  EXPECT_FALSE(ObHashJoinOp::need_cache_aware_join(true, part_cnt - 1, false));
+  EXPECT_FALSE(ObHashJoinOp::need_cache_aware_join(true, 0, false));
+  // build side larger than memory
+  EXPECT_FALSE(ObHashJoinOp::need_cache_aware_join(false, part_cnt * 4, false));
+  // ruled out by the plan
+  EXPECT_FALSE(ObHashJoinOp::need_cache_aware_join(true, part_cnt * 4, true));
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_hash_join_cache_aware.log*");
+  OB_LOGGER.set_file_name("test_hash_join_cache_aware.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -305,6 +305,55 @@ TEST_F(TestParser, general_parser_escape)
 
 }
 
+TEST_F(TestParser, general_parser_long_fields)
+{
+  ObDataInFileStruct file_struct;
+  file_struct.field_term_str_ = ",";
+  file_struct.field_enclosed_str_ = "\"";
+  file_struct.field_enclosed_char_ = '"';
+  const int64_t column_num = 3;
+  const char *data =
+      "\"enclosed, with comma and longer than one block\",plain field longer than one block,"
+      "\xe4\xb8\xad\xe6\x96\x87\xe4\xb8\xad\xe6\x96\x87\xe4\xb8\xad\xe6\x96\x87\n"
+      "escaped\\,comma in a field longer than one block,x,y\n"
+      "short,,\\N\n";
+  const char *expected[][column_num] = {
+    {"enclosed, with comma and longer than one block", "plain field longer than one block",
+     "\xe4\xb8\xad\xe6\x96\x87\xe4\xb8\xad\xe6\x96\x87\xe4\xb8\xad\xe6\x96\x87"},
+    {"escaped,comma in a field longer than one block", "x", "y"},
+    {"short", "", NULL},
+  };
+  char escape_buf[1024];
+
+  ObCSVGeneralParser parser;
+  ASSERT_EQ(OB_SUCCESS, parser.init(file_struct, column_num, CS_TYPE_UTF8MB4_BIN));
+
+  int64_t line_idx = 0;
+  auto check_line = [&](ObIArray<ObCSVGeneralParser::FieldValue> &arr) -> int {
+    EXPECT_EQ(column_num, arr.count());
+    for (int64_t i = 0; i < arr.count() && line_idx < 3; ++i) {
+      if (NULL == expected[line_idx][i]) {
+        EXPECT_TRUE(arr.at(i).is_null_);
+      } else {
+        EXPECT_EQ(ObString(expected[line_idx][i]), ObString(arr.at(i).len_, arr.at(i).ptr_));
+      }
+    }
+    line_idx++;
+    return OB_SUCCESS;
+  };
+  ObSEArray<ObCSVGeneralParser::LineErrRec, 16> error_msgs;
+  const char *ptr = data;
+  const char *end = data + strlen(data);
+  int64_t nrows = INT64_MAX;
+  ASSERT_EQ(OB_SUCCESS, (parser.scan<decltype(check_line), true>(ptr, end, nrows,
+                                    escape_buf, escape_buf + sizeof(escape_buf),
+                                    check_line, error_msgs, false)));
+  ASSERT_EQ(3, nrows);
+  ASSERT_EQ(3, line_idx);
+  ASSERT_EQ(0, error_msgs.count());
+  ASSERT_EQ(end, ptr);
+}
+
 int main(int argc, char **argv)
 {
   init_sql_factories();
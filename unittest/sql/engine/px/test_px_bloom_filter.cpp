@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+#include <gtest/gtest.h>
+#include <random>
+#define private public
+#define protected public
+#include "sql/engine/px/ob_px_bloom_filter.h"
+#include "sql/optimizer/ob_logical_operator.h"
+#include "storage/blocksstable/encoding/ob_encoding_query_util.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+static const int64_t BUILD_KEY_COUNT = 100000;
+static const int64_t PROBE_KEY_COUNT = 400000;
+
+class TestPxBloomFilter : public ::testing::Test
+{
+public:
+  TestPxBloomFilter() : allocator_("TestPxBF") {}
+  virtual void SetUp()
+  {
+    std::mt19937_64 rand(20231017);
+    for (int64_t i = 0; i < BUILD_KEY_COUNT; ++i) {
+      build_hashes_.push_back(rand());
+    }
+    for (int64_t i = 0; i < PROBE_KEY_COUNT; ++i) {
+      probe_hashes_.push_back(rand());
+    }
+    ASSERT_EQ(OB_SUCCESS, filter_.init(BUILD_KEY_COUNT, allocator_));
+    // insert the way ObJoinFilterOp::insert_by_row_batch does: prefetch the blocks, then put
+    for (int64_t i = 0; i < BUILD_KEY_COUNT; ++i) {
+      filter_.prefetch_bits_block(build_hashes_[i]);
+    }
+    for (int64_t i = 0; i < BUILD_KEY_COUNT; ++i) {
+      ASSERT_EQ(OB_SUCCESS, filter_.put(build_hashes_[i]));
+    }
+  }
+  virtual void TearDown()
+  {
+    filter_.reset();
+    allocator_.reset();
+  }
+
+  // check the probe function gives the same result as the scalar probe on the same filter
+  void check_same_as_nonsimd(ObPxBloomFilter::GetFunc func)
+  {
+    bool is_match = false;
+    bool expect = false;
+    for (int64_t i = 0; i < BUILD_KEY_COUNT; ++i) {
+      ASSERT_EQ(OB_SUCCESS, (filter_.*func)(build_hashes_[i], is_match));
+      ASSERT_TRUE(is_match) << "build key " << i;
+    }
+    for (int64_t i = 0; i < PROBE_KEY_COUNT; ++i) {
+      ASSERT_EQ(OB_SUCCESS, filter_.might_contain_nonsimd(probe_hashes_[i], expect));
+      ASSERT_EQ(OB_SUCCESS, (filter_.*func)(probe_hashes_[i], is_match));
+      ASSERT_EQ(expect, is_match) << "probe key " << i << " hash " << probe_hashes_[i];
+    }
+  }
+
+  ObArenaAllocator allocator_;
+  ObPxBloomFilter filter_;
+  std::vector<uint64_t> build_hashes_;
+  std::vector<uint64_t> probe_hashes_;
+};
+
+TEST_F(TestPxBloomFilter, nonsimd)
+{
+  bool is_match = false;
+  int64_t false_positive = 0;
+  for (int64_t i = 0; i < BUILD_KEY_COUNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, filter_.might_contain_nonsimd(build_hashes_[i], is_match));
+    ASSERT_TRUE(is_match) << "build key " << i;
+  }
+  for (int64_t i = 0; i < PROBE_KEY_COUNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, filter_.might_contain_nonsimd(probe_hashes_[i], is_match));
+    false_positive += is_match ? 1 : 0;
+  }
+  // default fpp is 0.01, leave some room for the rounding of the filter size
+  EXPECT_LT(false_positive, PROBE_KEY_COUNT / 20);
+}
+
+TEST_F(TestPxBloomFilter, avx2_same_as_nonsimd)
+{
+  if (!blocksstable::is_avx2_valid()) {
+    LOG_INFO("avx2 is not supported, skip");
+  } else {
+    check_same_as_nonsimd(&ObPxBloomFilter::might_contain_avx2);
+  }
+}
+
+TEST_F(TestPxBloomFilter, avx512_same_as_nonsimd)
+{
+  if (!blocksstable::is_avx512_valid()) {
+    LOG_INFO("avx512 is not supported, skip");
+  } else {
+    check_same_as_nonsimd(&ObPxBloomFilter::might_contain_simd);
+  }
+}
+
+TEST_F(TestPxBloomFilter, deserialize_same_result)
+{
+  // send the whole filter in one piece
+  filter_.set_begin_idx(0);
+  filter_.set_end_idx(filter_.get_bits_array_length() - 1);
+  const int64_t buf_len = filter_.get_serialize_size();
+  char *buf = static_cast<char *>(allocator_.alloc(buf_len));
+  int64_t pos = 0;
+  ASSERT_TRUE(NULL != buf);
+  ASSERT_EQ(OB_SUCCESS, filter_.serialize(buf, buf_len, pos));
+  ObPxBloomFilter other;
+  int64_t other_pos = 0;
+  ASSERT_EQ(OB_SUCCESS, other.deserialize(buf, pos, other_pos));
+  ASSERT_EQ(pos, other_pos);
+  EXPECT_TRUE(filter_.might_contain_ == other.might_contain_);
+  bool expect = false;
+  bool is_match = false;
+  for (int64_t i = 0; i < PROBE_KEY_COUNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, filter_.might_contain(probe_hashes_[i], expect));
+    ASSERT_EQ(OB_SUCCESS, other.might_contain(probe_hashes_[i], is_match));
+    ASSERT_EQ(expect, is_match) << "probe key " << i;
+  }
+}
+
+TEST(TestJoinFilterLength, build_ndv)
+{
+  // duplicated build keys, sized by the distinct count
+  EXPECT_EQ(1000, ObLogicalOperator::get_join_filter_length(1000000.0, 1000.0));
+  // the distinct count never exceeds the build rows
+  EXPECT_EQ(1000, ObLogicalOperator::get_join_filter_length(1000.0, 5000.0));
+  // the bloom filter needs at least one key
+  EXPECT_EQ(1, ObLogicalOperator::get_join_filter_length(0.0, 0.0));
+  EXPECT_EQ(1, ObLogicalOperator::get_join_filter_length(100.0, 0.5));
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_px_bloom_filter.log*");
+  OB_LOGGER.set_file_name("test_px_bloom_filter.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
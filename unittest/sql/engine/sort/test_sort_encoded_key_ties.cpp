@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/engine/sort/ob_sort_op_impl.h"
+#include "share/datum/ob_datum_funcs.h"
+#include "sql/engine/ob_exec_context.h"
+
+using namespace oceanbase;
+using namespace oceanbase::sql;
+using namespace oceanbase::common;
+
+// Rows are already ordered by the encoded key (cell 0) as ObAdaptiveQS leaves them,
+// sort_encoded_key_ties() must order each run of equal encoded keys by the remaining keys.
+class TestSortEncodedKeyTies : public ::testing::Test
+{
+public:
+  static const int64_t CELL_CNT = 3;
+  static const int64_t NULL_VAL = INT64_MIN;
+  struct RowDesc
+  {
+    const char *key_;
+    int64_t k1_;
+    int64_t k2_;
+  };
+
+  TestSortEncodedKeyTies() : exec_ctx_(alloc_) {}
+
+  virtual void SetUp() override
+  {
+    // encoded key asc, k1 asc with nulls first, k2 desc with nulls first (last after reversed)
+    ASSERT_EQ(OB_SUCCESS, collations_.push_back(ObSortFieldCollation(0, CS_TYPE_BINARY, true, NULL_FIRST)));
+    ASSERT_EQ(OB_SUCCESS, collations_.push_back(ObSortFieldCollation(1, CS_TYPE_BINARY, true, NULL_FIRST)));
+    ASSERT_EQ(OB_SUCCESS, collations_.push_back(ObSortFieldCollation(2, CS_TYPE_BINARY, false, NULL_FIRST)));
+    ObSortCmpFunc cmp_func;
+    cmp_func.cmp_func_ = ObDatumFuncs::get_nullsafe_cmp_func(ObVarcharType, ObVarcharType,
+                                                             NULL_FIRST, CS_TYPE_BINARY, false);
+    ASSERT_EQ(OB_SUCCESS, cmp_funcs_.push_back(cmp_func));
+    cmp_func.cmp_func_ = ObDatumFuncs::get_nullsafe_cmp_func(ObIntType, ObIntType,
+                                                             NULL_FIRST, CS_TYPE_BINARY, false);
+    ASSERT_EQ(OB_SUCCESS, cmp_funcs_.push_back(cmp_func));
+    ASSERT_EQ(OB_SUCCESS, cmp_funcs_.push_back(cmp_func));
+    ASSERT_EQ(OB_SUCCESS, sort_.comp_.init(&collations_, &cmp_funcs_, &exec_ctx_));
+  }
+
+  void build_rows(const RowDesc *descs, const int64_t cnt)
+  {
+    rows_.reset();
+    for (int64_t i = 0; i < cnt; i++) {
+      const int64_t size = sizeof(ObChunkDatumStore::StoredRow)
+          + CELL_CNT * sizeof(ObDatum) + 2 * sizeof(int64_t);
+      char *buf = static_cast<char *>(alloc_.alloc(size));
+      ASSERT_TRUE(NULL != buf);
+      ObChunkDatumStore::StoredRow *sr = new (buf) ObChunkDatumStore::StoredRow();
+      sr->cnt_ = CELL_CNT;
+      sr->row_size_ = static_cast<uint32_t>(size);
+      ObDatum *cells = sr->cells();
+      int64_t *ints = reinterpret_cast<int64_t *>(cells + CELL_CNT);
+      cells[0].set_string(descs[i].key_, static_cast<int32_t>(strlen(descs[i].key_)));
+      const int64_t vals[] = { descs[i].k1_, descs[i].k2_ };
+      for (int64_t j = 0; j < 2; j++) {
+        ObDatum &cell = cells[j + 1];
+        if (NULL_VAL == vals[j]) {
+          cell.set_null();
+        } else {
+          cell.ptr_ = reinterpret_cast<const char *>(ints + j);
+          cell.set_int(vals[j]);
+        }
+      }
+      ASSERT_EQ(OB_SUCCESS, rows_.push_back(sr));
+    }
+  }
+
+  void verify_rows(const RowDesc *descs, const int64_t cnt)
+  {
+    ASSERT_EQ(cnt, rows_.count());
+    for (int64_t i = 0; i < cnt; i++) {
+      const ObDatum *cells = rows_.at(i)->cells();
+      ASSERT_EQ(0, cells[0].get_string().compare(ObString(descs[i].key_))) << "row " << i;
+      const int64_t vals[] = { descs[i].k1_, descs[i].k2_ };
+      for (int64_t j = 0; j < 2; j++) {
+        const ObDatum &cell = cells[j + 1];
+        if (NULL_VAL == vals[j]) {
+          ASSERT_TRUE(cell.is_null()) << "row " << i << " col " << j + 1;
+        } else {
+          ASSERT_FALSE(cell.is_null()) << "row " << i << " col " << j + 1;
+          ASSERT_EQ(vals[j], cell.get_int()) << "row " << i << " col " << j + 1;
+        }
+      }
+    }
+  }
+
+  ObArenaAllocator alloc_;
+  ObExecContext exec_ctx_;
+  ObSEArray<ObSortFieldCollation, CELL_CNT> collations_;
+  ObSEArray<ObSortCmpFunc, CELL_CNT> cmp_funcs_;
+  ObSortOpImpl sort_;
+  ObArray<ObChunkDatumStore::StoredRow *> rows_;
+};
+
+TEST_F(TestSortEncodedKeyTies, equal_prefix_later_columns)
+{
+  const int64_t N = NULL_VAL;
+  // "c" and "cc" share a prefix but are different encoded keys
+  const RowDesc input[] = {
+    {"a", 3, 1}, {"a", N, 5}, {"a", 1, 2}, {"a", 1, N}, {"a", 1, 9}, {"a", N, 7},
+    {"b", 2, 0},
+    {"c", 5, 5}, {"c", 4, 4},
+    {"cc", 0, 0},
+  };
+  const RowDesc expect[] = {
+    {"a", N, 7}, {"a", N, 5}, {"a", 1, 9}, {"a", 1, 2}, {"a", 1, N}, {"a", 3, 1},
+    {"b", 2, 0},
+    {"c", 4, 4}, {"c", 5, 5},
+    {"cc", 0, 0},
+  };
+  build_rows(input, ARRAYSIZEOF(input));
+  ASSERT_FALSE(HasFatalFailure());
+  sort_.sort_encoded_key_ties(rows_, 0, rows_.count(), 0);
+  ASSERT_EQ(OB_SUCCESS, sort_.comp_.ret_);
+  verify_rows(expect, ARRAYSIZEOF(expect));
+  // compare range is restored
+  ASSERT_EQ(0, sort_.comp_.cmp_start_);
+  ASSERT_EQ(CELL_CNT, sort_.comp_.cmp_end_);
+}
+
+TEST_F(TestSortEncodedKeyTies, sub_range)
+{
+  const int64_t N = NULL_VAL;
+  // only rows in [2, 6) are sorted, as in one partition of a part sort
+  const RowDesc input[] = {
+    {"a", 9, 9}, {"a", 1, 1},
+    {"b", 2, N}, {"b", 2, 3}, {"b", N, 0}, {"c", 1, 1},
+    {"a", 9, 9}, {"a", 1, 1},
+  };
+  const RowDesc expect[] = {
+    {"a", 9, 9}, {"a", 1, 1},
+    {"b", N, 0}, {"b", 2, 3}, {"b", 2, N}, {"c", 1, 1},
+    {"a", 9, 9}, {"a", 1, 1},
+  };
+  build_rows(input, ARRAYSIZEOF(input));
+  ASSERT_FALSE(HasFatalFailure());
+  sort_.sort_encoded_key_ties(rows_, 2, 6, 0);
+  ASSERT_EQ(OB_SUCCESS, sort_.comp_.ret_);
+  verify_rows(expect, ARRAYSIZEOF(expect));
+}
+
+TEST_F(TestSortEncodedKeyTies, no_remaining_keys)
+{
+  const int64_t N = NULL_VAL;
+  // the encoded key is the last sort key, ties keep their order
+  const RowDesc input[] = {
+    {"a", 3, 1}, {"a", N, 5}, {"a", 1, 2},
+  };
+  build_rows(input, ARRAYSIZEOF(input));
+  ASSERT_FALSE(HasFatalFailure());
+  sort_.comp_.cnt_ = 1;
+  sort_.sort_encoded_key_ties(rows_, 0, rows_.count(), 0);
+  ASSERT_EQ(OB_SUCCESS, sort_.comp_.ret_);
+  verify_rows(input, ARRAYSIZEOF(input));
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_sort_encoded_key_ties.log*");
+  OB_LOGGER.set_file_name("test_sort_encoded_key_ties.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
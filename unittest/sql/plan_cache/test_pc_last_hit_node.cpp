@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+#include <gtest/gtest.h>
+#include <thread>
+#define private public
+#define protected public
+#include "sql/plan_cache/ob_plan_cache.h"
+#include "sql/plan_cache/ob_pcv_set.h"
+#include "sql/plan_cache/ob_plan_cache_callback.h"
+#include "sql/plan_cache/ob_lib_cache_register.h"
+#include "sql/session/ob_sql_session_info.h"
+#include "sql/engine/ob_exec_context.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+namespace test
+{
+class TestPcLastHitNode : public ::testing::Test
+{
+public:
+  static const int64_t BUCKET_NUM = 1024;
+  static const int64_t EVICT_ROUND = 2000;
+
+  TestPcLastHitNode()
+    : allocator_(ObModIds::TEST),
+      exec_ctx_(allocator_),
+      pc_ctx_(ObString::make_string("select 1"), false, allocator_, sql_ctx_, exec_ctx_,
+              OB_SYS_TENANT_ID),
+      key_(ObString::make_string("select ?"), OB_INVALID_ID, OB_INVALID_ID, 0, false,
+           ObString(), ObString(), NS_CRSR)
+  {}
+  virtual void SetUp() override
+  {
+    ASSERT_EQ(OB_SUCCESS, plan_cache_.init(BUCKET_NUM, ObAddr(), OB_SYS_TENANT_ID, NULL));
+    plan_cache_.inc_ref_count();
+    sql_ctx_.session_info_ = &session_;
+    pc_ctx_.key_ = &key_;
+  }
+  virtual void TearDown() override
+  {
+    session_.reset_pc_last_hit_node();
+    plan_cache_.destroy();
+  }
+
+  // add a pcv set of key_ to the plan cache the way add_cache_obj does, its get_cache_obj
+  // fails with OB_NOT_SUPPORTED since no param is fast parsed in pc_ctx_
+  void add_node()
+  {
+    ObILibCacheNode *node = NULL;
+    ASSERT_EQ(OB_SUCCESS, plan_cache_.cn_factory_.create_cache_node(NS_CRSR, node,
+                                                                    OB_SYS_TENANT_ID));
+    ASSERT_TRUE(NULL != node);
+    ObPCVSet *pcv_set = static_cast<ObPCVSet *>(node);
+    pcv_set->set_plan_cache_key(key_);
+    pcv_set->normal_parse_const_cnt_ = 1;
+    node->inc_ref_count(LC_NODE_HANDLE); // in alloc, owned by the map
+    ASSERT_EQ(OB_SUCCESS, plan_cache_.add_node_id(node));
+    ASSERT_EQ(OB_SUCCESS, plan_cache_.cache_key_node_map_.set_refactored(
+                          &pcv_set->get_plan_cache_key(), node));
+  }
+
+  // remember the node of key_ in the session the way get_cache_obj does
+  void remember_node()
+  {
+    ObILibCacheNode *node = NULL;
+    ObLibCacheRlockAndRef r_ref_lock(LC_NODE_RD_HANDLE);
+    ASSERT_EQ(OB_SUCCESS, plan_cache_.get_value(&key_, node, r_ref_lock));
+    if (NULL != node) {
+      session_.set_pc_last_hit_node(node->get_node_id(), node->get_evict_version());
+      (void)node->unlock();
+      (void)node->dec_ref_count(LC_NODE_RD_HANDLE);
+    }
+  }
+
+  ObArenaAllocator allocator_;
+  ObPlanCache plan_cache_;
+  ObSQLSessionInfo session_;
+  ObSqlCtx sql_ctx_;
+  ObExecContext exec_ctx_;
+  ObPlanCacheCtx pc_ctx_;
+  ObPlanCacheKey key_;
+};
+
+TEST_F(TestPcLastHitNode, hit_and_evict)
+{
+  bool is_hit = false;
+  add_node();
+  remember_node();
+  ASSERT_NE(OB_INVALID_ID, session_.get_pc_last_hit_node_id());
+  {
+    ObCacheObjGuard guard(PC_REF_PLAN_LOCAL_HANDLE);
+    EXPECT_EQ(OB_NOT_SUPPORTED, plan_cache_.get_plan_by_last_hit_node(pc_ctx_, guard, is_hit));
+    EXPECT_TRUE(is_hit);
+    EXPECT_NE(OB_INVALID_ID, session_.get_pc_last_hit_node_id());
+  }
+  {
+    // the session holds no reference, the node is only owned by the map
+    ObILibCacheNode *node = NULL;
+    ASSERT_EQ(OB_SUCCESS, plan_cache_.id_node_map_.get_refactored(
+                          session_.get_pc_last_hit_node_id(), node));
+    EXPECT_EQ(1, node->get_ref_count());
+  }
+
+  // the removed node is freed at once and the session never reaches it again
+  ASSERT_EQ(OB_SUCCESS, plan_cache_.remove_cache_node(&key_));
+  EXPECT_EQ(0, plan_cache_.id_node_map_.size());
+  {
+    ObCacheObjGuard guard(PC_REF_PLAN_LOCAL_HANDLE);
+    EXPECT_EQ(OB_SUCCESS, plan_cache_.get_plan_by_last_hit_node(pc_ctx_, guard, is_hit));
+    EXPECT_FALSE(is_hit);
+    EXPECT_EQ(OB_INVALID_ID, session_.get_pc_last_hit_node_id());
+  }
+}
+
+TEST_F(TestPcLastHitNode, evict_races_with_lookup)
+{
+  bool evict_done = false;
+  int64_t hit_cnt = 0;
+  int64_t miss_cnt = 0;
+  int64_t fail_cnt = 0;
+
+  std::thread evictor([&]() {
+    for (int64_t i = 0; i < EVICT_ROUND; ++i) {
+      add_node();
+      usleep(10);
+      if (OB_SUCCESS != plan_cache_.remove_cache_node(&key_)) {
+        ATOMIC_INC(&fail_cnt);
+      }
+    }
+    ATOMIC_STORE(&evict_done, true);
+  });
+
+  while (!ATOMIC_LOAD(&evict_done)) {
+    remember_node();
+    while (OB_INVALID_ID != session_.get_pc_last_hit_node_id()) {
+      ObCacheObjGuard guard(PC_REF_PLAN_LOCAL_HANDLE);
+      bool is_hit = false;
+      int ret = plan_cache_.get_plan_by_last_hit_node(pc_ctx_, guard, is_hit);
+      if (is_hit && OB_NOT_SUPPORTED == ret) {
+        // the pcv set is reached under its lock
+        ++hit_cnt;
+      } else if (!is_hit && OB_SUCCESS == ret
+                 && OB_INVALID_ID == session_.get_pc_last_hit_node_id()) {
+        // the key always matches, so the node is dropped only because of eviction
+        ++miss_cnt;
+      } else {
+        ATOMIC_INC(&fail_cnt);
+      }
+    }
+  }
+  evictor.join();
+
+  LOG_INFO("evict races with lookup", K(hit_cnt), K(miss_cnt), K(fail_cnt));
+  EXPECT_EQ(0, fail_cnt);
+  EXPECT_EQ(EVICT_ROUND, plan_cache_.last_node_id_);
+  EXPECT_EQ(0, plan_cache_.id_node_map_.size());
+  EXPECT_EQ(0, plan_cache_.cache_key_node_map_.size());
+}
+
+} // namespace test
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_pc_last_hit_node.log*");
+  OB_LOGGER.set_file_name("test_pc_last_hit_node.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ObLibCacheRegister::register_cache_objs();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
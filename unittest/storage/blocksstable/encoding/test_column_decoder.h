@@ -65,7 +65,8 @@ public:
         ObMicroBlockDecoder& decoder,
         sql::ObPushdownWhiteFilterNode &filter_node,
         common::ObBitmap &result_bitmap,
-        common::ObFixedArray<ObObj, ObIAllocator> &objs);
+        common::ObFixedArray<ObObj, ObIAllocator> &objs,
+        const ObColumnParam *col_param = nullptr);
 
   void basic_filter_pushdown_in_op_test();
 
@@ -77,6 +78,8 @@ public:
 
   void filter_pushdown_comaprison_neg_test();
 
+  void filter_pushdown_like_test();
+
   void batch_decode_to_datum_test(bool is_condensed = false);
 
   void batch_get_row_perf_test();
@@ -305,7 +308,8 @@ int TestColumnDecoder::test_filter_pushdown(
     ObMicroBlockDecoder& decoder,
     sql::ObPushdownWhiteFilterNode &filter_node,
     common::ObBitmap &result_bitmap,
-    common::ObFixedArray<ObObj, ObIAllocator> &objs)
+    common::ObFixedArray<ObObj, ObIAllocator> &objs,
+    const ObColumnParam *col_param)
 {
   int ret = OB_SUCCESS;
   storage::PushdownFilterInfo pd_filter_info;
@@ -316,7 +320,6 @@ int TestColumnDecoder::test_filter_pushdown(
   sql::ObWhiteFilterExecutor filter(allocator_, filter_node, op);
   filter.col_offsets_.init(COLUMN_CNT);
   filter.col_params_.init(COLUMN_CNT);
-  const ObColumnParam *col_param = nullptr;
   filter.col_params_.push_back(col_param);
   filter.col_offsets_.push_back(col_idx);
   filter.n_cols_ = 1;
@@ -329,9 +332,12 @@ int TestColumnDecoder::test_filter_pushdown(
   filter.params_ = objs;
   if (sql::WHITE_OP_IN == filter.get_op_type()) {
     filter.init_obj_set();
+  } else if (sql::WHITE_OP_LI == filter.get_op_type()) {
+    ret = filter.init_like_pattern();
   }
 
-  if (is_retro) {
+  if (OB_FAIL(ret)) {
+  } else if (is_retro) {
     ret = decoder.filter_pushdown_retro(nullptr, filter, pd_filter_info, col_idx, filter.col_params_.at(0), pd_filter_info.col_buf_[0], result_bitmap);
   } else {
     ret = decoder.filter_pushdown_filter(nullptr, filter, pd_filter_info, result_bitmap);
@@ -830,6 +836,125 @@ void TestColumnDecoder::basic_filter_pushdown_bt_test()
   }
 }
 
+void TestColumnDecoder::filter_pushdown_like_test()
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+
+  int64_t char_col_idx = -1;
+  for (int64_t i = 0; i < col_descs_.count(); ++i) {
+    if (ObCharType == col_descs_.at(i).col_type_.get_type()) {
+      char_col_idx = i;
+      break;
+    }
+  }
+  ASSERT_LE(0, char_col_idx);
+
+  // Few distinct values so that const encoding keeps them as exceptions
+  int64_t seed0 = 10000;
+  const char *exception_strs[] = {"a_c", "a%c", "xyz"};
+  const int64_t exception_cnt = ARRAYSIZEOF(exception_strs);
+  const int64_t ab_count = ROW_CNT - exception_cnt - 1;
+  const int64_t null_count = 1;
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed0, row));
+    if (i < ab_count) {
+      row.storage_datums_[char_col_idx].set_string(ObString("ab"));
+    } else if (i < ab_count + exception_cnt) {
+      row.storage_datums_[char_col_idx].set_string(ObString(exception_strs[i - ab_count]));
+    } else {
+      row.storage_datums_[char_col_idx].set_null();
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_)) << "buffer size: " << data.get_buf_size() << std::endl;
+
+  // char(10), values are padded to 10 bytes with spaces when col_param is given
+  ObColumnParam col_param(allocator_);
+  ObAccuracy accuracy;
+  accuracy.set_length(10);
+  col_param.set_accuracy(accuracy);
+  col_param.set_meta_type(col_descs_.at(char_col_idx).col_type_);
+
+  struct LikeCase
+  {
+    const char *pattern_;
+    const char *escape_;
+    ObCollationType cs_type_;
+    bool need_padding_;
+    int64_t result_count_;
+  };
+  const LikeCase cases[] = {
+    {"a%", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, true, ab_count + 2},
+    {"AB%", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, true, ab_count},
+    {"%", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, true, ROW_CNT - null_count},
+    {"%  ", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, true, ROW_CNT - null_count},
+    {"%  ", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, false, 0},
+    {"ab________", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, true, ab_count},
+    {"ab________", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, false, 0},
+    {"ab", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, true, 0},
+    {"ab", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, false, ab_count},
+    {"x_z%", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, true, 1},
+    {"a\\_c%", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, true, 1},
+    {"a#%c%", "#", CS_TYPE_UTF8MB4_GENERAL_CI, true, 1},
+    {"a_c%", nullptr, CS_TYPE_UTF8MB4_GENERAL_CI, true, 2},
+    // literal patterns take the memcmp / memmem path under binary collation
+    {"a%", nullptr, CS_TYPE_UTF8MB4_BIN, true, ab_count + 2},
+    {"AB%", nullptr, CS_TYPE_UTF8MB4_BIN, true, 0},
+    {"%b%", nullptr, CS_TYPE_UTF8MB4_BIN, true, ab_count},
+    {"%  ", nullptr, CS_TYPE_UTF8MB4_BIN, true, ROW_CNT - null_count},
+    {"%  ", nullptr, CS_TYPE_UTF8MB4_BIN, false, 0},
+    {"ab", nullptr, CS_TYPE_UTF8MB4_BIN, false, ab_count},
+  };
+
+  for (int64_t i = 0; i < ARRAYSIZEOF(cases); ++i) {
+    const LikeCase &like_case = cases[i];
+    sql::ObExpr arg_exprs[3];
+    sql::ObExpr *args[3] = {&arg_exprs[0], &arg_exprs[1], &arg_exprs[2]};
+    for (int64_t j = 0; j < 3; ++j) {
+      arg_exprs[j].datum_meta_.cs_type_ = like_case.cs_type_;
+    }
+    sql::ObExpr like_expr;
+    like_expr.arg_cnt_ = 3;
+    like_expr.args_ = args;
+    sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+    white_filter.op_type_ = sql::WHITE_OP_LI;
+    white_filter.expr_ = &like_expr;
+
+    ObMalloc mallocer;
+    mallocer.set_label("ColumnDecoder");
+    ObFixedArray<ObObj, ObIAllocator> objs(mallocer, 2);
+    objs.init(2);
+    ObObj pattern;
+    pattern.set_varchar(like_case.pattern_);
+    pattern.set_collation_type(like_case.cs_type_);
+    ObObj escape;
+    if (nullptr == like_case.escape_) {
+      escape.set_null();
+    } else {
+      escape.set_varchar(like_case.escape_);
+      escape.set_collation_type(like_case.cs_type_);
+    }
+    objs.push_back(pattern);
+    objs.push_back(escape);
+
+    ObBitmap result_bitmap(allocator_);
+    result_bitmap.init(ROW_CNT);
+    ASSERT_EQ(0, result_bitmap.popcnt());
+    ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(char_col_idx, is_retro_, decoder, white_filter,
+        result_bitmap, objs, like_case.need_padding_ ? &col_param : nullptr)) << "case: " << i;
+    ASSERT_EQ(like_case.result_count_, result_bitmap.popcnt()) << "case: " << i
+        << ", pattern: " << like_case.pattern_ << ", padding: " << like_case.need_padding_;
+  }
+}
+
 void TestColumnDecoder::batch_decode_to_datum_test(bool is_condensed)
 {
   ObDatumRow row;
@@ -588,6 +588,11 @@ TEST_F(TestConstDecoder, filter_push_down_in)
   }
 }
 
+TEST_F(TestConstDecoder, filter_push_down_like)
+{
+  filter_pushdown_like_test();
+}
+
 TEST_F(TestConstDecoder, batch_decode_to_datum_test_without_expection)
 {
   ObDatumRow row;
@@ -91,6 +91,16 @@ PUSHDOWN_GENERAL_TEST(TestDictDecoder);
 PUSHDOWN_GENERAL_TEST(TestRLEDecoder);
 PUSHDOWN_GENERAL_TEST(TestIntBaseDiffDecoder);
 
+TEST_F(TestDictDecoder, filter_pushdown_like_test)
+{
+  filter_pushdown_like_test();
+}
+
+TEST_F(TestRetroPDDecoder, filter_pushdown_like_test)
+{
+  filter_pushdown_like_test();
+}
+
 TEST_F(TestHexDecoder, basic_filter_pushdown_op_test_eq_ne_nu_nn)
 {
   basic_filter_pushdown_eq_ne_nu_nn_test();
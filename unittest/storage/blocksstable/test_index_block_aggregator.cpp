@@ -0,0 +1,303 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/blocksstable/ob_index_block_aggregator.h"
+#include "storage/blocksstable/ob_macro_block.h"
+#include "share/schema/ob_table_schema.h"
+#include "share/ob_cluster_version.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+using namespace share::schema;
+
+namespace unittest
+{
+class TestIndexBlockAggregator : public ::testing::Test
+{
+public:
+  static const int64_t TEST_ROW_CNT = 100;
+  TestIndexBlockAggregator() : allocator_(ObModIds::TEST), desc_() {}
+  void SetUp();
+  virtual void TearDown() {}
+  void prepare_table_schema(ObTableSchema &table_schema);
+  void generate_row(const int64_t seed, ObDatumRow &row);
+  void build_agg_row(ObIndexBlockAggregator &aggregator, char *&buf, int64_t &size);
+protected:
+  ObArenaAllocator allocator_;
+  ObDataStoreDesc desc_;
+  int64_t int_col_idx_;
+  int64_t str_col_idx_;
+  char str_buf_[TEST_ROW_CNT][ObIndexBlockAggregator::MAX_AGG_DATUM_LENGTH * 2];
+};
+
+void TestIndexBlockAggregator::prepare_table_schema(ObTableSchema &table_schema)
+{
+  const int64_t table_id = 3001;
+  ObColumnSchemaV2 column;
+  table_schema.reset();
+  ASSERT_EQ(OB_SUCCESS, table_schema.set_table_name("test_index_block_aggregator"));
+  table_schema.set_tenant_id(1);
+  table_schema.set_tablegroup_id(1);
+  table_schema.set_database_id(1);
+  table_schema.set_table_id(table_id);
+  table_schema.set_rowkey_column_num(1);
+  table_schema.set_max_used_column_id(OB_APP_MIN_COLUMN_ID + 2);
+  const ObObjType col_types[] = {ObIntType, ObIntType, ObVarcharType};
+  char name[OB_MAX_FILE_NAME_LENGTH];
+  for (int64_t i = 0; i < 3; ++i) {
+    column.reset();
+    column.set_table_id(table_id);
+    column.set_column_id(i + OB_APP_MIN_COLUMN_ID);
+    sprintf(name, "test%020ld", i);
+    ASSERT_EQ(OB_SUCCESS, column.set_column_name(name));
+    column.set_data_type(col_types[i]);
+    column.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+    column.set_rowkey_position(0 == i ? 1 : 0);
+    ASSERT_EQ(OB_SUCCESS, table_schema.add_column(column));
+  }
+}
+
+void TestIndexBlockAggregator::SetUp()
+{
+  ObTableSchema table_schema;
+  prepare_table_schema(table_schema);
+  ASSERT_EQ(OB_SUCCESS, desc_.init(table_schema, share::ObLSID(1), ObTabletID(1), MAJOR_MERGE, 1,
+                                   CLUSTER_CURRENT_VERSION));
+  // Stored columns: rowkey, multi-version columns, int column, varchar column
+  str_col_idx_ = desc_.col_desc_array_.count() - 1;
+  int_col_idx_ = str_col_idx_ - 1;
+  ASSERT_EQ(ObVarcharType, desc_.col_desc_array_.at(str_col_idx_).col_type_.get_type());
+  ASSERT_EQ(ObIntType, desc_.col_desc_array_.at(int_col_idx_).col_type_.get_type());
+}
+
+// int column is null for every 10th row, varchar column is "str_<seed>"
+void TestIndexBlockAggregator::generate_row(const int64_t seed, ObDatumRow &row)
+{
+  for (int64_t i = 0; i < row.get_column_count(); ++i) {
+    row.storage_datums_[i].reuse();
+    if (i == str_col_idx_) {
+      const int64_t len = sprintf(str_buf_[seed], "str_%04ld", seed);
+      row.storage_datums_[i].set_string(str_buf_[seed], len);
+    } else if (i == int_col_idx_ && 0 == seed % 10) {
+      row.storage_datums_[i].set_null();
+    } else {
+      row.storage_datums_[i].set_int(seed);
+    }
+  }
+}
+
+void TestIndexBlockAggregator::build_agg_row(
+    ObIndexBlockAggregator &aggregator,
+    char *&buf,
+    int64_t &size)
+{
+  int64_t pos = 0;
+  size = aggregator.get_agg_row_size();
+  ASSERT_TRUE(size > 0);
+  buf = static_cast<char *>(allocator_.alloc(size));
+  ASSERT_TRUE(nullptr != buf);
+  ASSERT_EQ(OB_SUCCESS, aggregator.write_agg_row(buf, size, pos));
+  ASSERT_EQ(size, pos);
+  ASSERT_EQ(OB_SUCCESS, ObAggRowReader::get_agg_row_length(buf, pos));
+  ASSERT_EQ(size, pos);
+}
+
+TEST_F(TestIndexBlockAggregator, test_eval_rows)
+{
+  ObIndexBlockAggregator aggregator;
+  ObDatumRow row;
+  char *buf = nullptr;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(desc_, allocator_));
+  ASSERT_EQ(OB_INIT_TWICE, aggregator.init(desc_, allocator_));
+  ASSERT_FALSE(aggregator.is_aggregated());
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, desc_.col_desc_array_.count()));
+  for (int64_t i = TEST_ROW_CNT - 1; i >= 0; --i) {
+    generate_row(i, row);
+    ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  }
+  ASSERT_TRUE(aggregator.is_aggregated());
+  ASSERT_EQ(TEST_ROW_CNT, aggregator.get_row_count());
+  build_agg_row(aggregator, buf, size);
+
+  ObAggRowReader reader;
+  ObAggColumnInfo col_info;
+  ASSERT_EQ(OB_SUCCESS, reader.init(buf, size));
+  ASSERT_EQ(desc_.col_desc_array_.count(), reader.get_column_count());
+
+  ASSERT_EQ(OB_SUCCESS, reader.read(0, col_info));
+  ASSERT_TRUE(col_info.has_min_max());
+  ASSERT_EQ(0, col_info.min_.get_int());
+  ASSERT_EQ(TEST_ROW_CNT - 1, col_info.max_.get_int());
+  ASSERT_EQ(0, col_info.null_count_);
+  ASSERT_EQ(AGG_SUM_INT, col_info.sum_type_);
+  ASSERT_EQ(TEST_ROW_CNT * (TEST_ROW_CNT - 1) / 2, col_info.int_sum_);
+
+  ASSERT_EQ(OB_SUCCESS, reader.read(int_col_idx_, col_info));
+  ASSERT_TRUE(col_info.has_min_max());
+  ASSERT_EQ(1, col_info.min_.get_int());
+  ASSERT_EQ(TEST_ROW_CNT - 1, col_info.max_.get_int());
+  ASSERT_EQ(TEST_ROW_CNT / 10, col_info.null_count_);
+
+  ASSERT_EQ(OB_SUCCESS, reader.read(str_col_idx_, col_info));
+  ASSERT_TRUE(col_info.has_min_max());
+  ASSERT_EQ(0, col_info.min_.get_string().compare("str_0000"));
+  ASSERT_EQ(0, col_info.max_.get_string().compare("str_0099"));
+  ASSERT_FALSE(col_info.has_sum());
+
+  ASSERT_EQ(OB_INDEX_OUT_OF_RANGE, reader.read(reader.get_column_count(), col_info));
+
+  aggregator.reuse();
+  ASSERT_FALSE(aggregator.is_aggregated());
+  ASSERT_EQ(0, aggregator.get_row_count());
+}
+
+TEST_F(TestIndexBlockAggregator, test_eval_agg_rows)
+{
+  ObIndexBlockAggregator child_aggregator;
+  ObIndexBlockAggregator parent_aggregator;
+  ObDatumRow row;
+  char *child_bufs[2] = {nullptr, nullptr};
+  int64_t child_sizes[2] = {0, 0};
+  char *buf = nullptr;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, child_aggregator.init(desc_, allocator_));
+  ASSERT_EQ(OB_SUCCESS, parent_aggregator.init(desc_, allocator_));
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, desc_.col_desc_array_.count()));
+  for (int64_t i = 0; i < 2; ++i) {
+    child_aggregator.reuse();
+    for (int64_t j = 0; j < TEST_ROW_CNT / 2; ++j) {
+      generate_row(i * TEST_ROW_CNT / 2 + j, row);
+      ASSERT_EQ(OB_SUCCESS, child_aggregator.eval(row));
+    }
+    build_agg_row(child_aggregator, child_bufs[i], child_sizes[i]);
+    ASSERT_EQ(OB_SUCCESS, parent_aggregator.eval(child_bufs[i], child_sizes[i], TEST_ROW_CNT / 2));
+  }
+  ASSERT_TRUE(parent_aggregator.is_aggregated());
+  ASSERT_EQ(TEST_ROW_CNT, parent_aggregator.get_row_count());
+  build_agg_row(parent_aggregator, buf, size);
+
+  ObAggRowReader reader;
+  ObAggColumnInfo col_info;
+  ASSERT_EQ(OB_SUCCESS, reader.init(buf, size));
+  ASSERT_EQ(OB_SUCCESS, reader.read(0, col_info));
+  ASSERT_EQ(0, col_info.min_.get_int());
+  ASSERT_EQ(TEST_ROW_CNT - 1, col_info.max_.get_int());
+  ASSERT_EQ(TEST_ROW_CNT * (TEST_ROW_CNT - 1) / 2, col_info.int_sum_);
+  ASSERT_EQ(OB_SUCCESS, reader.read(int_col_idx_, col_info));
+  ASSERT_EQ(TEST_ROW_CNT / 10, col_info.null_count_);
+  ASSERT_EQ(OB_SUCCESS, reader.read(str_col_idx_, col_info));
+  ASSERT_EQ(0, col_info.min_.get_string().compare("str_0000"));
+  ASSERT_EQ(0, col_info.max_.get_string().compare("str_0099"));
+}
+
+TEST_F(TestIndexBlockAggregator, test_abandon)
+{
+  ObIndexBlockAggregator aggregator;
+  ObDatumRow row;
+  char *buf = nullptr;
+  int64_t size = 0;
+  char long_str[ObIndexBlockAggregator::MAX_AGG_DATUM_LENGTH + 1];
+  MEMSET(long_str, 'a', sizeof(long_str));
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(desc_, allocator_));
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, desc_.col_desc_array_.count()));
+
+  // Long string only disables min/max of its column
+  generate_row(1, row);
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  row.storage_datums_[str_col_idx_].set_string(long_str, sizeof(long_str));
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  ASSERT_TRUE(aggregator.is_aggregated());
+  build_agg_row(aggregator, buf, size);
+  ObAggRowReader reader;
+  ObAggColumnInfo col_info;
+  ASSERT_EQ(OB_SUCCESS, reader.init(buf, size));
+  ASSERT_EQ(OB_SUCCESS, reader.read(str_col_idx_, col_info));
+  ASSERT_FALSE(col_info.has_min_max());
+  ASSERT_EQ(OB_SUCCESS, reader.read(0, col_info));
+  ASSERT_TRUE(col_info.has_min_max());
+
+  // Sum overflow only disables sum of its column
+  aggregator.reuse();
+  generate_row(1, row);
+  row.storage_datums_[0].set_int(INT64_MAX);
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  build_agg_row(aggregator, buf, size);
+  ASSERT_EQ(OB_SUCCESS, reader.init(buf, size));
+  ASSERT_EQ(OB_SUCCESS, reader.read(0, col_info));
+  ASSERT_FALSE(col_info.has_sum());
+  ASSERT_EQ(INT64_MAX, col_info.max_.get_int());
+
+  // Nop cell abandons the whole index row
+  aggregator.reuse();
+  generate_row(1, row);
+  row.storage_datums_[int_col_idx_].set_nop();
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  ASSERT_FALSE(aggregator.is_aggregated());
+  generate_row(2, row);
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  ASSERT_FALSE(aggregator.is_aggregated());
+  aggregator.reuse();
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  ASSERT_TRUE(aggregator.is_aggregated());
+}
+
+TEST_F(TestIndexBlockAggregator, test_pre_aggregation_gate)
+{
+  ObTableSchema table_schema;
+  prepare_table_schema(table_schema);
+  // compat mode of the table comes from the merge schema
+  ASSERT_EQ(lib::Worker::CompatMode::MYSQL, desc_.compat_mode_);
+  ASSERT_TRUE(desc_.need_pre_aggregation());
+  ASSERT_TRUE(desc_.col_desc_array_.count() <= ObIndexBlockAggregator::MAX_AGG_COLUMN_COUNT);
+
+  // servers of old version can not read the aggregated index row
+  ObDataStoreDesc old_desc;
+  ObIndexBlockAggregator aggregator;
+  ASSERT_EQ(OB_SUCCESS, old_desc.init(table_schema, share::ObLSID(1), ObTabletID(1), MAJOR_MERGE, 1,
+                                      CLUSTER_VERSION_4_0_0_0));
+  ASSERT_FALSE(old_desc.need_pre_aggregation());
+  ASSERT_EQ(OB_INVALID_ARGUMENT, aggregator.init(old_desc, allocator_));
+
+  // no compat mode, no pre-aggregation
+  ObDataStoreDesc copied_desc;
+  ASSERT_EQ(OB_SUCCESS, copied_desc.assign(desc_));
+  ASSERT_TRUE(copied_desc.need_pre_aggregation());
+  copied_desc.compat_mode_ = lib::Worker::CompatMode::INVALID;
+  ASSERT_FALSE(copied_desc.need_pre_aggregation());
+  ASSERT_EQ(OB_INVALID_ARGUMENT, aggregator.init(copied_desc, allocator_));
+
+  ObDataStoreDesc minor_desc;
+  ASSERT_EQ(OB_SUCCESS, minor_desc.init(table_schema, share::ObLSID(1), ObTabletID(1), MINOR_MERGE, 1));
+  ASSERT_FALSE(minor_desc.need_pre_aggregation());
+  ASSERT_EQ(OB_INVALID_ARGUMENT, aggregator.init(minor_desc, allocator_));
+  ASSERT_FALSE(aggregator.is_inited());
+}
+
+}//end namespace unittest
+}//end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_index_block_aggregator.log");
+  OB_LOGGER.set_file_name("test_index_block_aggregator.log", true, true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -10,9 +10,15 @@
  * See the Mulan PubL v2 for more details.
  */
 
+#define private public
+#define protected public
 #include "storage/memtable/mvcc/ob_mvcc_row.h"
+#include "storage/memtable/ob_memtable_context.h"
+#include "storage/memtable/ob_memtable_data.h"
+#include "storage/tx/ob_trans_part_ctx.h"
 
 #include <gtest/gtest.h>
+#include <thread>
 
 namespace oceanbase
 {
@@ -20,6 +26,7 @@ namespace unittest
 {
 using namespace oceanbase::common;
 using namespace oceanbase::memtable;
+using namespace oceanbase::transaction;
 
 TEST(TestObMemtableValue, smoke_test)
 {
@@ -29,6 +36,286 @@ TEST(TestObMemtableValue, smoke_test)
   fprintf(stdout, "mr=[%s]\n", to_cstring(mr, true));
 }
 
+class TestMvccRowConcurrentWrite : public ::testing::Test
+{
+public:
+  static const int64_t THREAD_CNT = 8;
+  static const int64_t WRITE_CNT_PER_THREAD = 2000;
+
+  TestMvccRowConcurrentWrite() : allocator_(ObModIds::TEST) {}
+  virtual void SetUp() override
+  {
+    row_.reset();
+    for (int64_t i = 0; i < ARRAYSIZEOF(trans_ctx_); ++i) {
+      trans_ctx_[i].trans_id_ = ObTransID(1000 + i);
+      mt_ctx_[i].set_trans_ctx(&trans_ctx_[i]);
+    }
+  }
+  virtual void TearDown() override
+  {
+    for (int64_t i = 0; i < ARRAYSIZEOF(trans_ctx_); ++i) {
+      mt_ctx_[i].set_trans_ctx(NULL);
+    }
+    allocator_.reset();
+  }
+
+  ObMvccTransNode *alloc_node(const ObTransID &tx_id, const int64_t seq_no)
+  {
+    ObMvccTransNode *node = NULL;
+    void *buf = allocator_.alloc(sizeof(ObMvccTransNode) + sizeof(ObMemtableDataHeader));
+    if (NULL != buf) {
+      node = new (buf) ObMvccTransNode();
+      new (node->buf_) ObMemtableDataHeader(blocksstable::ObDmlFlag::DF_UPDATE, 0);
+      node->tx_id_ = tx_id;
+      node->seq_no_ = seq_no;
+    }
+    return node;
+  }
+
+  // the writes of every thread are prepared ahead so that threads only
+  // contend on the row latch
+  void prepare_nodes(const int64_t thread_idx,
+                     const ObTransID &tx_id,
+                     ObMvccTransNode **nodes)
+  {
+    for (int64_t i = 0; i < WRITE_CNT_PER_THREAD; ++i) {
+      nodes[i] = alloc_node(tx_id, thread_idx * WRITE_CNT_PER_THREAD + i);
+      ASSERT_TRUE(NULL != nodes[i]);
+    }
+  }
+
+  // walk the row from newest to oldest and check the links, the node count
+  // and the modify count sequence
+  void check_row(const int64_t expected_cnt, const ObTransID &expected_tx_id)
+  {
+    int64_t cnt = 0;
+    ObMvccTransNode *iter = row_.list_head_;
+    ObMvccTransNode *newer = NULL;
+    while (NULL != iter) {
+      EXPECT_EQ(newer, iter->next_);
+      EXPECT_EQ(expected_tx_id, iter->tx_id_);
+      if (NULL != iter->prev_) {
+        EXPECT_EQ(iter->prev_->modify_count_ + 1, iter->modify_count_);
+      } else {
+        EXPECT_EQ(0, iter->modify_count_);
+      }
+      newer = iter;
+      iter = iter->prev_;
+      ++cnt;
+    }
+    EXPECT_EQ(expected_cnt, cnt);
+    EXPECT_EQ(expected_cnt, row_.total_trans_node_cnt_);
+  }
+
+  // the number of writes published to the combiner for the row
+  int64_t published_cnt(const ObMvccRow &row)
+  {
+    int64_t cnt = 0;
+    ObMvccWriteCombiner &combiner = ObMvccWriteCombiner::get_instance();
+    ObMvccWriteRequest *req = ATOMIC_LOAD(&combiner.get_slot_(row).head_);
+    for (; NULL != req; req = req->next_) {
+      if (&req->row_ == &row) {
+        ++cnt;
+      }
+    }
+    return cnt;
+  }
+
+  void wait_published(const ObMvccRow &row, const int64_t expected_cnt)
+  {
+    while (published_cnt(row) < expected_cnt) {
+      usleep(100);
+    }
+  }
+
+  ObMvccRow row_;
+  ObPartTransCtx trans_ctx_[2];
+  ObMemtableCtx mt_ctx_[2];
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestMvccRowConcurrentWrite, same_tx_contended_write)
+{
+  ObMvccTransNode *nodes[THREAD_CNT][WRITE_CNT_PER_THREAD];
+  for (int64_t t = 0; t < THREAD_CNT; ++t) {
+    prepare_nodes(t, mt_ctx_[0].get_tx_id(), nodes[t]);
+  }
+
+  int64_t fail_cnt = 0;
+  std::thread threads[THREAD_CNT];
+  for (int64_t t = 0; t < THREAD_CNT; ++t) {
+    threads[t] = std::thread([&, t]() {
+      for (int64_t i = 0; i < WRITE_CNT_PER_THREAD; ++i) {
+        ObMvccWriteResult res;
+        if (OB_SUCCESS != row_.mvcc_write_(mt_ctx_[0], *nodes[t][i], 0, res)
+            || !res.can_insert_
+            || !res.need_insert_
+            || nodes[t][i] != res.tx_node_) {
+          ATOMIC_INC(&fail_cnt);
+        }
+      }
+    });
+  }
+  for (int64_t t = 0; t < THREAD_CNT; ++t) {
+    threads[t].join();
+  }
+
+  EXPECT_EQ(0, fail_cnt);
+  check_row(THREAD_CNT * WRITE_CNT_PER_THREAD, mt_ctx_[0].get_tx_id());
+}
+
+TEST_F(TestMvccRowConcurrentWrite, different_tx_contended_write)
+{
+  ObMvccTransNode *nodes[THREAD_CNT][WRITE_CNT_PER_THREAD];
+  for (int64_t t = 0; t < THREAD_CNT; ++t) {
+    prepare_nodes(t, mt_ctx_[t % 2].get_tx_id(), nodes[t]);
+  }
+
+  // only the tx who writes the row first owns the row lock, the writes of the
+  // other tx must all fail with the owner reported in the lock state
+  int64_t insert_cnt[2] = {0, 0};
+  int64_t conflict_cnt[2] = {0, 0};
+  int64_t fail_cnt = 0;
+  std::thread threads[THREAD_CNT];
+  for (int64_t t = 0; t < THREAD_CNT; ++t) {
+    threads[t] = std::thread([&, t]() {
+      ObMemtableCtx &ctx = mt_ctx_[t % 2];
+      for (int64_t i = 0; i < WRITE_CNT_PER_THREAD; ++i) {
+        ObMvccWriteResult res;
+        if (OB_SUCCESS != row_.mvcc_write_(ctx, *nodes[t][i], 0, res)) {
+          ATOMIC_INC(&fail_cnt);
+        } else if (res.can_insert_ && res.need_insert_) {
+          ATOMIC_INC(&insert_cnt[t % 2]);
+        } else if (!res.can_insert_
+                   && res.lock_state_.is_locked_
+                   && res.lock_state_.lock_trans_id_ == mt_ctx_[1 - t % 2].get_tx_id()) {
+          ATOMIC_INC(&conflict_cnt[t % 2]);
+        } else {
+          ATOMIC_INC(&fail_cnt);
+        }
+      }
+    });
+  }
+  for (int64_t t = 0; t < THREAD_CNT; ++t) {
+    threads[t].join();
+  }
+
+  const int64_t total_cnt = THREAD_CNT * WRITE_CNT_PER_THREAD;
+  const int64_t owner = 0 == insert_cnt[1] ? 0 : 1;
+  EXPECT_EQ(0, fail_cnt);
+  EXPECT_EQ(total_cnt / 2, insert_cnt[owner]);
+  EXPECT_EQ(0, conflict_cnt[owner]);
+  EXPECT_EQ(0, insert_cnt[1 - owner]);
+  EXPECT_EQ(total_cnt / 2, conflict_cnt[1 - owner]);
+  check_row(total_cnt / 2, mt_ctx_[owner].get_tx_id());
+}
+
+TEST_F(TestMvccRowConcurrentWrite, combine_published_writes)
+{
+  ObMvccTransNode *nodes[THREAD_CNT];
+  for (int64_t t = 0; t < THREAD_CNT; ++t) {
+    nodes[t] = alloc_node(mt_ctx_[0].get_tx_id(), t);
+    ASSERT_TRUE(NULL != nodes[t]);
+  }
+
+  // the writers can not get the latch, so they publish their writes and the
+  // latch holder executes all of them within one latch hold
+  int64_t fail_cnt = 0;
+  row_.latch_.lock();
+  std::thread threads[THREAD_CNT];
+  for (int64_t t = 0; t < THREAD_CNT; ++t) {
+    threads[t] = std::thread([&, t]() {
+      ObMvccWriteResult res;
+      if (OB_SUCCESS != row_.mvcc_write_(mt_ctx_[0], *nodes[t], 0, res)
+          || !res.can_insert_
+          || !res.need_insert_
+          || nodes[t] != res.tx_node_) {
+        ATOMIC_INC(&fail_cnt);
+      }
+    });
+  }
+  wait_published(row_, THREAD_CNT);
+  EXPECT_EQ(THREAD_CNT, ObMvccWriteCombiner::get_instance().combine(row_));
+  EXPECT_EQ(0, published_cnt(row_));
+  row_.latch_.unlock();
+  for (int64_t t = 0; t < THREAD_CNT; ++t) {
+    threads[t].join();
+  }
+
+  EXPECT_EQ(0, fail_cnt);
+  check_row(THREAD_CNT, mt_ctx_[0].get_tx_id());
+}
+
+TEST_F(TestMvccRowConcurrentWrite, combine_only_writes_of_own_row)
+{
+  // find two rows whose writes are published to the same slot
+  const int64_t ROW_CNT = ObMvccWriteCombiner::SLOT_COUNT + 1;
+  ObMvccWriteCombiner &combiner = ObMvccWriteCombiner::get_instance();
+  ObMvccRow *rows = new ObMvccRow[ROW_CNT];
+  ObMvccRow *row_a = &rows[0];
+  ObMvccRow *row_b = NULL;
+  for (int64_t i = 1; NULL == row_b && i < ROW_CNT; ++i) {
+    if (&combiner.get_slot_(rows[i]) == &combiner.get_slot_(*row_a)) {
+      row_b = &rows[i];
+    }
+  }
+  ASSERT_TRUE(NULL != row_b);
+
+  ObMvccTransNode *node_a = alloc_node(mt_ctx_[0].get_tx_id(), 1);
+  ObMvccTransNode *node_b = alloc_node(mt_ctx_[1].get_tx_id(), 1);
+  ASSERT_TRUE(NULL != node_a && NULL != node_b);
+  ObMvccWriteResult res_a;
+  ObMvccWriteResult res_b;
+  int ret_a = OB_ERR_UNEXPECTED;
+  int ret_b = OB_ERR_UNEXPECTED;
+  row_a->latch_.lock();
+  row_b->latch_.lock();
+  std::thread writer_a([&]() { ret_a = row_a->mvcc_write_(mt_ctx_[0], *node_a, 0, res_a); });
+  std::thread writer_b([&]() { ret_b = row_b->mvcc_write_(mt_ctx_[1], *node_b, 0, res_b); });
+  wait_published(*row_a, 1);
+  wait_published(*row_b, 1);
+
+  // the holder of row a leaves the write of row b in the slot
+  EXPECT_EQ(1, combiner.combine(*row_a));
+  EXPECT_EQ(0, published_cnt(*row_a));
+  EXPECT_EQ(1, published_cnt(*row_b));
+  EXPECT_EQ(node_a, row_a->list_head_);
+  EXPECT_TRUE(NULL == row_b->list_head_);
+  row_a->latch_.unlock();
+  writer_a.join();
+  EXPECT_EQ(OB_SUCCESS, ret_a);
+
+  EXPECT_EQ(1, combiner.combine(*row_b));
+  row_b->latch_.unlock();
+  writer_b.join();
+  EXPECT_EQ(OB_SUCCESS, ret_b);
+  EXPECT_EQ(node_b, row_b->list_head_);
+  EXPECT_EQ(node_b, res_b.tx_node_);
+  delete [] rows;
+}
+
+TEST_F(TestMvccRowConcurrentWrite, blocked_writer_combines_itself)
+{
+  ObMvccTransNode *node = alloc_node(mt_ctx_[0].get_tx_id(), 1);
+  ASSERT_TRUE(NULL != node);
+  ObMvccWriteResult res;
+  int ret = OB_ERR_UNEXPECTED;
+
+  // the latch is released by a holder who does not combine, the writer must
+  // still finish its write after it gives up spinning
+  row_.latch_.lock();
+  std::thread writer([&]() { ret = row_.mvcc_write_(mt_ctx_[0], *node, 0, res); });
+  wait_published(row_, 1);
+  usleep(100 * 1000);
+  row_.latch_.unlock();
+  writer.join();
+
+  EXPECT_EQ(OB_SUCCESS, ret);
+  EXPECT_EQ(0, published_cnt(row_));
+  EXPECT_EQ(node, res.tx_node_);
+  check_row(1, mt_ctx_[0].get_tx_id());
+}
+
 }
 }
 
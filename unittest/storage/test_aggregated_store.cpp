@@ -0,0 +1,581 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/access/ob_aggregated_store.h"
+#include "storage/access/ob_table_read_info.h"
+#include "storage/blocksstable/ob_index_block_aggregator.h"
+#include "storage/blocksstable/ob_macro_block.h"
+#include "storage/blocksstable/ob_micro_block_row_scanner.h"
+#include "storage/blocksstable/encoding/ob_micro_block_encoder.h"
+#include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
+#include "share/schema/ob_table_schema.h"
+#include "share/ob_cluster_version.h"
+#include "sql/engine/ob_exec_context.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+using namespace share::schema;
+
+namespace unittest
+{
+class TestAggregatedStore : public ::testing::Test
+{
+public:
+  static const int64_t TEST_ROW_CNT = 100;
+  TestAggregatedStore()
+    : allocator_(ObModIds::TEST), desc_(), int_param_(allocator_), uint_param_(allocator_),
+      str_param_(allocator_) {}
+  void SetUp();
+  virtual void TearDown() {}
+  void prepare_table_schema(ObTableSchema &table_schema);
+  void generate_row(const int64_t seed, ObDatumRow &row);
+  void build_agg_row(ObIndexBlockAggregator &aggregator, char *&buf, int64_t &size);
+  void build_micro_block(ObMicroBlockDecoder &decoder);
+  // pre-aggregate the rows of @seeds into the index info of one micro block
+  void build_index_info(const int64_t *seeds, const int64_t seed_cnt,
+                        ObIndexBlockRowHeader &row_header, ObMicroIndexInfo &index_info);
+  void filter_by_pre_agg_data(const ObMicroIndexInfo &index_info,
+                              const sql::ObWhiteFilterOperatorType op_type,
+                              const int64_t col_idx,
+                              const ObObj *refs,
+                              const int64_t ref_cnt,
+                              bool &filtered,
+                              bool &all_true);
+protected:
+  ObArenaAllocator allocator_;
+  ObTableSchema table_schema_;
+  ObDataStoreDesc desc_;
+  ObArray<ObColDesc> col_descs_;
+  ObTableReadInfo read_info_;
+  ObMicroBlockEncoder encoder_;
+  ObColumnParam int_param_;
+  ObColumnParam uint_param_;
+  ObColumnParam str_param_;
+  sql::ObExpr number_expr_;
+  sql::ObExpr synopsis_expr_;
+  int64_t int_col_idx_;
+  int64_t str_col_idx_;
+  char str_buf_[TEST_ROW_CNT][16];
+};
+
+void TestAggregatedStore::prepare_table_schema(ObTableSchema &table_schema)
+{
+  const int64_t table_id = 3001;
+  ObColumnSchemaV2 column;
+  table_schema.reset();
+  ASSERT_EQ(OB_SUCCESS, table_schema.set_table_name("test_aggregated_store"));
+  table_schema.set_tenant_id(1);
+  table_schema.set_tablegroup_id(1);
+  table_schema.set_database_id(1);
+  table_schema.set_table_id(table_id);
+  table_schema.set_rowkey_column_num(1);
+  table_schema.set_max_used_column_id(OB_APP_MIN_COLUMN_ID + 2);
+  table_schema.set_block_size(2 * 1024);
+  table_schema.set_compress_func_name("none");
+  table_schema.set_row_store_type(ENCODING_ROW_STORE);
+  table_schema.set_storage_format_version(OB_STORAGE_FORMAT_VERSION_V4);
+  const ObObjType col_types[] = {ObIntType, ObIntType, ObVarcharType};
+  char name[OB_MAX_FILE_NAME_LENGTH];
+  for (int64_t i = 0; i < 3; ++i) {
+    column.reset();
+    column.set_table_id(table_id);
+    column.set_column_id(i + OB_APP_MIN_COLUMN_ID);
+    sprintf(name, "test%020ld", i);
+    ASSERT_EQ(OB_SUCCESS, column.set_column_name(name));
+    column.set_data_type(col_types[i]);
+    column.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+    column.set_rowkey_position(0 == i ? 1 : 0);
+    ASSERT_EQ(OB_SUCCESS, table_schema.add_column(column));
+  }
+}
+
+void TestAggregatedStore::SetUp()
+{
+  prepare_table_schema(table_schema_);
+  ASSERT_EQ(OB_SUCCESS, desc_.init(table_schema_, share::ObLSID(1), ObTabletID(1), MAJOR_MERGE, 1,
+                                   CLUSTER_CURRENT_VERSION));
+  ASSERT_EQ(OB_SUCCESS, table_schema_.get_multi_version_column_descs(col_descs_));
+  ASSERT_EQ(OB_SUCCESS, read_info_.init(allocator_,
+                                        table_schema_.get_column_count(),
+                                        table_schema_.get_rowkey_column_num(),
+                                        lib::is_oracle_mode(),
+                                        col_descs_,
+                                        true));
+  // Stored columns: rowkey, multi-version columns, int column, varchar column
+  str_col_idx_ = col_descs_.count() - 1;
+  int_col_idx_ = str_col_idx_ - 1;
+  ASSERT_EQ(ObVarcharType, col_descs_.at(str_col_idx_).col_type_.get_type());
+  ASSERT_EQ(ObIntType, col_descs_.at(int_col_idx_).col_type_.get_type());
+
+  int_param_.set_meta_type(col_descs_.at(int_col_idx_).col_type_);
+  ObObjMeta uint_meta;
+  uint_meta.set_uint64();
+  uint_param_.set_meta_type(uint_meta);
+  str_param_.set_meta_type(col_descs_.at(str_col_idx_).col_type_);
+  number_expr_.datum_meta_.type_ = ObNumberType;
+  synopsis_expr_.datum_meta_.type_ = ObVarcharType;
+}
+
+// int column is null for every 10th row, varchar column is "str_<seed>"
+void TestAggregatedStore::generate_row(const int64_t seed, ObDatumRow &row)
+{
+  for (int64_t i = 0; i < row.get_column_count(); ++i) {
+    row.storage_datums_[i].reuse();
+    if (i == str_col_idx_) {
+      const int64_t len = sprintf(str_buf_[seed], "str_%04ld", seed);
+      row.storage_datums_[i].set_string(str_buf_[seed], len);
+    } else if (i == int_col_idx_ && 0 == seed % 10) {
+      row.storage_datums_[i].set_null();
+    } else {
+      row.storage_datums_[i].set_int(seed);
+    }
+  }
+}
+
+void TestAggregatedStore::build_agg_row(
+    ObIndexBlockAggregator &aggregator,
+    char *&buf,
+    int64_t &size)
+{
+  int64_t pos = 0;
+  size = aggregator.get_agg_row_size();
+  ASSERT_TRUE(size > 0);
+  buf = static_cast<char *>(allocator_.alloc(size));
+  ASSERT_TRUE(nullptr != buf);
+  ASSERT_EQ(OB_SUCCESS, aggregator.write_agg_row(buf, size, pos));
+}
+
+void TestAggregatedStore::build_micro_block(ObMicroBlockDecoder &decoder)
+{
+  ObMicroBlockEncodingCtx ctx;
+  ObDatumRow row;
+  char *buf = nullptr;
+  int64_t size = 0;
+  ctx.micro_block_size_ = 64L << 11;
+  ctx.macro_block_size_ = 2L << 20;
+  ctx.rowkey_column_cnt_ = read_info_.get_rowkey_count();
+  ctx.column_cnt_ = col_descs_.count();
+  ctx.col_descs_ = &col_descs_;
+  ctx.row_store_type_ = common::ENCODING_ROW_STORE;
+  ASSERT_EQ(OB_SUCCESS, encoder_.init(ctx));
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, col_descs_.count()));
+  for (int64_t i = 0; i < TEST_ROW_CNT; ++i) {
+    generate_row(i, row);
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+}
+
+void TestAggregatedStore::build_index_info(
+    const int64_t *seeds,
+    const int64_t seed_cnt,
+    ObIndexBlockRowHeader &row_header,
+    ObMicroIndexInfo &index_info)
+{
+  ObIndexBlockAggregator aggregator;
+  ObDatumRow row;
+  char *buf = nullptr;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(desc_, allocator_));
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, desc_.col_desc_array_.count()));
+  for (int64_t i = 0; i < seed_cnt; ++i) {
+    generate_row(seeds[i], row);
+    ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  }
+  build_agg_row(aggregator, buf, size);
+  row_header.row_count_ = seed_cnt;
+  row_header.set_major_node();
+  row_header.set_pre_aggregated();
+  index_info.row_header_ = &row_header;
+  index_info.agg_row_buf_ = buf;
+  index_info.agg_buf_size_ = size;
+  ASSERT_TRUE(index_info.is_pre_aggregated());
+}
+
+void TestAggregatedStore::filter_by_pre_agg_data(
+    const ObMicroIndexInfo &index_info,
+    const sql::ObWhiteFilterOperatorType op_type,
+    const int64_t col_idx,
+    const ObObj *refs,
+    const int64_t ref_cnt,
+    bool &filtered,
+    bool &all_true)
+{
+  const int64_t row_count = index_info.row_header_->row_count_;
+  sql::ObExecContext exec_ctx(allocator_);
+  sql::ObEvalCtx eval_ctx(exec_ctx);
+  sql::ObPushdownExprSpec expr_spec(allocator_);
+  sql::ObPushdownOperator op(eval_ctx, expr_spec);
+  sql::ObPushdownWhiteFilterNode filter_node(allocator_);
+  filter_node.op_type_ = op_type;
+  sql::ObWhiteFilterExecutor filter(allocator_, filter_node, op);
+  ASSERT_EQ(OB_SUCCESS, filter.col_offsets_.init(1));
+  ASSERT_EQ(OB_SUCCESS, filter.col_params_.init(1));
+  ASSERT_EQ(OB_SUCCESS, filter.col_offsets_.push_back(static_cast<int32_t>(col_idx)));
+  ASSERT_EQ(OB_SUCCESS, filter.col_params_.push_back(nullptr));
+  filter.n_cols_ = 1;
+  ASSERT_EQ(OB_SUCCESS, filter.params_.init(2));
+  for (int64_t i = 0; i < ref_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, filter.params_.push_back(refs[i]));
+  }
+
+  ObMicroBlockReader reader;
+  reader.row_count_ = row_count;
+  ObMicroBlockRowScanner scanner(allocator_);
+  scanner.read_info_ = &read_info_;
+  scanner.reader_ = &reader;
+  scanner.index_info_ = &index_info;
+  ObBitmap bitmap(allocator_);
+  ASSERT_EQ(OB_SUCCESS, bitmap.init(row_count));
+  ASSERT_EQ(OB_SUCCESS, scanner.filter_by_pre_agg_data(filter, bitmap, filtered));
+  all_true = filtered && row_count == bitmap.popcnt();
+  if (filtered) {
+    ASSERT_TRUE(all_true || 0 == bitmap.popcnt());
+  }
+  scanner.reader_ = nullptr;
+  scanner.index_info_ = nullptr;
+}
+
+TEST_F(TestAggregatedStore, test_sum_overflow_to_number)
+{
+  ObDatumRow row;
+  number::ObNumber result;
+  number::ObNumber expected;
+  char buf[number::ObNumber::MAX_CALC_BYTE_LEN * 4];
+  ObDataBuffer local_alloc(buf, sizeof(buf));
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, 1));
+
+  // int64 partial sums spill into number on overflow in both directions
+  ObSumAggCell int_cell(0, &int_param_, &number_expr_, allocator_);
+  ASSERT_EQ(OB_SUCCESS, int_cell.init());
+  const int64_t int_values[] = {INT64_MAX, INT64_MAX, 2, INT64_MIN, INT64_MIN, INT64_MIN, -1};
+  for (int64_t i = 0; i < ARRAYSIZEOF(int_values); ++i) {
+    row.storage_datums_[0].set_int(int_values[i]);
+    ASSERT_EQ(OB_SUCCESS, int_cell.process(row));
+  }
+  row.storage_datums_[0].set_null();
+  ASSERT_EQ(OB_SUCCESS, int_cell.process(row));
+  ASSERT_TRUE(int_cell.has_value_);
+  ASSERT_EQ(OB_SUCCESS, int_cell.get_number_sum(result, local_alloc));
+  // 2 * (2^63 - 1) + 2 - 3 * 2^63 - 1 = -2^63 - 1
+  ASSERT_EQ(OB_SUCCESS, expected.from("-9223372036854775809", local_alloc));
+  ASSERT_EQ(0, result.compare(expected)) << result.format() << std::endl;
+
+  ObSumAggCell uint_cell(0, &uint_param_, &number_expr_, allocator_);
+  ASSERT_EQ(OB_SUCCESS, uint_cell.init());
+  for (int64_t i = 0; i < 3; ++i) {
+    row.storage_datums_[0].set_uint(UINT64_MAX);
+    ASSERT_EQ(OB_SUCCESS, uint_cell.process(row));
+  }
+  local_alloc.free();
+  ASSERT_EQ(OB_SUCCESS, uint_cell.get_number_sum(result, local_alloc));
+  ASSERT_EQ(OB_SUCCESS, expected.from("55340232221128654845", local_alloc));
+  ASSERT_EQ(0, result.compare(expected)) << result.format() << std::endl;
+
+  uint_cell.reuse();
+  ASSERT_FALSE(uint_cell.has_value_);
+  local_alloc.free();
+  ASSERT_EQ(OB_SUCCESS, uint_cell.get_number_sum(result, local_alloc));
+  ASSERT_TRUE(result.is_zero());
+}
+
+TEST_F(TestAggregatedStore, test_min_max_from_index_info)
+{
+  ObIndexBlockAggregator aggregator;
+  ObIndexBlockRowHeader row_header;
+  ObMicroIndexInfo index_info;
+  ObDatumRow row;
+  char *buf = nullptr;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(desc_, allocator_));
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, desc_.col_desc_array_.count()));
+  for (int64_t i = TEST_ROW_CNT - 1; i >= 0; --i) {
+    generate_row(i, row);
+    ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  }
+  build_agg_row(aggregator, buf, size);
+  row_header.row_count_ = TEST_ROW_CNT;
+  row_header.set_pre_aggregated();
+  index_info.row_header_ = &row_header;
+  index_info.agg_row_buf_ = buf;
+  index_info.agg_buf_size_ = size;
+  index_info.set_blockscan();
+  ASSERT_TRUE(index_info.is_pre_aggregated());
+
+  ObMinMaxAggCell min_cell(int_col_idx_, &int_param_, nullptr, allocator_, true);
+  ObMinMaxAggCell max_cell(int_col_idx_, &int_param_, nullptr, allocator_, false);
+  ObMinMaxAggCell str_max_cell(str_col_idx_, &str_param_, nullptr, allocator_, false);
+  ObSumAggCell sum_cell(int_col_idx_, &int_param_, &number_expr_, allocator_);
+  ObCountAggCell count_cell(int_col_idx_, &int_param_, nullptr, allocator_, true);
+  ObApproxCountDistinctAggCell ndv_cell(int_col_idx_, &int_param_, &synopsis_expr_, allocator_);
+  ObAggCell *cells[] = {&min_cell, &max_cell, &str_max_cell, &sum_cell, &count_cell, &ndv_cell};
+  ASSERT_EQ(OB_SUCCESS, min_cell.init());
+  ASSERT_EQ(OB_SUCCESS, max_cell.init());
+  ASSERT_EQ(OB_SUCCESS, str_max_cell.init());
+  ASSERT_EQ(OB_SUCCESS, sum_cell.init());
+  ASSERT_EQ(OB_SUCCESS, ndv_cell.init());
+  for (int64_t i = 0; i < ARRAYSIZEOF(cells); ++i) {
+    ASSERT_FALSE(cells[i]->can_use_index_info(index_info));
+    cells[i]->set_stored_col_idx(cells[i]->get_col_idx());
+  }
+
+  // the sketch can not be built from pre-aggregated data
+  ASSERT_FALSE(ndv_cell.can_use_index_info(index_info));
+  ASSERT_EQ(OB_ERR_UNEXPECTED, ndv_cell.process(index_info));
+  for (int64_t i = 0; i < ARRAYSIZEOF(cells) - 1; ++i) {
+    ASSERT_TRUE(cells[i]->can_use_index_info(index_info)) << "i: " << i << std::endl;
+    // aggregate the same block twice
+    ASSERT_EQ(OB_SUCCESS, cells[i]->process(index_info));
+    ASSERT_EQ(OB_SUCCESS, cells[i]->process(index_info));
+  }
+  ASSERT_EQ(1, min_cell.datum_.get_int());
+  ASSERT_EQ(TEST_ROW_CNT - 1, max_cell.datum_.get_int());
+  ASSERT_EQ(0, str_max_cell.datum_.get_string().compare("str_0099"));
+  ASSERT_EQ(2 * (TEST_ROW_CNT * (TEST_ROW_CNT - 1) / 2 - 450), sum_cell.int_sum_);
+  ASSERT_EQ(2 * (TEST_ROW_CNT - TEST_ROW_CNT / 10), count_cell.row_count_);
+
+  // all cells of the int column are null
+  aggregator.reuse();
+  for (int64_t i = 0; i < TEST_ROW_CNT; i += 10) {
+    generate_row(i, row);
+    ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  }
+  build_agg_row(aggregator, buf, size);
+  row_header.row_count_ = TEST_ROW_CNT / 10;
+  index_info.agg_row_buf_ = buf;
+  index_info.agg_buf_size_ = size;
+  min_cell.reuse();
+  sum_cell.reuse();
+  for (int64_t i = 0; i < ARRAYSIZEOF(cells); ++i) {
+    ASSERT_TRUE(cells[i]->can_use_index_info(index_info)) << "i: " << i << std::endl;
+  }
+  ASSERT_EQ(OB_SUCCESS, min_cell.process(index_info));
+  ASSERT_EQ(OB_SUCCESS, sum_cell.process(index_info));
+  ASSERT_EQ(OB_SUCCESS, ndv_cell.process(index_info));
+  ASSERT_TRUE(min_cell.datum_.is_null());
+  ASSERT_FALSE(sum_cell.has_value_);
+}
+
+TEST_F(TestAggregatedStore, test_batch_process)
+{
+  ObMicroBlockDecoder decoder;
+  ObDatumRow row;
+  int64_t row_ids[TEST_ROW_CNT];
+  build_micro_block(decoder);
+  ASSERT_EQ(ObIMicroBlockReader::Decoder, decoder.get_type());
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, col_descs_.count()));
+
+  // cells aggregated by batch decode and by rows
+  ObMinMaxAggCell min_cells[2] = {
+      {static_cast<int32_t>(int_col_idx_), &int_param_, nullptr, allocator_, true},
+      {static_cast<int32_t>(int_col_idx_), &int_param_, nullptr, allocator_, true}};
+  ObMinMaxAggCell max_cells[2] = {
+      {static_cast<int32_t>(str_col_idx_), &str_param_, nullptr, allocator_, false},
+      {static_cast<int32_t>(str_col_idx_), &str_param_, nullptr, allocator_, false}};
+  ObSumAggCell sum_cells[2] = {
+      {static_cast<int32_t>(int_col_idx_), &int_param_, &number_expr_, allocator_},
+      {static_cast<int32_t>(int_col_idx_), &int_param_, &number_expr_, allocator_}};
+  ObApproxCountDistinctAggCell ndv_cells[2] = {
+      {static_cast<int32_t>(str_col_idx_), &str_param_, &synopsis_expr_, allocator_},
+      {static_cast<int32_t>(str_col_idx_), &str_param_, &synopsis_expr_, allocator_}};
+  for (int64_t i = 0; i < 2; ++i) {
+    ASSERT_EQ(OB_SUCCESS, min_cells[i].init());
+    ASSERT_EQ(OB_SUCCESS, max_cells[i].init());
+    ASSERT_EQ(OB_SUCCESS, sum_cells[i].init());
+    ASSERT_EQ(OB_SUCCESS, ndv_cells[i].init());
+  }
+  ObAggCell *batch_cells[] = {&min_cells[0], &max_cells[0], &sum_cells[0], &ndv_cells[0]};
+  ObAggCell *row_cells[] = {&min_cells[1], &max_cells[1], &sum_cells[1], &ndv_cells[1]};
+  const int64_t batch_size = TEST_ROW_CNT / 4;
+  for (int64_t i = 0; i < ARRAYSIZEOF(batch_cells); ++i) {
+    ASSERT_EQ(OB_SUCCESS, batch_cells[i]->init_batch_buf(batch_size));
+    ASSERT_EQ(OB_INIT_TWICE, batch_cells[i]->init_batch_buf(batch_size));
+  }
+
+  // skip the first and last rows
+  int64_t row_count = 0;
+  for (int64_t i = 1; i < TEST_ROW_CNT - 1; ++i) {
+    row_ids[row_count++] = i;
+    ASSERT_EQ(OB_SUCCESS, decoder.get_row(i, row));
+    for (int64_t j = 0; j < ARRAYSIZEOF(row_cells); ++j) {
+      ASSERT_EQ(OB_SUCCESS, row_cells[j]->process(row));
+    }
+  }
+  for (int64_t i = 0; i < row_count; i += batch_size) {
+    const int64_t cur_count = MIN(batch_size, row_count - i);
+    for (int64_t j = 0; j < ARRAYSIZEOF(batch_cells); ++j) {
+      ASSERT_EQ(OB_SUCCESS, batch_cells[j]->process(&decoder, row_ids + i, cur_count));
+    }
+  }
+  ASSERT_EQ(OB_INVALID_ARGUMENT, sum_cells[0].process(&decoder, row_ids, batch_size + 1));
+
+  ASSERT_EQ(1, min_cells[0].datum_.get_int());
+  ASSERT_EQ(0, max_cells[0].datum_.get_string().compare("str_0098"));
+  ASSERT_EQ(min_cells[1].datum_.get_int(), min_cells[0].datum_.get_int());
+  ASSERT_EQ(0, max_cells[1].datum_.get_string().compare(max_cells[0].datum_.get_string()));
+  ASSERT_TRUE(sum_cells[0].has_value_);
+  ASSERT_EQ(sum_cells[1].int_sum_, sum_cells[0].int_sum_);
+  ASSERT_EQ(TEST_ROW_CNT * (TEST_ROW_CNT - 1) / 2 - 450 - (TEST_ROW_CNT - 1), sum_cells[0].int_sum_);
+  ASSERT_EQ(ndv_cells[1].llc_size_, ndv_cells[0].llc_size_);
+  ASSERT_EQ(0, MEMCMP(ndv_cells[1].llc_bitmap_, ndv_cells[0].llc_bitmap_, ndv_cells[0].llc_size_));
+  bool has_bucket = false;
+  for (int64_t i = 0; !has_bucket && i < ndv_cells[0].llc_size_; ++i) {
+    has_bucket = 0 != ndv_cells[0].llc_bitmap_[i];
+  }
+  ASSERT_TRUE(has_bucket);
+
+  ndv_cells[0].reuse();
+  for (int64_t i = 0; i < ndv_cells[0].llc_size_; ++i) {
+    ASSERT_EQ(0, ndv_cells[0].llc_bitmap_[i]);
+  }
+}
+
+TEST_F(TestAggregatedStore, test_filter_by_pre_agg_data)
+{
+  ObIndexBlockRowHeader row_header;
+  ObMicroIndexInfo index_info;
+  int64_t seeds[TEST_ROW_CNT];
+  bool filtered = false;
+  bool all_true = false;
+  ObObj refs[2];
+  // rowkey column is 0..99, int column is 1..99 with 10 nulls
+  for (int64_t i = 0; i < TEST_ROW_CNT; ++i) {
+    seeds[i] = i;
+  }
+  build_index_info(seeds, TEST_ROW_CNT, row_header, index_info);
+
+  // out of min/max, the micro block is skipped
+  refs[0].set_int(TEST_ROW_CNT * 2);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_EQ, 0, refs, 1, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_FALSE(all_true);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_GE, 0, refs, 1, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_FALSE(all_true);
+  refs[0].set_int(0);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_LT, 0, refs, 1, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_FALSE(all_true);
+
+  // covering min/max, every row is selected without decoding
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_GE, 0, refs, 1, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_TRUE(all_true);
+  refs[0].set_int(-10);
+  refs[1].set_int(TEST_ROW_CNT * 2);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_BT, 0, refs, 2, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_TRUE(all_true);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_NN, 0, refs, 0, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_TRUE(all_true);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_NU, 0, refs, 0, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_FALSE(all_true);
+
+  // inside min/max, the rows must be decoded
+  refs[0].set_int(TEST_ROW_CNT / 2);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_GT, 0, refs, 1, filtered, all_true);
+  ASSERT_FALSE(filtered);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_EQ, 0, refs, 1, filtered, all_true);
+  ASSERT_FALSE(filtered);
+  // not equal is never decided by min/max
+  refs[0].set_int(TEST_ROW_CNT * 2);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_NE, 0, refs, 1, filtered, all_true);
+  ASSERT_FALSE(filtered);
+
+  // null cells of the int column fail the comparison though min/max is covered
+  refs[0].set_int(0);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_GE, int_col_idx_, refs, 1, filtered, all_true);
+  ASSERT_FALSE(filtered);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_NU, int_col_idx_, refs, 0, filtered, all_true);
+  ASSERT_FALSE(filtered);
+
+  // index row is not pre-aggregated
+  row_header.is_pre_aggregated_ = 0;
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_GE, 0, refs, 1, filtered, all_true);
+  ASSERT_FALSE(filtered);
+}
+
+TEST_F(TestAggregatedStore, test_filter_by_pre_agg_data_special_blocks)
+{
+  ObIndexBlockRowHeader row_header;
+  ObMicroIndexInfo index_info;
+  int64_t seeds[TEST_ROW_CNT / 10];
+  bool filtered = false;
+  bool all_true = false;
+  ObObj ref;
+
+  // all the rows are equal
+  for (int64_t i = 0; i < ARRAYSIZEOF(seeds); ++i) {
+    seeds[i] = 7;
+  }
+  build_index_info(seeds, ARRAYSIZEOF(seeds), row_header, index_info);
+  ref.set_int(7);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_EQ, 0, &ref, 1, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_TRUE(all_true);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_LE, int_col_idx_, &ref, 1, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_TRUE(all_true);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_GT, 0, &ref, 1, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_FALSE(all_true);
+  ref.set_int(8);
+  filter_by_pre_agg_data(index_info, sql::WHITE_OP_EQ, 0, &ref, 1, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_FALSE(all_true);
+
+  // all cells of the int column are null
+  for (int64_t i = 0; i < ARRAYSIZEOF(seeds); ++i) {
+    seeds[i] = i * 10;
+  }
+  ObIndexBlockRowHeader null_row_header;
+  ObMicroIndexInfo null_index_info;
+  build_index_info(seeds, ARRAYSIZEOF(seeds), null_row_header, null_index_info);
+  ref.set_int(10);
+  filter_by_pre_agg_data(null_index_info, sql::WHITE_OP_EQ, int_col_idx_, &ref, 1, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_FALSE(all_true);
+  filter_by_pre_agg_data(null_index_info, sql::WHITE_OP_GE, int_col_idx_, &ref, 1, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_FALSE(all_true);
+  filter_by_pre_agg_data(null_index_info, sql::WHITE_OP_NU, int_col_idx_, &ref, 0, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_TRUE(all_true);
+  filter_by_pre_agg_data(null_index_info, sql::WHITE_OP_NN, int_col_idx_, &ref, 0, filtered, all_true);
+  ASSERT_TRUE(filtered);
+  ASSERT_FALSE(all_true);
+  // the rowkey column of the same block is still decided by min/max
+  filter_by_pre_agg_data(null_index_info, sql::WHITE_OP_GE, 0, &ref, 1, filtered, all_true);
+  ASSERT_FALSE(filtered);
+}
+
+}//end namespace unittest
+}//end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_aggregated_store.log");
+  OB_LOGGER.set_file_name("test_aggregated_store.log", true, true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -800,6 +800,80 @@ TEST_F(TestCompactionPolicy, check_no_need_minor_merge)
   ASSERT_EQ(OB_NO_NEED_MERGE, ret);
 }
 
+TEST_F(TestCompactionPolicy, check_read_aware_mini_minor_merge)
+{
+  int ret = OB_SUCCESS;
+  ObTenantFreezeInfoMgr *mgr = MTL(ObTenantFreezeInfoMgr *);
+  ASSERT_TRUE(nullptr != mgr);
+
+  ASSERT_EQ(1, ObPartitionMergePolicy::cal_read_aware_minor_compact_trigger(2, TABLET_READ_HOT));
+  ASSERT_EQ(0, ObPartitionMergePolicy::cal_read_aware_minor_compact_trigger(0, TABLET_READ_HOT));
+  ASSERT_EQ(4, ObPartitionMergePolicy::cal_read_aware_minor_compact_trigger(2, TABLET_READ_COLD));
+  ASSERT_EQ(0, ObPartitionMergePolicy::cal_read_aware_minor_compact_trigger(0, TABLET_READ_COLD));
+  ASSERT_EQ(16, ObPartitionMergePolicy::cal_read_aware_minor_compact_trigger(16, TABLET_READ_COLD));
+
+  common::ObArray<ObTenantFreezeInfoMgr::FreezeInfo> freeze_info;
+  common::ObArray<share::ObSnapshotInfo> snapshots;
+  ASSERT_EQ(OB_SUCCESS, freeze_info.push_back(ObTenantFreezeInfoMgr::FreezeInfo(1, 1, 0)));
+
+  ret = TestCompactionPolicy::prepare_freeze_info(500, freeze_info, snapshots);
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  // two mini sstables do not reach the default minor_compact_trigger
+  const char *key_data =
+      "table_type    start_scn    end_scn    max_ver    upper_ver\n"
+      "10            0            1          1          1        \n"
+      "11            1            150        150        150      \n"
+      "11            150          200        200        200      \n";
+
+  ret = prepare_tablet(key_data, 200, 200);
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  bool need_merge = false;
+  ret = ObPartitionMergePolicy::check_need_mini_minor_merge(*tablet_handle_.get_obj(), need_merge);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_FALSE(need_merge);
+  ret = ObPartitionMergePolicy::check_need_read_aware_mini_minor_merge(*tablet_handle_.get_obj(), TABLET_READ_HOT, need_merge);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_TRUE(need_merge);
+  ret = ObPartitionMergePolicy::check_need_read_aware_mini_minor_merge(*tablet_handle_.get_obj(), TABLET_READ_COLD, need_merge);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_FALSE(need_merge);
+}
+
+TEST_F(TestCompactionPolicy, check_read_cold_mini_minor_merge)
+{
+  int ret = OB_SUCCESS;
+  ObTenantFreezeInfoMgr *mgr = MTL(ObTenantFreezeInfoMgr *);
+  ASSERT_TRUE(nullptr != mgr);
+
+  common::ObArray<ObTenantFreezeInfoMgr::FreezeInfo> freeze_info;
+  common::ObArray<share::ObSnapshotInfo> snapshots;
+  ASSERT_EQ(OB_SUCCESS, freeze_info.push_back(ObTenantFreezeInfoMgr::FreezeInfo(1, 1, 0)));
+
+  ret = TestCompactionPolicy::prepare_freeze_info(500, freeze_info, snapshots);
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  // three mini sstables exceed the default minor_compact_trigger but not the deferred one
+  const char *key_data =
+      "table_type    start_scn    end_scn    max_ver    upper_ver\n"
+      "10            0            1          1          1        \n"
+      "11            1            150        150        150      \n"
+      "11            150          200        200        200      \n"
+      "11            200          250        250        250      \n";
+
+  ret = prepare_tablet(key_data, 250, 250);
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  bool need_merge = false;
+  ret = ObPartitionMergePolicy::check_need_mini_minor_merge(*tablet_handle_.get_obj(), need_merge);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_TRUE(need_merge);
+  ret = ObPartitionMergePolicy::check_need_read_aware_mini_minor_merge(*tablet_handle_.get_obj(), TABLET_READ_COLD, need_merge);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_FALSE(need_merge);
+}
+
 TEST_F(TestCompactionPolicy, check_major_merge_basic)
 {
   int ret = OB_SUCCESS;
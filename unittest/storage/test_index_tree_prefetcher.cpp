@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/access/ob_index_tree_prefetcher.h"
+#include "storage/access/ob_table_access_context.h"
+#include "storage/blocksstable/ob_sstable.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+
+namespace unittest
+{
+class TestIndexTreePrefetcher : public ::testing::Test
+{
+public:
+  static const int64_t ROWKEY_CNT = 5;
+  TestIndexTreePrefetcher() {}
+  virtual void SetUp();
+  virtual void TearDown();
+protected:
+  ObSSTable sstable_;
+  ObTableAccessContext access_ctx_;
+  ObStorageDatum datums_[ROWKEY_CNT];
+  ObSEArray<ObDatumRowkey, ROWKEY_CNT> rowkeys_;
+  ObIndexTreeMultiPassPrefetcher prefetcher_;
+};
+
+void TestIndexTreePrefetcher::SetUp()
+{
+  // no macro block in the sstable, it is empty
+  ASSERT_TRUE(sstable_.get_meta().is_empty());
+  access_ctx_.query_flag_.use_row_cache_ = ObQueryFlag::UseCache;
+  ASSERT_TRUE(access_ctx_.enable_get_row_cache());
+  for (int64_t i = 0; i < ROWKEY_CNT; ++i) {
+    datums_[i].set_int(i);
+    ASSERT_EQ(OB_SUCCESS, rowkeys_.push_back(ObDatumRowkey(&datums_[i], 1)));
+  }
+  prefetcher_.is_inited_ = true;
+  prefetcher_.sstable_ = &sstable_;
+  prefetcher_.access_ctx_ = &access_ctx_;
+  prefetcher_.iter_type_ = ObStoreRowIterator::IteratorMultiGet;
+  prefetcher_.rowkeys_ = &rowkeys_;
+}
+
+void TestIndexTreePrefetcher::TearDown()
+{
+  prefetcher_.is_inited_ = false;
+  prefetcher_.sstable_ = nullptr;
+  prefetcher_.access_ctx_ = nullptr;
+  prefetcher_.rowkeys_ = nullptr;
+}
+
+TEST_F(TestIndexTreePrefetcher, multi_get_empty_sstable)
+{
+  // every rowkey of the multi get is answered without touching the row cache or the index tree
+  for (int64_t i = 0; i < ROWKEY_CNT; ++i) {
+    ObSSTableReadHandle read_handle;
+    read_handle.is_get_ = true;
+    read_handle.range_idx_ = i;
+    read_handle.rowkey_ = &rowkeys_.at(i);
+    ASSERT_EQ(OB_SUCCESS, prefetcher_.lookup_in_cache_batch(read_handle));
+    EXPECT_EQ(ObSSTableRowState::NOT_EXIST, read_handle.row_state_);
+  }
+  EXPECT_EQ(prefetcher_.row_cache_batch_begin_, prefetcher_.row_cache_batch_end_);
+
+  // same answer when the row cache is not used
+  access_ctx_.query_flag_.use_row_cache_ = ObQueryFlag::DoNotUseCache;
+  ObSSTableReadHandle read_handle;
+  read_handle.is_get_ = true;
+  read_handle.range_idx_ = 0;
+  read_handle.rowkey_ = &rowkeys_.at(0);
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.lookup_in_cache_batch(read_handle));
+  EXPECT_EQ(ObSSTableRowState::NOT_EXIST, read_handle.row_state_);
+}
+
+TEST_F(TestIndexTreePrefetcher, multi_get_invalid_argument)
+{
+  ObSSTableReadHandle read_handle;
+  read_handle.range_idx_ = 0;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, prefetcher_.lookup_in_cache_batch(read_handle));
+
+  prefetcher_.is_inited_ = false;
+  read_handle.rowkey_ = &rowkeys_.at(0);
+  EXPECT_EQ(OB_NOT_INIT, prefetcher_.lookup_in_cache_batch(read_handle));
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_index_tree_prefetcher.log*");
+  OB_LOGGER.set_file_name("test_index_tree_prefetcher.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -795,6 +795,97 @@ TEST_F(TestIOManager, simple)
   ASSERT_SUCC(THE_IO_DEVICE->close(fd));
 }
 
+TEST_F(TestIOManager, io_uring)
+{
+  // replace the libaio channels, the device channel falls back to libaio if io_uring is not supported
+  ObIOManager &io_mgr = ObIOManager::get_instance();
+  ASSERT_SUCC(io_mgr.remove_device_channel(THE_IO_DEVICE));
+  ASSERT_SUCC(io_mgr.add_device_channel(THE_IO_DEVICE, 4, 2, 1024, ASYNC_IO_URING));
+  ObDeviceChannel *device_channel = nullptr;
+  ASSERT_SUCC(io_mgr.get_device_channel(THE_IO_DEVICE, device_channel));
+  ASSERT_NE(nullptr, device_channel);
+  if (ASYNC_IO_URING != device_channel->io_engine_) {
+    std::cout << "[  SKIPPED ] io_uring is not supported by this kernel or build, "
+              << "device channel fell back to libaio" << std::endl;
+    return;
+  }
+  ObIOUringChannel *uring_channel = nullptr;
+  for (int64_t i = 0; i < device_channel->async_channels_.count(); ++i) {
+    uring_channel = dynamic_cast<ObIOUringChannel *>(device_channel->async_channels_.at(i));
+    ASSERT_NE(nullptr, uring_channel);
+    ASSERT_TRUE(uring_channel->io_uring_.is_inited());
+  }
+
+  ObIOFd fd;
+  ASSERT_SUCC(THE_IO_DEVICE->open(TEST_ROOT_DIR "/test_io_file", O_CREAT | O_DIRECT | O_TRUNC | O_RDWR, 0644, fd));
+  ASSERT_TRUE(fd.is_valid());
+  const int64_t FILE_SIZE = 4 * 1024 * 1024;
+  ASSERT_SUCC(THE_IO_DEVICE->fallocate(fd, 0, 0, FILE_SIZE));
+
+  const int64_t io_timeout_ms = 1000L * 5L;
+  const int64_t io_size = DIO_READ_ALIGN_SIZE * 4;
+  ObIOInfo io_info;
+  io_info.tenant_id_ = 500;
+  io_info.fd_ = fd;
+  io_info.flag_.set_category(ObIOCategory::USER_IO);
+  io_info.flag_.set_wait_event(100);
+  io_info.size_ = io_size;
+  char buf[io_size] = { 0 };
+  for (int64_t i = 0; i < 8; ++i) {
+    memset(buf, 'a' + i, io_size);
+    io_info.flag_.set_write();
+    io_info.offset_ = i * io_size;
+    io_info.buf_ = buf;
+    ASSERT_SUCC(io_mgr.write(io_info, io_timeout_ms));
+  }
+  ObIOHandle io_handles[8];
+  io_info.flag_.set_read();
+  io_info.buf_ = nullptr;
+  for (int64_t i = 0; i < 8; ++i) {
+    io_info.offset_ = i * io_size;
+    ASSERT_SUCC(io_mgr.aio_read(io_info, io_handles[i]));
+  }
+  for (int64_t i = 0; i < 8; ++i) {
+    ASSERT_SUCC(io_handles[i].wait(io_timeout_ms));
+    ASSERT_EQ(io_size, io_handles[i].get_data_size());
+    memset(buf, 'a' + i, io_size);
+    ASSERT_EQ(0, memcmp(buf, io_handles[i].get_buffer(), io_size));
+    io_handles[i].reset();
+  }
+
+  // cancel in-flight reads, canceled or not, every request must come back from the ring
+  for (int64_t i = 0; i < 8; ++i) {
+    io_info.offset_ = i * io_size;
+    ASSERT_SUCC(io_mgr.aio_read(io_info, io_handles[i]));
+  }
+  for (int64_t i = 0; i < 8; i += 2) {
+    io_handles[i].cancel();
+  }
+  for (int64_t i = 1; i < 8; i += 2) {
+    ASSERT_SUCC(io_handles[i].wait(io_timeout_ms));
+    ASSERT_EQ(io_size, io_handles[i].get_data_size());
+    memset(buf, 'a' + i, io_size);
+    ASSERT_EQ(0, memcmp(buf, io_handles[i].get_buffer(), io_size));
+  }
+  for (int64_t i = 0; i < 8; ++i) {
+    io_handles[i].reset();
+  }
+  const int64_t wait_end_ts = ObTimeUtility::current_time() + io_timeout_ms * 1000L;
+  int64_t queue_count = 0;
+  do {
+    queue_count = 0;
+    for (int64_t i = 0; i < device_channel->async_channels_.count(); ++i) {
+      queue_count += device_channel->async_channels_.at(i)->get_queue_count();
+    }
+    if (queue_count > 0) {
+      ob_usleep(1000L);
+    }
+  } while (queue_count > 0 && ObTimeUtility::current_time() < wait_end_ts);
+  ASSERT_EQ(0, queue_count);
+  ASSERT_EQ(0, device_channel->used_io_depth_);
+  ASSERT_SUCC(THE_IO_DEVICE->close(fd));
+}
+
 
 struct IOPerfDevice
 {
@@ -72,9 +72,11 @@ public:
   int scan_secondary_meta(ObIAllocator &allocator, ObSSTableSecMetaIterator *&meta_iter);
   int add_macro_block_meta(const int64_t endkey);
   int from(const ObString &str);
-  void reset() { endkeys_.reset(); }
+  int set_occupy_sizes(const ObString &str);
+  void reset() { endkeys_.reset(); occupy_sizes_.reset(); }
 private:
   ObSEArray<ObStorageDatum, 64> endkeys_;
+  ObSEArray<int64_t, 64> occupy_sizes_;
 };
 
 int ObMockSSTableSecMetaIterator::get_next(ObDataMacroBlockMeta &macro_meta)
@@ -92,7 +94,7 @@ int ObMockSSTableSecMetaIterator::get_next(ObDataMacroBlockMeta &macro_meta)
     meta.val_.rowkey_count_ = ROWKEY_COLUMN_NUM;
     meta.val_.column_count_ = ROWKEY_COLUMN_NUM + 1;
     meta.val_.micro_block_count_ = 1;
-    meta.val_.occupy_size_ = 100;
+    meta.val_.occupy_size_ = sstable_->occupy_sizes_.empty() ? 100 : sstable_->occupy_sizes_.at(macro_block_idx_);
     meta.val_.original_size_ = 100;
     meta.val_.data_zsize_ = 100;
     meta.val_.logic_id_.tablet_id_ = 1;
@@ -152,6 +154,31 @@ int ObMockSSTableV2::from(const ObString &str)
   return ret;
 }
 
+int ObMockSSTableV2::set_occupy_sizes(const ObString &str)
+{
+  int ret = OB_SUCCESS;
+  occupy_sizes_.reset();
+  const char *pos1 = str.ptr(), *pos2 = nullptr;
+  int64_t num = 0;
+  while (OB_SUCC(ret) && *pos1 != '\0') {
+    if (OB_FAIL(get_number(pos1, pos2, num))) {
+      STORAGE_LOG(WARN, "failed to get number", KR(ret), K(pos1));
+    } else if (OB_FAIL(occupy_sizes_.push_back(num))) {
+      STORAGE_LOG(WARN, "failed to push occupy size", KR(ret), K(num));
+    } else {
+      while (*pos2 != '\0' && (*pos2 == ' ' || *pos2 == ','))
+        ++pos2;
+      pos1 = pos2;
+      pos2 = nullptr;
+    }
+  }
+  if (OB_SUCC(ret) && occupy_sizes_.count() != endkeys_.count()) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "occupy sizes mismatch macro blocks", KR(ret), K(occupy_sizes_.count()), K(endkeys_.count()));
+  }
+  return ret;
+}
+
 int ObMockSSTableV2::scan_secondary_meta(ObIAllocator &allocator, ObSSTableSecMetaIterator *&meta_iter)
 {
   int ret = OB_SUCCESS;
@@ -234,6 +261,9 @@ private:
   int check_ranges_result(const ObIArray<ObStoreRange> &ranges, const ObString &result, bool &equal);
   void inner_test_split_ranges(int64_t tablet_size, int64_t macro_block_count, int64_t row_count,
                                const ObString &ranges_str, const ObString &split_ranges);
+  void inner_test_split_ranges_by_weight(int64_t tablet_size, int64_t macro_block_count,
+                                         const ObString &ranges_str, const ObString &sizes_str,
+                                         const ObString &split_ranges);
 
 private:
   common::ObArenaAllocator allocator_;
@@ -357,6 +387,28 @@ void TestPartitionMajorSSTableRangeSliter::inner_test_split_ranges(
   ASSERT_TRUE(equal);
 }
 
+void TestPartitionMajorSSTableRangeSliter::inner_test_split_ranges_by_weight(
+    int64_t tablet_size, int64_t macro_block_count,
+    const ObString &macro_block_str, const ObString &sizes_str, const ObString &split_ranges)
+{
+  bool equal = false;
+  common::ObSEArray<common::ObStoreRange, 64> range_array;
+  common::ObSEArray<int64_t, 64> range_row_cnts;
+  ObMockPartitionMajorSSTableRangeSpliter range_spliter;
+
+  int64_t occupy_size = macro_block_count * OB_SERVER_BLOCK_MGR.get_macro_block_size();
+  set_major_sstable_meta(macro_block_count, occupy_size, macro_block_count);
+  ASSERT_EQ(OB_SUCCESS, set_major_sstable_macro_blocks(macro_block_str));
+  ASSERT_EQ(OB_SUCCESS, major_sstable_.set_occupy_sizes(sizes_str));
+
+  ASSERT_EQ(OB_SUCCESS, range_spliter.init(*full_read_info_.get_index_read_info(), &major_sstable_, tablet_size, allocator_));
+  ASSERT_EQ(OB_SUCCESS, range_spliter.split_ranges(range_array, range_row_cnts));
+  ASSERT_EQ(range_array.count(), range_row_cnts.count());
+  ASSERT_EQ(OB_SUCCESS, check_ranges_result(range_array, split_ranges, equal));
+  ASSERT_TRUE(equal);
+  reset_major_sstable();
+}
+
 TEST_F(TestPartitionMajorSSTableRangeSliter, test_tablet_size_0)
 {
   EXPECT_NO_FATAL_FAILURE(inner_test_split_ranges(0/*tablet_size*/, 0/*macro_block_count*/, 0/*row_count*/,
@@ -408,6 +460,26 @@ TEST_F(TestPartitionMajorSSTableRangeSliter, test_split_ranges)
     "12400,12800"));
 }
 
+TEST_F(TestPartitionMajorSSTableRangeSliter, test_split_ranges_by_weight)
+{
+  // the large macro block at the end makes up a range by itself
+  EXPECT_NO_FATAL_FAILURE(inner_test_split_ranges_by_weight(2, 8,
+    "100,200,300,400,500,600,700,800",
+    "100,100,100,100,100,100,100,900",
+    "400,700"));
+  // the large macro block at the beginning makes up a range by itself, and the rest are
+  // split evenly over the remaining ranges
+  EXPECT_NO_FATAL_FAILURE(inner_test_split_ranges_by_weight(2, 8,
+    "100,200,300,400,500,600,700,800",
+    "1000,100,100,100,100,100,100,100",
+    "100,300,600"));
+  // macro blocks of the same size are split evenly
+  EXPECT_NO_FATAL_FAILURE(inner_test_split_ranges_by_weight(2, 8,
+    "100,200,300,400,500,600,700,800",
+    "100,100,100,100,100,100,100,100",
+    "200,400,600"));
+}
+
 }  // namespace storage
 }  // namespace oceanbase
 
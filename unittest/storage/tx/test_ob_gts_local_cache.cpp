@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+#include "storage/tx/ob_gts_local_cache.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace transaction;
+namespace unittest
+{
+
+class TestObGtsLocalCache : public ::testing::Test
+{
+public:
+  virtual void SetUp() { cache_.reset(); }
+  virtual void TearDown() { cache_.reset(); }
+protected:
+  ObGTSLocalCache cache_;
+};
+
+TEST_F(TestObGtsLocalCache, try_update_latest_srr)
+{
+  bool updated = false;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, cache_.try_update_latest_srr(MonotonicTs(0), MonotonicTs(10), updated));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, cache_.try_update_latest_srr(MonotonicTs(10), MonotonicTs(0), updated));
+  EXPECT_FALSE(updated);
+
+  EXPECT_EQ(OB_SUCCESS, cache_.try_update_latest_srr(MonotonicTs(10), MonotonicTs(10), updated));
+  EXPECT_TRUE(updated);
+  EXPECT_EQ(10, cache_.get_latest_srr().mts_);
+  // a request sent at 10 covers stc 8, no need to send another
+  EXPECT_EQ(OB_SUCCESS, cache_.try_update_latest_srr(MonotonicTs(8), MonotonicTs(20), updated));
+  EXPECT_FALSE(updated);
+  EXPECT_EQ(10, cache_.get_latest_srr().mts_);
+  // never goes backwards
+  EXPECT_EQ(OB_SUCCESS, cache_.try_update_latest_srr(MonotonicTs(15), MonotonicTs(5), updated));
+  EXPECT_FALSE(updated);
+  EXPECT_EQ(10, cache_.get_latest_srr().mts_);
+  EXPECT_EQ(OB_SUCCESS, cache_.try_update_latest_srr(MonotonicTs(15), MonotonicTs(20), updated));
+  EXPECT_TRUE(updated);
+  EXPECT_EQ(20, cache_.get_latest_srr().mts_);
+}
+
+TEST_F(TestObGtsLocalCache, concurrent_update_latest_srr)
+{
+  static const int64_t THREAD_COUNT = 8;
+  static const int64_t LOOP_COUNT = 200000;
+  int64_t clock = 1;
+  int64_t max_updated_srr = 0;
+  int64_t error_count = 0;
+  int64_t backwards_count = 0;
+  int64_t uncovered_count = 0;
+  bool stop = false;
+
+  // latest_srr observed by a reader must never go backwards
+  std::thread checker([&]() {
+    int64_t last_srr = 0;
+    while (!ATOMIC_LOAD(&stop)) {
+      const int64_t cur_srr = cache_.get_latest_srr().mts_;
+      if (cur_srr < last_srr) {
+        ATOMIC_INC(&backwards_count);
+      }
+      last_srr = cur_srr;
+    }
+  });
+
+  std::vector<std::thread> workers;
+  for (int64_t idx = 0; idx < THREAD_COUNT; ++idx) {
+    workers.emplace_back([&, idx]() {
+      for (int64_t i = 0; i < LOOP_COUNT; ++i) {
+        const int64_t now = ATOMIC_AAF(&clock, 1);
+        const MonotonicTs stc(std::max(now - (i + idx) % 8, 1L));
+        const MonotonicTs srr(now);
+        bool updated = false;
+        if (0 == i % 4) {
+          // the rpc path updates latest_srr unconditionally
+          if (OB_SUCCESS != cache_.update_latest_srr(srr)) {
+            ATOMIC_INC(&error_count);
+          }
+        } else if (OB_SUCCESS != cache_.try_update_latest_srr(stc, srr, updated)) {
+          ATOMIC_INC(&error_count);
+        } else if (updated) {
+          inc_update(&max_updated_srr, now);
+        } else if (cache_.get_latest_srr() < stc) {
+          // not updated only if a request covering stc has been sent
+          ATOMIC_INC(&uncovered_count);
+        }
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  ATOMIC_STORE(&stop, true);
+  checker.join();
+
+  EXPECT_EQ(0, error_count);
+  EXPECT_EQ(0, backwards_count);
+  EXPECT_EQ(0, uncovered_count);
+  EXPECT_GE(cache_.get_latest_srr().mts_, max_updated_srr);
+  EXPECT_LE(cache_.get_latest_srr().mts_, clock);
+}
+
+}//end of unittest
+}//end of oceanbase
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  system("rm -f test_ob_gts_local_cache.log*");
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_gts_local_cache.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}
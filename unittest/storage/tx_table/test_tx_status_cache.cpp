@@ -0,0 +1,249 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define protected public
+#define private public
+
+#include <thread>
+#include "storage/tx_table/ob_tx_data_table.h"
+#include "storage/tx_table/ob_tx_data_memtable_mgr.h"
+
+namespace oceanbase
+{
+using namespace ::testing;
+using namespace transaction;
+using namespace storage;
+
+namespace unittest
+{
+
+class TestTxStatusCache : public ::testing::Test
+{
+public:
+  typedef ObTxDataTable::TxStatusCache TxStatusCache;
+
+  virtual void SetUp() override
+  {
+    ObMemAttr mem_attr;
+    mem_attr.label_ = "TX_DATA_TABLE";
+    ASSERT_EQ(OB_SUCCESS, cache_.init(mem_attr));
+  }
+  virtual void TearDown() override
+  {
+    cache_.destroy();
+  }
+
+  // the commit version and log ts are derived from the tx id, so that a reader can tell a
+  // torn read of a slot
+  static void make_tx_data(const int64_t tx_id, const int32_t state, ObTxData &tx_data)
+  {
+    tx_data.reset();
+    tx_data.tx_id_ = ObTransID(tx_id);
+    tx_data.state_ = state;
+    tx_data.commit_version_ = tx_id * 10;
+    tx_data.start_log_ts_ = tx_id * 10 + 1;
+    tx_data.end_log_ts_ = tx_id * 10 + 2;
+  }
+
+  static bool is_consistent(const ObTxCommitData &commit_data)
+  {
+    const int64_t tx_id = commit_data.tx_id_.get_id();
+    return commit_data.commit_version_ == tx_id * 10
+        && commit_data.start_log_ts_ == tx_id * 10 + 1
+        && commit_data.end_log_ts_ == tx_id * 10 + 2;
+  }
+
+  // find another tx id which is mapped to the same slot of tx_id
+  int64_t find_conflict_tx_id(const int64_t tx_id)
+  {
+    int64_t conflict_tx_id = tx_id + 1;
+    while (&cache_.slot_(ObTransID(conflict_tx_id)) != &cache_.slot_(ObTransID(tx_id))) {
+      conflict_tx_id++;
+    }
+    return conflict_tx_id;
+  }
+
+  TxStatusCache cache_;
+};
+
+TEST_F(TestTxStatusCache, hit)
+{
+  ObTxData tx_data;
+  ObTxCommitData commit_data;
+
+  make_tx_data(1001, ObTxData::COMMIT, tx_data);
+  cache_.put(tx_data);
+  ASSERT_TRUE(cache_.get(ObTransID(1001), commit_data));
+  EXPECT_EQ(ObTransID(1001), commit_data.tx_id_);
+  EXPECT_EQ(ObTxData::COMMIT, commit_data.state_);
+  EXPECT_TRUE(is_consistent(commit_data));
+
+  make_tx_data(1002, ObTxData::ABORT, tx_data);
+  cache_.put(tx_data);
+  ASSERT_TRUE(cache_.get(ObTransID(1002), commit_data));
+  EXPECT_EQ(ObTxData::ABORT, commit_data.state_);
+  EXPECT_TRUE(is_consistent(commit_data));
+}
+
+TEST_F(TestTxStatusCache, miss)
+{
+  ObTxData tx_data;
+  ObTxCommitData commit_data;
+
+  // never put
+  EXPECT_FALSE(cache_.get(ObTransID(2001), commit_data));
+
+  // undecided tx is not cached
+  make_tx_data(2002, ObTxData::RUNNING, tx_data);
+  cache_.put(tx_data);
+  EXPECT_FALSE(cache_.get(ObTransID(2002), commit_data));
+  make_tx_data(2003, ObTxData::ELR_COMMIT, tx_data);
+  cache_.put(tx_data);
+  EXPECT_FALSE(cache_.get(ObTransID(2003), commit_data));
+
+  // tx with undo actions is not cached since they are not kept in the cache
+  ObUndoStatusNode undo_node;
+  make_tx_data(2004, ObTxData::COMMIT, tx_data);
+  tx_data.undo_status_list_.head_ = &undo_node;
+  cache_.put(tx_data);
+  tx_data.undo_status_list_.head_ = nullptr;
+  EXPECT_FALSE(cache_.get(ObTransID(2004), commit_data));
+
+  // not inited cache always misses
+  TxStatusCache empty_cache;
+  make_tx_data(2005, ObTxData::COMMIT, tx_data);
+  empty_cache.put(tx_data);
+  EXPECT_FALSE(empty_cache.get(ObTransID(2005), commit_data));
+}
+
+TEST_F(TestTxStatusCache, overwrite_by_conflict_tx)
+{
+  ObTxData tx_data;
+  ObTxCommitData commit_data;
+  const int64_t tx_id = 3001;
+  const int64_t conflict_tx_id = find_conflict_tx_id(tx_id);
+
+  make_tx_data(tx_id, ObTxData::COMMIT, tx_data);
+  cache_.put(tx_data);
+  ASSERT_TRUE(cache_.get(ObTransID(tx_id), commit_data));
+  EXPECT_FALSE(cache_.get(ObTransID(conflict_tx_id), commit_data));
+
+  // the later tx takes over the slot, and the earlier one must not be read from it
+  make_tx_data(conflict_tx_id, ObTxData::ABORT, tx_data);
+  cache_.put(tx_data);
+  EXPECT_FALSE(cache_.get(ObTransID(tx_id), commit_data));
+  ASSERT_TRUE(cache_.get(ObTransID(conflict_tx_id), commit_data));
+  EXPECT_EQ(ObTransID(conflict_tx_id), commit_data.tx_id_);
+  EXPECT_EQ(ObTxData::ABORT, commit_data.state_);
+  EXPECT_TRUE(is_consistent(commit_data));
+}
+
+TEST_F(TestTxStatusCache, concurrent_read_during_write)
+{
+  const int64_t WRITER_CNT = 2;
+  const int64_t READER_CNT = 4;
+  const int64_t WRITE_ROUND = 200000;
+  const int64_t tx_id = 4001;
+  const int64_t conflict_tx_id = find_conflict_tx_id(tx_id);
+  bool stop = false;
+  int64_t hit_cnt = 0;
+  int64_t torn_cnt = 0;
+
+  std::thread writers[WRITER_CNT];
+  std::thread readers[READER_CNT];
+  for (int64_t i = 0; i < WRITER_CNT; ++i) {
+    writers[i] = std::thread([&, i]() {
+      ObTxData tx_data;
+      for (int64_t round = 0; round < WRITE_ROUND; ++round) {
+        make_tx_data((round + i) % 2 ? tx_id : conflict_tx_id, ObTxData::COMMIT, tx_data);
+        cache_.put(tx_data);
+      }
+    });
+  }
+  for (int64_t i = 0; i < READER_CNT; ++i) {
+    readers[i] = std::thread([&, i]() {
+      ObTxCommitData commit_data;
+      const ObTransID read_tx_id(i % 2 ? tx_id : conflict_tx_id);
+      while (!ATOMIC_LOAD(&stop)) {
+        if (cache_.get(read_tx_id, commit_data)) {
+          ATOMIC_INC(&hit_cnt);
+          if (read_tx_id != commit_data.tx_id_ || !is_consistent(commit_data)) {
+            ATOMIC_INC(&torn_cnt);
+          }
+        }
+      }
+    });
+  }
+  for (int64_t i = 0; i < WRITER_CNT; ++i) {
+    writers[i].join();
+  }
+  ATOMIC_STORE(&stop, true);
+  for (int64_t i = 0; i < READER_CNT; ++i) {
+    readers[i].join();
+  }
+
+  STORAGE_LOG(INFO, "concurrent read during write", K(hit_cnt), K(torn_cnt));
+  EXPECT_EQ(0, torn_cnt);
+}
+
+TEST_F(TestTxStatusCache, clear_when_offline)
+{
+  ObTxData tx_data;
+  ObTxCommitData commit_data;
+  ObTxDataTable tx_data_table;
+  ObTxDataMemtableMgr memtable_mgr;
+  ObMemAttr mem_attr;
+  mem_attr.label_ = "TX_DATA_TABLE";
+
+  // an inited tx data table without memtables
+  memtable_mgr.is_inited_ = true;
+  tx_data_table.memtable_mgr_ = &memtable_mgr;
+  tx_data_table.is_inited_ = true;
+  ASSERT_EQ(OB_SUCCESS, tx_data_table.tx_status_cache_.init(mem_attr));
+
+  for (int64_t tx_id = 5001; tx_id <= 5100; ++tx_id) {
+    make_tx_data(tx_id, ObTxData::COMMIT, tx_data);
+    tx_data_table.tx_status_cache_.put(tx_data);
+  }
+  ASSERT_TRUE(tx_data_table.tx_status_cache_.get(ObTransID(5001), commit_data));
+
+  // the cached status must not survive the tablet going offline, since the tx data table
+  // may be rebuilt from another replica after it
+  ASSERT_EQ(OB_SUCCESS, tx_data_table.offline());
+  for (int64_t tx_id = 5001; tx_id <= 5100; ++tx_id) {
+    EXPECT_FALSE(tx_data_table.tx_status_cache_.get(ObTransID(tx_id), commit_data));
+  }
+
+  // the cache still works after being cleared
+  make_tx_data(5001, ObTxData::COMMIT, tx_data);
+  tx_data_table.tx_status_cache_.put(tx_data);
+  EXPECT_TRUE(tx_data_table.tx_status_cache_.get(ObTransID(5001), commit_data));
+
+  tx_data_table.memtable_mgr_ = nullptr;
+  tx_data_table.is_inited_ = false;
+  memtable_mgr.is_inited_ = false;
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_tx_status_cache.log*");
+  OB_LOGGER.set_file_name("test_tx_status_cache.log");
+  OB_LOGGER.set_log_level("INFO");
+  STORAGE_LOG(INFO, "begin unittest: test tx status cache");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}